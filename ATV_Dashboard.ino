@@ -26,11 +26,17 @@
 
 #include "Settings.h"
 #include "GPS.h"
+#include "RPM.h"
 #include "Display.h"
 #include "File.h"
 #include "Web_Server.h"
 #include "GPIO.h"
 #include "Leds.h"
+#include "Odometer.h"
+#include "GPS_Replay.h"
+#include "TripLog.h"
+#include "Storage.h"
+#include "Format.h"
 
 
 //---------------------------------------------
@@ -58,10 +64,34 @@ void setup(void)
   LEDS_Init();
   
   GPS_Init();
+  RPM_Init();
   OLED_Init();
 
-  File_Init();
+  File_Init(FILE_BACKEND);
+  Storage_Init();
   WebServer_Init();
+
+#ifdef GPS_REPLAY_FILE
+  OLED_Lock();
+  GPS_Replay_File(fileSystem, GPS_REPLAY_FILE, GPS_REPLAY_SPEED);
+  OLED_Unlock();
+#endif
+
+#ifdef BENCH_ODOMETER
+  ODO_Benchmark();
+#endif
+
+#ifdef BENCH_TRIPLOG
+  TripLog_Benchmark();
+#endif
+
+#ifdef BENCH_FORMAT
+  Format_Benchmark();
+#endif
+
+#ifdef BENCH_FILE
+  File_Benchmark();
+#endif
 }
 
 
@@ -75,13 +105,10 @@ void loop(void)
 {
   GPIO_Handle();
   
+  // Screens and leds are drawn by the render task (Display.cpp)
+  OLED_Lock();
   GPS_Process();
-
-  OLED_Handle();
-  
-  LEDS_Handle();
-  
-  GPS_Delay(0);
+  OLED_Unlock();
 
   WebServer_Handle();
 }
@@ -6,6 +6,18 @@
  * \author M.Navarro
  * \date 10/2018
  *
+ * Screens and leds are drawn by the render task, not by loop(): each screen
+ * has a target frame rate (RENDER_FPS_xxx), and a frame due is only drawn
+ * if an input of the screens changed since the last one (new fix, rpm,
+ * clock second, memory use, screen, button click). A button click is drawn
+ * at once. loop() calls OLED_Lock() / OLED_Unlock() around the code
+ * changing what the screens read.
+ *
+ * u8g2 draws in two frame buffers in turn, so the previous frame is kept.
+ * When the screen changes, the previous frame (outgoing screen) and the
+ * first frame of the new one (incoming screen) are the two snapshots of a
+ * transition: its frames are built from them by page / bit shifts or column
+ * copies, without drawing the screens, at RENDER_FPS_TRANSITION.
  */
 //-----------------------------------------------------------------------------
 // (c) Copyright MN 2018 - All rights reserved
@@ -21,10 +33,22 @@
 #include "GPIO.h"
 #include "File.h"
 #include "Settings.h"
+#include "SimuTrack.h"
+#include "RPM.h"
+#include "Format.h"
+#include "Display_SPI.h"
+#include "Leds.h"
 
 //---------------------------------------------
 // Defines
 //---------------------------------------------
+#define   RENDER_TASK_CORE          1         ///< With loop(), above it: drawn on time whatever loop() does
+#define   RENDER_TASK_PRIORITY      2
+#define   RENDER_TASK_STACK         6144
+#define   RENDER_TICK_MS            5         ///< Task wake-up period: frame time granularity, click latency
+
+//#define DEBUG_RENDER
+#define   RENDER_STATS_PERIOD_MS    10000     ///< Period of the statistics print, with DEBUG_RENDER
 
 
 //---------------------------------------------
@@ -33,12 +57,44 @@
 #define OLED_TIMER_PERIOD_US    10000000
 //#define DEBUG
 
-enum E_ScrollState
+typedef enum
+{
+  TRANSITION_NONE = 0,
+  TRANSITION_SCROLL_DOWN,               ///< Screens move down, the new one comes from the top
+  TRANSITION_SCROLL_UP,                 ///< Screens move up, the new one comes from the bottom
+  TRANSITION_SLIDE_LEFT,                ///< Screens move left, the new one comes from the right
+  TRANSITION_SLIDE_RIGHT,               ///< Screens move right, the new one comes from the left
+  TRANSITION_WIPE                       ///< New screen uncovered from left to right
+}e_transition;
+
+
+// What the screens display: a frame is drawn only when it changed
+typedef struct
+{
+  uint32_t  gpsUpdates;           ///< GPS_Process() calls with a fix processed
+  int32_t   rpm;
+  uint32_t  seconds;              ///< Clock, timed texts
+  uint64_t  usedBytes;            ///< Memory page
+  int       dispState;
+  int       transition;
+}s_renderInputs;
+
+
+// Static parts of a screen (legends, units), drawn once off-screen
+typedef struct
+{
+  uint8_t   bitmap[SCREEN_WIDTH * SCREEN_HEIGHT / 8]; ///< u8g2 buffer layout: 8 pages of 128 columns
+  int32_t   key;                  ///< Settings the layer was drawn with, -1 to draw it again
+}s_layer;
+
+
+typedef struct
 {
-  E_ScrollState_Idle,
-  E_ScrollState_ScrollDown,
-  E_ScrollState_ScrollUp
-};
+  e_transition type;              ///< TRANSITION_NONE when no transition runs
+  uint32_t  startMillis;
+  const uint8_t *from;            ///< Outgoing screen, previous frame buffer
+  uint8_t   to[SCREEN_WIDTH * SCREEN_HEIGHT / 8]; ///< Incoming screen, first frame drawn
+}s_transition;
 
 s_logo logos[NB_OF_LOGOS] = {{"None", logo_none_bits},
                              {"KTM", logo_ktm_bits},
@@ -50,7 +106,11 @@ s_logo logos[NB_OF_LOGOS] = {{"None", logo_none_bits},
 //---------------------------------------------
 // Variables
 //---------------------------------------------
+#ifdef OLED_SW_SPI
 U8G2_SSD1309_128X64_NONAME0_F_4W_SW_SPI u8g2(U8G2_R0, PIN_OLED_CLOCK, PIN_OLED_DATA, PIN_OLED_CS, PIN_OLED_DC, PIN_OLED_RESET);  
+#else
+U8G2_SSD1309_128X64_NONAME0_F_4W_DMA_SPI u8g2(U8G2_R0);
+#endif
 
 int maxRpm;
 
@@ -59,14 +119,26 @@ hw_timer_t * oledTimer = NULL;
 portMUX_TYPE oledTimerMux = portMUX_INITIALIZER_UNLOCKED;
 volatile int oledTimerTick = 0;
 
-E_ScrollState scrollState = E_ScrollState_Idle;
 int currentScreenNb = 0;
-int nextScreenNb = 0;
 void (*currentScreen)(int);
-void (*nextScreen)(int);
 
 e_DispState dispState = MAIN_SCREEN;
 
+s_renderStats renderStats;
+static SemaphoreHandle_t renderMutex = NULL;
+static s_renderInputs renderInputs;       ///< Inputs of the last frame drawn
+
+static s_layer mainLayer = {{0}, -1};
+static s_layer trackLayer = {{0}, -1};
+static s_layer statsLayer = {{0}, -1};
+static s_layer headerLayer = {{0}, -1};     ///< Title and lines of the menu and settings pages
+
+static uint8_t spareFrame[SCREEN_WIDTH * SCREEN_HEIGHT / 8];  ///< u8g2 draws here and in its own buffer in turn
+static uint8_t *previousFrame = spareFrame;
+static e_DispState previousDispState = MAIN_SCREEN;
+static e_transition transitionRequest = TRANSITION_NONE;  ///< Set while drawing a frame, started after it
+static s_transition transition;
+
 // Menus
 s_Menu menu_Main;
 s_Menu menu_LedsSettings;
@@ -79,6 +151,9 @@ s_Menu menu_Memory;
 //---------------------------------------------
 void OLED_Init();
 void OLED_Handle();
+void OLED_Lock();
+void OLED_Unlock();
+void OLED_PrintStats();
 
 
 //---------------------------------------------
@@ -89,6 +164,7 @@ static void OLED_DisplayMain();
 static void OLED_DisplayMenu(s_Menu *menu);
 static void OLED_ExitMenu(void);
 static void OLED_SetMaxRPM();
+static void OLED_SetRpmPulses();
 static void OLED_SetLedBrightness();
 static void OLED_SetBrandLogo();
 static void OLED_SetMainDisplayStyle();
@@ -99,6 +175,7 @@ static void MenuMain(void);
 static void MenuLedsSettings(void);
 static void MenuSettings(void);
 static void MenuSetMaxRPM();
+static void MenuSetRpmPulses();
 static void MenuSetLedBrightness();
 static void MenuBrandLogo();
 static void MenuSetMainDisplayStyle();
@@ -121,12 +198,31 @@ static void OLED_Display_Time(int xPos, int yPos);
 static void OLED_Display_Satellites(int xPos, int yPos);
 static void OLED_Display_Altitude(int xPos, int yPos);
 static void OLED_Display_Gear(int xPos, int yPos);
-static void OLED_Display_Track(int xPos, int yPos, int width, int heigth, double *xDataArray, double *yDataArray, int dataSize);
-static void OLED_Display_History(int xPos, int yPos, int width, int heigth, int * dataArray, int dataSize, char * chartName);
+static void OLED_Display_Track(int xPos, int yPos, int width, int heigth, s_track *track);
+
+// Static parts of main screens, drawn in the layer
+static const uint8_t *OLED_Layer_Main();
+static const uint8_t *OLED_Layer_Track();
+static const uint8_t *OLED_Layer_Stats();
+static const uint8_t *OLED_Layer_Header(const char *header);
+static uint8_t *OLED_Layer_Begin(s_layer *layer);
+static const uint8_t *OLED_Layer_End(s_layer *layer, uint8_t *frame, int32_t key);
+static void OLED_Layer_RPM(int xPos, int yPos);
+static void OLED_Layer_RPM2(int xPos, int yPos);
+static void OLED_Layer_Speed(int xPos, int yPos);
+static void OLED_Layer_Speed2(int xPos, int yPos);
+static void OLED_Layer_History(int xPos, int yPos, int width, int heigth, const char *chartName);
+static void OLED_BlitLayer(const uint8_t *layer, int vOffset);
+static void OLED_Display_History(int xPos, int yPos, int width, int heigth, const s_history *history, e_historyField field);
 
-static int  OLED_Scroll_Screens();
 static void OLED_ScrollDown();
 static void OLED_ScrollUp();
+static void OLED_Transition_Start(e_transition type);
+static void OLED_Transition_Draw();
+static void OLED_SendBuffer();
+static void OLED_RenderTask(void *param);
+static bool OLED_InputsChanged();
+static uint32_t OLED_FramePeriodUs();
 
 void IRAM_ATTR displayTimerISR();
 
@@ -160,22 +256,13 @@ void OLED_Init()
   u8g2.setFont( u8g2_font_5x7_tf);
   sprintf(buff, "V%s", Settings_SoftVersion());
   u8g2.drawStr( 90, 64 , buff);
-  u8g2.sendBuffer();
-
-  currentScreen = OLED_Screen_Main;
-  nextScreen = OLED_Screen_Track;
+  OLED_SendBuffer();
 
-#ifdef SIMU_TEST_GPS
-  for(int i = 0; i < 2038; i++)
-  {
-    gpsHistory.lng[i] = titi[i*2];
-    gpsHistory.lat[i] = titi[i*2+1];
-    gpsHistory.alt[i] = tete[i];
-    gpsHistory.spd[i] = tete[i];
-    gpsHistory.pointsIndex++;
-  }
+#if defined(BENCH_OLED) && !defined(OLED_SW_SPI)
+  Display_SPI_Benchmark(u8g2.getBufferPtr());
 #endif
 
+  currentScreen = OLED_Screen_Main;
 
   // Main Menu elements
   
@@ -230,9 +317,14 @@ void OLED_Init()
   menu_Settings.items[3].type = FUNCTION;
   menu_Settings.items[3].func = MenuBrandLogo;
 
+  menu_Settings.items[4].name = "RPM pulses/rev";
+  menu_Settings.items[4].type = VALUE_INT;
+  menu_Settings.items[4].func = MenuSetRpmPulses;
+  menu_Settings.items[4].ptrValue = Settings_RpmPulsesPerRev;
+
   menu_Settings.previousMenu = MenuMain;
   menu_Settings.header = "Settings";
-  menu_Settings.nbElements = 4;
+  menu_Settings.nbElements = 5;
 
   menu_Memory.items[0].name = "Size";
   menu_Memory.items[0].type = FUNCTION;
@@ -242,17 +334,84 @@ void OLED_Init()
   menu_Memory.header = "Memory";
   menu_Memory.nbElements = 1;
   dispState = MAIN_SCREEN; 
+
+  renderMutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(OLED_RenderTask, "render", RENDER_TASK_STACK, NULL,
+                          RENDER_TASK_PRIORITY, NULL, RENDER_TASK_CORE);
+}
+
+
+//---------------------------------------------
+/// \fn void OLED_Lock(void)
+///
+/// \brief Keep the render task from drawing, while loop() changes what the
+///        screens read (fix, track, history). Waits for the frame in
+///        progress. Release with OLED_Unlock().
+/// \param None.
+/// \return None.
+void OLED_Lock()
+{
+  xSemaphoreTake(renderMutex, portMAX_DELAY);
+}
+
+
+//---------------------------------------------
+/// \fn void OLED_Unlock(void)
+///
+/// \brief Let the render task draw again, see OLED_Lock().
+/// \param None.
+/// \return None.
+void OLED_Unlock()
+{
+  xSemaphoreGive(renderMutex);
+}
+
+
+//---------------------------------------------
+/// \fn void OLED_PrintStats(void)
+///
+/// \brief Print render task frame counters on Serial.
+/// \param None.
+/// \return None.
+void OLED_PrintStats()
+{
+  Serial.printf("Render: %u frames, %u skipped (unchanged), frame %u us avg, %u us max, %u us late max\r\n",
+                renderStats.frames, renderStats.skipped, renderStats.frameUs / max(renderStats.frames, (uint32_t)1),
+                renderStats.maxFrameUs, renderStats.maxLateUs);
 }
 
 
 void OLED_Handle()
 {  
+  u8g2_t *u8g2Struct = u8g2.getU8g2();
+  uint8_t *frame;
+
    // Display main Screen only if splash logo finished 
   if(millis() < SPLASH_LOGO_DURATION_MS)
   {
     return;
   }
 
+  if(transition.type != TRANSITION_NONE)
+  {
+    OLED_Transition_Draw();
+    OLED_SendBuffer();
+    return;
+  }
+
+  // The frame drawn last is kept, outgoing screen of a transition
+  frame = u8g2Struct->tile_buf_ptr;
+  u8g2Struct->tile_buf_ptr = previousFrame;
+  previousFrame = frame;
+
+  // Menus slide in from the right and back, submenus and settings are wiped in
+  if(dispState != previousDispState)
+  {
+    transitionRequest = (previousDispState == MAIN_SCREEN) ? TRANSITION_SLIDE_LEFT :
+                        (dispState == MAIN_SCREEN) ? TRANSITION_SLIDE_RIGHT : TRANSITION_WIPE;
+    previousDispState = dispState;
+  }
+
   u8g2.clearBuffer();
   u8g2.setDrawColor(1);
 
@@ -282,6 +441,10 @@ void OLED_Handle()
       OLED_SetMaxRPM();
       break;
 
+    case MENU_SETTINGS_RPMPULSES:
+      OLED_SetRpmPulses();
+      break;
+
     case MENU_LED_BRIGHTNESS:
       OLED_SetLedBrightness();
       break;
@@ -299,7 +462,157 @@ void OLED_Handle()
       break;
   }
 
+  if(transitionRequest != TRANSITION_NONE)
+  {
+    OLED_Transition_Start(transitionRequest);
+    transitionRequest = TRANSITION_NONE;
+  }
+
+  OLED_SendBuffer();
+}
+
+
+// Draws a frame when one is due and the screen inputs changed, or at once on a click; leds at RENDER_FPS_LEDS
+static void OLED_RenderTask(void *param)
+{
+  uint32_t dueUs = micros();
+  uint32_t ledsMillis = millis();
+  uint32_t startUs, frameUs, lateUs, waitMs;
+  bool click, changed, redraw = true, followUp;
+
+  for(;;)
+  {
+    // Until the next frame is due, RENDER_TICK_MS at most for leds and clicks
+    startUs = micros();
+    waitMs = ((int32_t)(dueUs - startUs) > 0) ? (dueUs - startUs) / 1000 : 0;
+    vTaskDelay(pdMS_TO_TICKS(constrain(waitMs, (uint32_t)1, (uint32_t)RENDER_TICK_MS)));
+
+    if(millis() - ledsMillis >= 1000 / RENDER_FPS_LEDS)
+    {
+      ledsMillis = millis();
+      LEDS_Handle();
+    }
+
+    startUs = micros();
+    click = GPIO_IsButtonEvent();
+    if(!click && ((int32_t)(startUs - dueUs) < 0))
+    {
+      continue;
+    }
+    lateUs = startUs - dueUs;
+
+    xSemaphoreTake(renderMutex, portMAX_DELAY);
+
+    changed = OLED_InputsChanged();
+    followUp = redraw;
+    if(click || changed || redraw || (transition.type != TRANSITION_NONE))
+    {
+      if(!click && !followUp && (lateUs > renderStats.maxLateUs))
+      {
+        renderStats.maxLateUs = lateUs;
+      }
+
+      // Clicks not read by the screen drawn are dropped, not kept for ever
+      GPIO_LatchButtons();
+      OLED_Handle();
+      // A click is handled while drawing: its effect shows in the next frame, drawn at once
+      redraw = click;
+
+      frameUs = micros() - startUs;
+      renderStats.frames++;
+      renderStats.frameUs += frameUs;
+      if(frameUs > renderStats.maxFrameUs)
+      {
+        renderStats.maxFrameUs = frameUs;
+      }
+    }
+    else
+    {
+      renderStats.skipped++;
+    }
+
+    // Frames on a fixed schedule, unless too late to catch up or out of it (click)
+    if(redraw)
+    {
+      dueUs = startUs;
+    }
+    else if(click || ((int32_t)lateUs < 0) || (lateUs >= OLED_FramePeriodUs()))
+    {
+      dueUs = startUs + OLED_FramePeriodUs();
+    }
+    else
+    {
+      dueUs += OLED_FramePeriodUs();
+    }
+
+    xSemaphoreGive(renderMutex);
+
+#ifdef DEBUG_RENDER
+    static unsigned long statsMillis = 0;
+    if(millis() - statsMillis >= RENDER_STATS_PERIOD_MS)
+    {
+      statsMillis = millis();
+      OLED_PrintStats();
+    }
+#endif
+  }
+}
+
+
+// Compares the screen inputs with the ones of the last frame, and keeps them
+static bool OLED_InputsChanged()
+{
+  s_renderInputs inputs;
+  bool changed;
+
+  memset(&inputs, 0, sizeof(inputs));
+  inputs.gpsUpdates = gpsProcessStats.calls - gpsProcessStats.idleCalls;
+  inputs.rpm = (int32_t)rpm;
+  inputs.seconds = millis() / 1000;
+  inputs.dispState = dispState;
+  inputs.transition = transition.type;
+  if(dispState == MENU_MEMORY_SHOWSIZE)
+  {
+    inputs.usedBytes = File_UsedBytes();
+  }
+
+  changed = (memcmp(&inputs, &renderInputs, sizeof(inputs)) != 0);
+  renderInputs = inputs;
+
+  return changed;
+}
+
+
+// Frame period of the screen displayed
+static uint32_t OLED_FramePeriodUs()
+{
+  if(transition.type != TRANSITION_NONE)
+  {
+    return 1000000 / RENDER_FPS_TRANSITION;
+  }
+
+  switch(dispState)
+  {
+    case MAIN_SCREEN:
+      return 1000000 / RENDER_FPS_MAIN;
+
+    case MENU_MEMORY_SHOWSIZE:
+      return 1000000 / RENDER_FPS_MEMORY;
+
+    default:
+      return 1000000 / RENDER_FPS_MENU;
+  }
+}
+
+
+// Sends the u8g2 buffer, without waiting for the transfer with the DMA transport
+static void OLED_SendBuffer()
+{
+#ifdef OLED_SW_SPI
   u8g2.sendBuffer();
+#else
+  Display_SPI_Flush(u8g2.getBufferPtr());
+#endif
 }
 
 
@@ -332,6 +645,12 @@ void MenuSetMaxRPM()
   dispState = MENU_SETTINGS_SETMAXRPM;
 }
 
+
+void MenuSetRpmPulses()
+{
+  dispState = MENU_SETTINGS_RPMPULSES;
+}
+
 void MenuSetLedBrightness()
 {
   dispState = MENU_LED_BRIGHTNESS;
@@ -369,10 +688,7 @@ void OLED_DisplayMenu(s_Menu *menu)
  
   u8g2.setDrawColor(1);
   u8g2.setFont( u8g2_font_6x10_tf);//u8g2_font_5x7_tf);
-  u8g2.drawStr( 10, 11 , menu->header);
-  
-  u8g2.drawLine(2,2,125,2);
-  u8g2.drawLine(2,12,125,12);
+  OLED_BlitLayer(OLED_Layer_Header(menu->header), 0);
 
   if(menu->currentSelection >= (menu->firstDisplayElement + MAX_DISPLAY_ITEMS) )
   {
@@ -421,7 +737,7 @@ void OLED_DisplayMenu(s_Menu *menu)
       }
       else if(menu->items[i+menu->firstDisplayElement].type == VALUE_INT)
       {
-        sprintf(buff, "%d", (*menu->items[i+menu->firstDisplayElement].ptrValue)());
+        Format_Int(buff, (*menu->items[i+menu->firstDisplayElement].ptrValue)());
         
         u8g2.drawStr(120-u8g2.getStrWidth(buff),22+10*i, buff);
       }
@@ -455,41 +771,29 @@ void OLED_DisplayMenu(s_Menu *menu)
 void OLED_MemoryShowSize()
 {
   char buff[32];
-  static int dataRead = 0;
-  static int totalBytes = 0;
-  static int usedBytes = 0;
+  uint64_t totalBytes = File_TotalBytes();
+  uint64_t usedBytes = File_UsedBytes();
   
   u8g2.setDrawColor(1);
   u8g2.setFont( u8g2_font_6x10_tf);
-  u8g2.drawStr( 10, 11 , "Memory used");
-  
-  u8g2.drawLine(2,2,125,2);
-  u8g2.drawLine(2,12,125,12);
+  OLED_BlitLayer(OLED_Layer_Header("Memory used"), 0);
   
-  if(!dataRead)
-  {
-    totalBytes = File_TotalBytes(fileSystem);
-    usedBytes = File_UsedBytes(fileSystem);
-    Serial.println(totalBytes);
-    Serial.println(usedBytes);
-    dataRead = 1;
-  }
-  
-  sprintf(buff, "%s / %s",File_FormatSize(usedBytes), File_FormatSize(totalBytes));
+  sprintf(buff, "%s / %s",File_FormatSize(usedBytes).c_str(), File_FormatSize(totalBytes).c_str());
   u8g2.drawStr( 10, 30 , buff);
 
   u8g2.drawFrame(12, 40, 100, 15);
-  u8g2.drawBox(14, 42, 100.0*usedBytes/totalBytes, 11);
+  if(totalBytes > 0)
+  {
+    u8g2.drawBox(14, 42, 96*usedBytes/totalBytes, 11);
+  }
     
   if(GPIO_IsButtonClicked(BP_RIGHT_UP))
   {
     MenuMemory();
-    dataRead = 0;
   }
   else if(GPIO_IsButtonClicked(BP_RIGHT_DOWN))
   {
     MenuMemory();
-    dataRead = 0;
   }
 }
 
@@ -500,12 +804,9 @@ void OLED_SetMaxRPM()
   
   u8g2.setDrawColor(1);
   u8g2.setFont( u8g2_font_6x10_tf);
-  u8g2.drawStr( 10, 11 , "Set Value");
-  
-  u8g2.drawLine(2,2,125,2);
-  u8g2.drawLine(2,12,125,12);
+  OLED_BlitLayer(OLED_Layer_Header("Set Value"), 0);
   
-  sprintf(buff, "%d", Settings_MaxRpm());
+  Format_Int(buff, Settings_MaxRpm());
   u8g2.drawStr(5, 40, "Max RPM:");
   u8g2.drawStr(100-u8g2.getStrWidth(buff)/2+2,40, buff );
 
@@ -534,18 +835,52 @@ void OLED_SetMaxRPM()
 }
 
 
-void OLED_SetLedBrightness()
+void OLED_SetRpmPulses()
 {
   char buff[32];
   
   u8g2.setDrawColor(1);
   u8g2.setFont( u8g2_font_6x10_tf);
-  u8g2.drawStr( 10, 11 , "Set Value");
+  OLED_BlitLayer(OLED_Layer_Header("Set Value"), 0);
   
-  u8g2.drawLine(2,2,125,2);
-  u8g2.drawLine(2,12,125,12);
+  Format_Int(buff, Settings_RpmPulsesPerRev());
+  u8g2.drawStr(5, 40, "Pulses/rev:");
+  u8g2.drawStr(100-u8g2.getStrWidth(buff)/2+2,40, buff );
+
+  u8g2.setFont(u8g2_font_6x12_t_symbols);
+  u8g2.drawGlyph(100, 30, 0x25b2);
+  u8g2.drawGlyph(100, 50, 0x25bc);
+
+  if(GPIO_IsButtonClicked(BP_LEFT_UP))
+  {
+    Settings_RpmPulsesPerRev_Inc();
+  }
+  else if(GPIO_IsButtonClicked(BP_LEFT_DOWN))
+  {
+    Settings_RpmPulsesPerRev_Dec();
+  }
+  else if(GPIO_IsButtonClicked(BP_RIGHT_UP))
+  {
+    Settings_Save();
+    MenuSettings();
+  }
+  else if(GPIO_IsButtonClicked(BP_RIGHT_DOWN))
+  {
+    Settings_Save();
+    MenuSettings();
+  }
+}
+
+
+void OLED_SetLedBrightness()
+{
+  char buff[32];
   
-  sprintf(buff, "%d", Settings_LedBrightness());
+  u8g2.setDrawColor(1);
+  u8g2.setFont( u8g2_font_6x10_tf);
+  OLED_BlitLayer(OLED_Layer_Header("Set Value"), 0);
+  
+  Format_Int(buff, Settings_LedBrightness());
   u8g2.drawStr(5, 40, "Led bright.:");
   u8g2.drawStr(100-u8g2.getStrWidth(buff)/2+2,40, buff );
 
@@ -580,12 +915,9 @@ void OLED_SetBrandLogo()
   
   u8g2.setDrawColor(1);
   u8g2.setFont( u8g2_font_6x10_tf);
-  u8g2.drawStr( 10, 11 , "Set Logo");
-  
-  u8g2.drawLine(2,2,125,2);
-  u8g2.drawLine(2,12,125,12);
+  OLED_BlitLayer(OLED_Layer_Header("Set Logo"), 0);
   
-  sprintf(buff, "%s", logos[Settings_BrandLogo()].name);
+  Format_Str(buff, logos[Settings_BrandLogo()].name);
   u8g2.drawStr(5, 40, "Brand:");
   u8g2.drawStr(100-u8g2.getStrWidth(buff)/2+2,40, buff );
 
@@ -620,12 +952,9 @@ void OLED_SetMainDisplayStyle()
   
   u8g2.setDrawColor(1);
   u8g2.setFont( u8g2_font_6x10_tf);
-  u8g2.drawStr( 10, 11 , "Set Display style");
-  
-  u8g2.drawLine(2,2,125,2);
-  u8g2.drawLine(2,12,125,12);
+  OLED_BlitLayer(OLED_Layer_Header("Set Display style"), 0);
   
-  sprintf(buff, "%d", Settings_MainDisplayStyle());
+  Format_Int(buff, Settings_MainDisplayStyle());
   u8g2.drawStr(5, 40, "Style:");
   u8g2.drawStr(100-u8g2.getStrWidth(buff)/2+2,40, buff );
 
@@ -656,126 +985,140 @@ void OLED_SetMainDisplayStyle()
 
 void OLED_DisplayMain()
 {
-  if(scrollState != E_ScrollState_Idle)
+  if(GPIO_IsButtonClicked(BP_LEFT_DOWN))
   {
-    if(OLED_Scroll_Screens())
-    {
-      scrollState = E_ScrollState_Idle;
-      currentScreenNb = nextScreenNb;
-      currentScreen = nextScreen;
-    }
+    OLED_ScrollDown();
   }
-  else
+  else if(GPIO_IsButtonClicked(BP_LEFT_UP))
   {
-    if(GPIO_IsButtonClicked(BP_LEFT_DOWN))
-    {
-      OLED_ScrollDown();
-    }
-    else if(GPIO_IsButtonClicked(BP_LEFT_UP))
-    {
-      OLED_ScrollUp();
-    }
-    else if(GPIO_IsButtonClicked(BP_RIGHT_UP))
-    {
-      MenuMain();
-    }
-
-    // Draw currentScreen
-    currentScreen(0);
+    OLED_ScrollUp();
+  }
+  else if(GPIO_IsButtonClicked(BP_RIGHT_UP))
+  {
+    MenuMain();
   }
+
+  // Draw currentScreen
+  currentScreen(0);
 }
 
 
 void OLED_ScrollDown()
 {
-  if(scrollState == E_ScrollState_Idle)
+  transitionRequest = TRANSITION_SCROLL_DOWN;
+  
+  if(currentScreenNb == 0 )
   {
-    scrollState = E_ScrollState_ScrollDown;
-    
-    if(currentScreenNb == 0 )
-    {
-      nextScreenNb = 1;
-      currentScreen = OLED_Screen_Main;
-      nextScreen = OLED_Screen_Track;
-    }
-    else if(currentScreenNb == 1)
-    {
-      nextScreenNb = 2;
-      currentScreen = OLED_Screen_Track;
-      nextScreen = OLED_Screen_Stats;
-    }
-    else
-    {
-      nextScreenNb = 0;
-      currentScreen = OLED_Screen_Stats;
-      nextScreen = OLED_Screen_Main;
-    }
+    currentScreenNb = 1;
+    currentScreen = OLED_Screen_Track;
   }
-}
-
-void OLED_ScrollUp()
-{
-  if(scrollState == E_ScrollState_Idle)
+  else if(currentScreenNb == 1)
   {
-    scrollState = E_ScrollState_ScrollUp;
-    
-    if(currentScreenNb == 0 )
-    {
-       nextScreenNb = 2;
-       currentScreen = OLED_Screen_Main;
-       nextScreen = OLED_Screen_Stats;
-    }
-    else if(currentScreenNb == 1)
-    {
-      nextScreenNb = 0;
-      currentScreen = OLED_Screen_Track;
-      nextScreen = OLED_Screen_Main;
-    }
-    else
-    {
-      nextScreenNb = 1;
-      currentScreen = OLED_Screen_Stats;
-      nextScreen = OLED_Screen_Track;
-    }
+    currentScreenNb = 2;
+    currentScreen = OLED_Screen_Stats;
+  }
+  else
+  {
+    currentScreenNb = 0;
+    currentScreen = OLED_Screen_Main;
   }
 }
 
-
-static int OLED_Scroll_Screens()
+void OLED_ScrollUp()
 {
-  static int offset = 0;
-
-  if(scrollState == E_ScrollState_ScrollDown)
+  transitionRequest = TRANSITION_SCROLL_UP;
+  
+  if(currentScreenNb == 0 )
   {
-    currentScreen(offset);
-    nextScreen(offset-SCREEN_HEIGHT);
+    currentScreenNb = 2;
+    currentScreen = OLED_Screen_Stats;
   }
-  else if(scrollState == E_ScrollState_ScrollUp)
+  else if(currentScreenNb == 1)
   {
-    currentScreen(-offset);
-    nextScreen(SCREEN_HEIGHT-offset);
+    currentScreenNb = 0;
+    currentScreen = OLED_Screen_Main;
   }
   else
   {
-    return 1;
+    currentScreenNb = 1;
+    currentScreen = OLED_Screen_Track;
   }
+}
 
-  offset += 8;
-  
-  if (offset >= SCREEN_HEIGHT)
+
+// Starts a transition from the previous frame to the frame just drawn
+static void OLED_Transition_Start(e_transition type)
+{
+  memcpy(transition.to, u8g2.getBufferPtr(), sizeof(transition.to));
+  transition.from = previousFrame;
+  transition.startMillis = millis();
+  transition.type = type;
+
+  OLED_Transition_Draw();
+}
+
+
+// Builds the transition frame of the elapsed time from the two snapshots
+static void OLED_Transition_Draw()
+{
+  uint8_t *frame = u8g2.getBufferPtr();
+  uint32_t elapsed = millis() - transition.startMillis;
+  int height, width;
+
+  if(elapsed >= TRANSITION_DURATION_MS)
   {
-    offset = 0;
-    return 1;
+    memcpy(frame, transition.to, sizeof(transition.to));
+    transition.type = TRANSITION_NONE;
+    return;
   }
-  else
+
+  height = elapsed * SCREEN_HEIGHT / TRANSITION_DURATION_MS;
+  width = elapsed * SCREEN_WIDTH / TRANSITION_DURATION_MS;
+
+  switch(transition.type)
   {
-    return 0;
+    case TRANSITION_SCROLL_DOWN:
+    case TRANSITION_SCROLL_UP:
+      if(transition.type == TRANSITION_SCROLL_UP)
+      {
+        height = -height;
+      }
+      memset(frame, 0, sizeof(transition.to));
+      OLED_BlitLayer(transition.from, height);
+      OLED_BlitLayer(transition.to, (height >= 0) ? height - SCREEN_HEIGHT : height + SCREEN_HEIGHT);
+      break;
+
+    case TRANSITION_SLIDE_LEFT:
+      for(int page = 0; page < SCREEN_HEIGHT / 8; page++)
+      {
+        memcpy(&frame[page * SCREEN_WIDTH], &transition.from[page * SCREEN_WIDTH + width], SCREEN_WIDTH - width);
+        memcpy(&frame[page * SCREEN_WIDTH + SCREEN_WIDTH - width], &transition.to[page * SCREEN_WIDTH], width);
+      }
+      break;
+
+    case TRANSITION_SLIDE_RIGHT:
+      for(int page = 0; page < SCREEN_HEIGHT / 8; page++)
+      {
+        memcpy(&frame[page * SCREEN_WIDTH], &transition.to[page * SCREEN_WIDTH + SCREEN_WIDTH - width], width);
+        memcpy(&frame[page * SCREEN_WIDTH + width], &transition.from[page * SCREEN_WIDTH], SCREEN_WIDTH - width);
+      }
+      break;
+
+    default:
+      for(int page = 0; page < SCREEN_HEIGHT / 8; page++)
+      {
+        memcpy(&frame[page * SCREEN_WIDTH], &transition.to[page * SCREEN_WIDTH], width);
+        memcpy(&frame[page * SCREEN_WIDTH + width], &transition.from[page * SCREEN_WIDTH + width], SCREEN_WIDTH - width);
+      }
+      break;
   }
 }
 
 
 static void OLED_Screen_Main(int vOffset)
 {  
+  OLED_BlitLayer(OLED_Layer_Main(), vOffset);
+
   if(Settings_MainDisplayStyle() == 0)
   {
     OLED_Display_RPM(0, vOffset+0);
@@ -827,41 +1170,32 @@ static void OLED_Screen_Main(int vOffset)
 
 static void OLED_Screen_Track(int vOffset)
 {
-  u8g2.drawFrame(0,vOffset,128,64);
-  OLED_Display_Track(0, vOffset, 128, 64, gpsHistory.lng, gpsHistory.lat, gpsHistory.pointsIndex);
+#ifdef SIMU_TEST_GPS
+  SIMU_LoadHistory(&gpsHistory, &gpsTrack);
+#endif
+
+  OLED_BlitLayer(OLED_Layer_Track(), vOffset);
+  OLED_Display_Track(0, vOffset, 128, 64, &gpsTrack);
 }
 
 
 static void OLED_Screen_Stats(int vOffset)
 {
-  OLED_Display_History(20, 5+vOffset, 100, 25, gpsHistory.alt, gpsHistory.pointsIndex, "Alt");
-  OLED_Display_History(20, 35+vOffset, 100, 25, gpsHistory.spd, gpsHistory.pointsIndex, "Spd");
+#ifdef SIMU_TEST_GPS
+  SIMU_LoadHistory(&gpsHistory, &gpsTrack);
+#endif
+
+  OLED_BlitLayer(OLED_Layer_Stats(), vOffset);
+  OLED_Display_History(20, 5+vOffset, 100, 25, &gpsHistory, HISTORY_FIELD_ALT);
+  OLED_Display_History(20, 35+vOffset, 100, 25, &gpsHistory, HISTORY_FIELD_SPD);
 }
 
 
-// Displays actual RPM, at the top of the screen.
+// Displays actual RPM, at the top of the screen. Legend in the layer, OLED_Layer_RPM()
 static void OLED_Display_RPM(int xPos, int yPos)
 {
-  char buff[32];
-  float coef = (float)SCREEN_WIDTH / (settings.maxRPM/1000.0);
   int bargraphWidth;
 
-  u8g2.drawLine(xPos, yPos+18, SCREEN_WIDTH, yPos+18);
-
-  // Creates bargraph legend
-  for(int i = 0; i < ((settings.maxRPM/1000)-1); i++)
-  {
-    u8g2.drawFrame(xPos+((coef*(i+1))+0.5), yPos+8, 1, 2);  // USE FRAME WITH width of 1 to avoid line issues...
-    sprintf(buff, "%d", i+1);
-    u8g2.setFont( u8g2_font_micro_tr);
-    u8g2.drawStr( xPos + (coef*(i+1)-1),yPos+17 , buff);          //*1000 rpm numbers
-  }
-
-  for(int i = 0; i < ((settings.maxRPM/1000)+1); i++)
-  {
-    u8g2.drawPixel(xPos + ((coef*i)+0.5+(coef/2)+0.5), yPos+8);    // 500 rpms markers   
-  }
-
   bargraphWidth = (rpm / (settings.maxRPM) * SCREEN_WIDTH)+0.5;
 
   // Compute "Recent max rpm" bar
@@ -890,15 +1224,11 @@ static void OLED_Display_RPM(int xPos, int yPos)
 static void OLED_Display_RPM2(int xPos, int yPos)
 {
   char buff[32];
-  static int filteredRpm = 0;
-
-  filteredRpm = filteredRpm*((float)10 / ((float)1 + (float)10)) +  rpm * ((float)1 / ((float)1 + (float)10));
 
-  sprintf(buff, "%5d rpm", (int)(filteredRpm));
+  Format_IntPad(buff, (int)(rpm), 5);     // " rpm" in the layer, OLED_Layer_RPM2()
 
   u8g2.setFont( u8g2_font_8x13B_tr  );
   u8g2.drawStr( xPos, yPos , buff);
-  //u8g2.drawStr( xPos+90, yPos , "rpm");
 }
 
 
@@ -906,19 +1236,17 @@ static void OLED_Display_Speed(int xPos, int yPos)
 {
   char buff[32];
 
-  if(gps.speed.isValid())
+  if(gpsFix.speedValid)
   {
-    sprintf(buff, "%d", (int)(gps.speed.kmph()+0.5));
+    Format_Int(buff, GPS_MMS_TO_KMH(gpsFix.speed));
   }
   else
   {
-    sprintf(buff, "---");
+    Format_Str(buff, "---");
   }
 
   u8g2.setFont( u8g2_font_fub25_tn  );//u8g2_font_helvB24_tn);//u8g2_font_freedoomr25_tn );
   u8g2.drawStr( xPos+56-u8g2.getStrWidth(buff), yPos , buff);
-  u8g2.setFont( u8g2_font_5x7_tf);
-  u8g2.drawStr( xPos+60, yPos-20 , "km/h");
 }
 
 
@@ -928,29 +1256,228 @@ static void OLED_Display_Speed2(int xPos, int yPos)
 
   u8g2.setFont( u8g2_font_fub35_tn  );// u8g2_font_7Segments_26x42_mn  );//u8g2_font_logisoso38_tn  );//u8g2_font_fur35_tn );
   
-  if(gps.speed.isValid())
+  if(gpsFix.speedValid)
   {
-    sprintf(buff, "%d", (int)(gps.speed.kmph()+0.5));
+    Format_Int(buff, GPS_MMS_TO_KMH(gpsFix.speed));
   }
   else
   {
-    sprintf(buff, "---");
+    Format_Str(buff, "---");
   }
 
   u8g2.drawStr( xPos+80-u8g2.getStrWidth(buff), yPos , buff);
-  
+}
+
+
+// Static parts of the main screen, drawn again only when the display style or max rpm changed
+static const uint8_t *OLED_Layer_Main()
+{
+  int32_t key = settings.maxRPM * 2 + Settings_MainDisplayStyle();
+  uint8_t *frame;
+
+  if(mainLayer.key == key)
+  {
+    return mainLayer.bitmap;
+  }
+
+  frame = OLED_Layer_Begin(&mainLayer);
+
+  // Same positions as OLED_Screen_Main(), at vOffset 0
+  if(Settings_MainDisplayStyle() == 0)
+  {
+    OLED_Layer_RPM(0, 0);
+    OLED_Layer_Speed(0, 48);
+  }
+  else
+  {
+    OLED_Layer_RPM2(42, 12);
+    OLED_Layer_Speed2(0, 52);
+  }
+
+  return OLED_Layer_End(&mainLayer, frame, key);
+}
+
+
+// Frame of the track screen, drawn once
+static const uint8_t *OLED_Layer_Track()
+{
+  uint8_t *frame;
+
+  if(trackLayer.key == 0)
+  {
+    return trackLayer.bitmap;
+  }
+
+  frame = OLED_Layer_Begin(&trackLayer);
+  u8g2.drawFrame(0, 0, 128, 64);
+
+  return OLED_Layer_End(&trackLayer, frame, 0);
+}
+
+
+// Axes and names of the stats charts, same positions as OLED_Screen_Stats(), drawn once
+static const uint8_t *OLED_Layer_Stats()
+{
+  uint8_t *frame;
+
+  if(statsLayer.key == 0)
+  {
+    return statsLayer.bitmap;
+  }
+
+  frame = OLED_Layer_Begin(&statsLayer);
+  OLED_Layer_History(20, 5, 100, 25, "Alt");
+  OLED_Layer_History(20, 35, 100, 25, "Spd");
+
+  return OLED_Layer_End(&statsLayer, frame, 0);
+}
+
+
+// Title between two lines, at the top of the menu and settings pages. Drawn
+// again only when the page title changes
+static const uint8_t *OLED_Layer_Header(const char *header)
+{
+  int32_t key = (int32_t)(uintptr_t)header;
+  uint8_t *frame;
+
+  if(headerLayer.key == key)
+  {
+    return headerLayer.bitmap;
+  }
+
+  frame = OLED_Layer_Begin(&headerLayer);
+  u8g2.setFont( u8g2_font_6x10_tf);
+  u8g2.drawStr( 10, 11 , header);
+
+  u8g2.drawLine(2,2,125,2);
+  u8g2.drawLine(2,12,125,12);
+
+  return OLED_Layer_End(&headerLayer, frame, key);
+}
+
+
+// u8g2 draws in the layer instead of the frame, until OLED_Layer_End()
+static uint8_t *OLED_Layer_Begin(s_layer *layer)
+{
+  u8g2_t *u8g2Struct = u8g2.getU8g2();
+  uint8_t *frame = u8g2Struct->tile_buf_ptr;
+
+  u8g2Struct->tile_buf_ptr = layer->bitmap;
+  u8g2.setDrawColor(1);
+  u8g2.clearBuffer();
+
+  return frame;
+}
+
+
+// u8g2 draws in the frame again, returns the layer drawn
+static const uint8_t *OLED_Layer_End(s_layer *layer, uint8_t *frame, int32_t key)
+{
+  u8g2.getU8g2()->tile_buf_ptr = frame;
+  layer->key = key;
+
+  return layer->bitmap;
+}
+
+
+// RPM bargraph legend
+static void OLED_Layer_RPM(int xPos, int yPos)
+{
+  char buff[32];
+  float coef = (float)SCREEN_WIDTH / (settings.maxRPM/1000.0);
+
+  u8g2.drawLine(xPos, yPos+18, SCREEN_WIDTH, yPos+18);
+
+  u8g2.setFont( u8g2_font_micro_tr);
+  for(int i = 0; i < ((settings.maxRPM/1000)-1); i++)
+  {
+    u8g2.drawFrame(xPos+((coef*(i+1))+0.5), yPos+8, 1, 2);  // USE FRAME WITH width of 1 to avoid line issues...
+    Format_Int(buff, i+1);
+    u8g2.drawStr( xPos + (coef*(i+1)-1),yPos+17 , buff);          //*1000 rpm numbers
+  }
+
+  for(int i = 0; i < ((settings.maxRPM/1000)+1); i++)
+  {
+    u8g2.drawPixel(xPos + ((coef*i)+0.5+(coef/2)+0.5), yPos+8);    // 500 rpms markers   
+  }
+}
+
+
+// RPM unit, after the 5 digits of OLED_Display_RPM2() (monospace font)
+static void OLED_Layer_RPM2(int xPos, int yPos)
+{
+  u8g2.setFont( u8g2_font_8x13B_tr  );
+  u8g2.drawStr( xPos+5*8, yPos , " rpm");
+}
+
+
+static void OLED_Layer_Speed(int xPos, int yPos)
+{
+  u8g2.setFont( u8g2_font_5x7_tf);
+  u8g2.drawStr( xPos+60, yPos-20 , "km/h");
+}
+
+
+static void OLED_Layer_Speed2(int xPos, int yPos)
+{
   u8g2.setFont( u8g2_font_8x13B_tr  );
   u8g2.drawStr( xPos+90, yPos-26 , "km/h");
 }
 
 
+// Axes and name of a chart of OLED_Display_History()
+static void OLED_Layer_History(int xPos, int yPos, int width, int heigth, const char *chartName)
+{
+  int textWidth = 13;
+
+  u8g2.drawFrame(xPos+textWidth, yPos, 1, heigth);  // USE FRAME WITH width of 1 to avoid line issues...
+  u8g2.drawLine(xPos+textWidth, yPos+heigth, xPos+width, yPos+heigth);
+
+  u8g2.setFont( u8g2_font_micro_tr);
+  u8g2.drawStr( xPos-6, yPos+heigth/2+3 , chartName); 
+}
+
+
+// ORs a layer in the frame, moved down by vOffset pixels (up if negative)
+static void OLED_BlitLayer(const uint8_t *layer, int vOffset)
+{
+  uint8_t *frame = u8g2.getBufferPtr();
+  int pageShift = (vOffset >= 0) ? vOffset / 8 : -((7 - vOffset) / 8);   // Rounded down
+  int bitShift = vOffset - pageShift * 8;
+  const uint8_t *upper, *lower;
+
+  for(int page = 0; page < SCREEN_HEIGHT / 8; page++)
+  {
+    // Layer page moved in this one, and the one above it for the top bits
+    int src = page - pageShift;
+    lower = ((src >= 0) && (src < SCREEN_HEIGHT / 8)) ? &layer[src * SCREEN_WIDTH] : NULL;
+    upper = ((bitShift != 0) && (src >= 1) && (src <= SCREEN_HEIGHT / 8)) ? &layer[(src - 1) * SCREEN_WIDTH] : NULL;
+
+    for(int col = 0; col < SCREEN_WIDTH; col++)
+    {
+      uint8_t bits = 0;
+
+      if(lower != NULL)
+      {
+        bits |= lower[col] << bitShift;
+      }
+      if(upper != NULL)
+      {
+        bits |= upper[col] >> (8 - bitShift);
+      }
+      frame[page * SCREEN_WIDTH + col] |= bits;
+    }
+  }
+}
+
+
 //Displays current trip distance
 static void OLED_Display_TripDistance(int xPos, int yPos)
 {
   char buff[32];
   
   u8g2.setFont( u8g2_font_5x7_tf);//u8g2_font_6x10_tf);
-  sprintf(buff, "Trip %d.%01d", (int)(trip/1000.0), (int)((trip/1000.0)*10.0)%10);  //  dtostrf(speed, 4, 1, buff);
+  Format_Fixed(Format_Str(buff, "Trip "), trip/100, 1);
   u8g2.drawStr( xPos, yPos, buff);
 }
 
@@ -960,7 +1487,7 @@ static void OLED_Display_TotalDistance(int xPos, int yPos)
   char buff[32];
   
   u8g2.setFont( u8g2_font_5x7_tf);//u8g2_font_6x10_tf);
-  sprintf(buff, "Total %d.%01d", (int)total,(int)(total*100)%100);
+  Format_Fixed(Format_Str(buff, "Total "), (int32_t)(total*100), 2);
   u8g2.drawStr( xPos, yPos , buff);
 }
 
@@ -969,16 +1496,19 @@ static void OLED_Display_TotalDistance(int xPos, int yPos)
 static void OLED_Display_Time(int xPos, int yPos)
 {
   char buff[32];
+  char *ptr;
   
   u8g2.setFont( u8g2_font_5x7_tf);
   
-  if(gps.time.isValid())
+  if(gpsFix.timeValid)
   {
-    sprintf( buff, "%02d:%02d ", hour(), minute());
+    ptr = Format_Uint2(buff, hour());
+    *ptr++ = ':';
+    Format_Str(Format_Uint2(ptr, minute()), " ");
   }
   else
   {
-    sprintf( buff, "--:-- ");
+    Format_Str(buff, "--:-- ");
   }
   u8g2.drawStr( xPos, yPos, buff);
 }
@@ -988,13 +1518,13 @@ static void OLED_Display_Altitude(int xPos, int yPos)
 {
   char buff[32];
   
-  if(gps.altitude.isValid())
+  if(gpsFix.altitudeValid)
   {
-    sprintf( buff, "%4dm", (int)gps.altitude.meters());
+    Format_Str(Format_IntPad(buff, gpsFix.altitude / 1000, 4), "m");
   }
   else
   {
-    sprintf( buff, "----m");
+    Format_Str(buff, "----m");
   }
   u8g2.drawStr( xPos, yPos, buff);
 }
@@ -1004,13 +1534,13 @@ static void OLED_Display_Satellites(int xPos, int yPos)
 {
   char buff[32];
   
-  if(gps.satellites.isValid())
+  if(gpsFix.satellitesValid)
   {
-    sprintf( buff, "%d", gps.satellites.value());
+    Format_Int(buff, gpsFix.satellites);
   }
   else
   {
-    sprintf( buff, "-");
+    Format_Str(buff, "-");
   }
   u8g2.drawStr( xPos-22, yPos, buff);
 
@@ -1033,116 +1563,77 @@ static void OLED_Display_Satellites(int xPos, int yPos)
 
 static void OLED_Display_Gear(int xPos, int yPos)
 {
-  char buff[32];
-  
   //Engaged gear display
-  sprintf(buff, "N" );
   u8g2.setFont(u8g2_font_helvB18_tf );//u8g2_font_helvB24_tn  );//u8g2_font_freedoomr25_tn );// u8g2_font_logisoso26_tn  );
-  u8g2.drawStr( xPos, yPos , buff);
+  u8g2.drawStr( xPos, yPos , "N");
 }
 
 
-static void OLED_Display_Track(int xPos, int yPos, int width, int heigth, double *xDataArray, double *yDataArray, int dataSize)
+// Draws the track view bitmap, width - 8 by heigth - 8 pixels (TRACK_VIEW_WIDTH by TRACK_VIEW_HEIGHT),
+// then the segment from the last vertex to the current position
+static void OLED_Display_Track(int xPos, int yPos, int width, int heigth, s_track *track)
 {
-  char buff[32];
-  double xCartesian = 0;
-  double yCartesian = yPos;
+  const s_trackPoint *point = Track_Current(track);
+  int xVertex, yVertex, xCurrent, yCurrent;
   int hMargin = 4, vMargin = 4;
-  double minX= 180, maxX = -180, minY= 90, maxY = -90;
-  double xCoef, yCoef;
 
-  for(int i = 0; i < dataSize; i++)
+  if(point == NULL)
   {
-    if( minY > yDataArray[i])
-    {
-      minY = yDataArray[i];
-    }
-
-    if(maxY < yDataArray[i])
-    {
-      maxY = yDataArray[i];
-    }
-
-    if( minX > xDataArray[i])
-    {
-      minX = xDataArray[i];
-    }
-
-    if( maxX < xDataArray[i])
-    {
-      maxX = xDataArray[i];
-    }
+    return;
   }
-  
-  xCoef = maxX - minX;
-  yCoef = maxY - minY;
 
-  for(int i = 0; i < dataSize; i++)
-  {
-    yCartesian = yPos + heigth - vMargin -((yDataArray[i] - minY) / yCoef * (double)(heigth-(vMargin*2)));
-    xCartesian = xPos + hMargin +(xDataArray[i] - minX) / xCoef * (double)(width-(hMargin*2));
-    
-    /*
-    yCartesian =  SCREEN_HEIGHT - vMargin - ((yDataArray[i] - minY) / yCoef * (double)(SCREEN_HEIGHT-(vMargin*2)));
-    xCartesian =  hMargin + (xDataArray[i] - minX) / xCoef * (double)(SCREEN_WIDTH-(hMargin*2));
-*/
-    u8g2.drawPixel((int)xCartesian, (int)yCartesian);
-  }
+  u8g2.drawXBM(xPos+hMargin, yPos+vMargin, TRACK_VIEW_WIDTH, TRACK_VIEW_HEIGHT, Track_Render(track));
 
-   u8g2.drawDisc((int)xCartesian, (int)yCartesian, 2);
+  Track_Project(track, &track->vertices[track->count-1], &xVertex, &yVertex);
+  Track_Project(track, point, &xCurrent, &yCurrent);
+  u8g2.drawLine(xPos+hMargin+xVertex, yPos+vMargin+yVertex, xPos+hMargin+xCurrent, yPos+vMargin+yCurrent);
+  u8g2.drawDisc(xPos+hMargin+xCurrent, yPos+vMargin+yCurrent, 2);
 }
 
 
-static void OLED_Display_History(int xPos, int yPos, int width, int heigth, int * dataArray, int dataSize, char * chartName)
+// Draws one vertical min - max bar per column, from the history pyramid. Axes and name in the layer, OLED_Layer_Stats()
+static void OLED_Display_History(int xPos, int yPos, int width, int heigth, const s_history *history, e_historyField field)
 {
   char buff[32];
-  int indexCoef;
-  int valCoef;
-  int minVal = 10000, maxVal = 0;
+  s_historyRange range;
   int hMargin = 2, vMargin = 3;
-
   int textWidth = 13;
+  int chartWidth = width-2*hMargin-textWidth;
+  int chartHeigth = heigth-1-2*hMargin;
+  int bottom = yPos+heigth-hMargin-1;
+  int minVal = INT16_MAX, maxVal = INT16_MIN;
+  int valCoef;
+  uint16_t span = History_Span(history, chartWidth);
+  uint16_t columns = History_Columns(history, span);
 
-  // Prepare necessary values for plotting
-  for(int i = 0; i < dataSize; i++)
+  // Scale, from the columns
+  for(int i = 0; i < columns; i++)
   {
-    if(dataArray[i] >= maxVal)
-    {
-      maxVal = dataArray[i];
-    }
-    else if(dataArray[i] <= minVal)
-    {
-      minVal = dataArray[i];
-    }
+    History_Range(history, field, i, span, &range);
+    minVal = min(minVal, (int)range.min);
+    maxVal = max(maxVal, (int)range.max);
   }
-  
-  valCoef = maxVal - minVal;
-  indexCoef = dataSize / (width-2*hMargin-textWidth);
-  
-  if(indexCoef < 1)
+
+  if(columns == 0)
   {
-    indexCoef = 1;
+    minVal = 0;
+    maxVal = 0;
   }
+  valCoef = max(maxVal - minVal, 1);
 
-  // Display chart axis
-  u8g2.drawFrame(xPos+textWidth, yPos, 1, heigth);  // USE FRAME WITH width of 1 to avoid line issues...
-  u8g2.drawLine(xPos+textWidth, yPos+heigth, xPos+width, yPos+heigth);
-  //Serial.print(yPos+heigth);
-   
   // Display Scale
   u8g2.setFont( u8g2_font_micro_tr);
-  sprintf(buff, "%d", (int)maxVal);
+  Format_Int(buff, maxVal);
   u8g2.drawStr( xPos, yPos+7 , buff);  
-  sprintf(buff, "%d", (int)minVal);
+  Format_Int(buff, minVal);
   u8g2.drawStr( xPos, yPos+heigth-1 , buff); 
 
-  // Chart Name
-  sprintf(buff, "%s", chartName); 
-  u8g2.drawStr( xPos-6, yPos+heigth/2+3 , buff); 
-
-  // Plot values
-  for(int i = 0; i < dataSize; i++)//width-1; i++)
+  // Plot values, one column per pixel at most
+  for(int i = 0; i < columns; i++)
   {
-    u8g2.drawPixel(xPos+i/indexCoef+1+hMargin+textWidth, (yPos+heigth-hMargin-1) - ((float)(dataArray[i]-minVal)/(float)valCoef)*(float)(heigth-1-2*hMargin));
+    History_Range(history, field, i, span, &range);
+    u8g2.drawVLine(xPos+i+1+hMargin+textWidth,
+                   bottom - (range.max-minVal)*chartHeigth/valCoef,
+                   (range.max-range.min)*chartHeigth/valCoef + 1);
   } 
 }
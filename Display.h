@@ -49,6 +49,7 @@ typedef enum
   MENU_SETTINGS_BRANDLOGO,
   MENU_SETTINGS_MAINDISPLAYSTYLE,
   MENU_MEMORY_SHOWSIZE,
+  MENU_SETTINGS_RPMPULSES,
 }e_DispState;
 
 
@@ -89,9 +90,20 @@ typedef struct
   const uint8_t * image;
 }s_logo;
 
+
+typedef struct
+{
+  uint32_t  frames;               ///< Frames drawn and sent
+  uint32_t  skipped;              ///< Frames due but not drawn, screen inputs unchanged
+  uint32_t  frameUs;              ///< Sum of the frame times, draw and flush
+  uint32_t  maxFrameUs;
+  uint32_t  maxLateUs;            ///< Longest delay of a frame after its due time
+}s_renderStats;
+
 //---------------------------------------------
 // Public variables
 //---------------------------------------------
+extern s_renderStats renderStats;
 
 
 //---------------------------------------------
@@ -99,6 +111,9 @@ typedef struct
 //---------------------------------------------
 extern void OLED_Init();
 extern void OLED_Handle();
+extern void OLED_Lock();
+extern void OLED_Unlock();
+extern void OLED_PrintStats();
 
 
 #endif
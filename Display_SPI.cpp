@@ -0,0 +1,546 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Display_SPI.cpp
+ * \brief OLED hardware SPI transport
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * The SSD1309 is driven by the VSPI peripheral of the ESP32 instead of
+ * bit-banged pins: PIN_OLED_CLOCK, PIN_OLED_DATA and PIN_OLED_CS are the
+ * VSPI IOMUX pins, PIN_OLED_DC is set by the transaction pre callback.
+ * u8g2 init, contrast and power commands go through Display_SPI_Byte(),
+ * polled.
+ * The DMA buffer keeps the last frame sent. A new frame is compared with it
+ * page by page (128 x 8 pixels), 4 columns at a time: only the changed
+ * column span of each changed page is copied and queued, as an address
+ * window transaction and a pixel transaction. Display_SPI_Flush() returns
+ * while the DMA sends them, and the next frame is drawn in the u8g2 buffer
+ * meanwhile. Only the next flush or command waits for the transfer end.
+ * Called from one task only: setup(), then the render task.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Display_SPI.h"
+#include "Settings.h"
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   DISPLAY_SPI_HOST          VSPI_HOST
+#define   DISPLAY_SPI_QUEUE_SIZE    (2 * DISPLAY_SPI_PAGES)  ///< Window and pixel transactions of each page
+#define   DISPLAY_SPI_SPAN_ALIGN    4         ///< Columns compared and sent together (DMA buffers are word aligned)
+#define   BENCH_OLED_FRAMES         50
+
+//#define DEBUG_DISPLAY_SPI
+#define   DISPLAY_SPI_STATS_PERIOD_MS 10000   ///< Period of the statistics print, with DEBUG_DISPLAY_SPI
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+s_displaySpiStats displaySpiStats;
+
+static spi_device_handle_t spiDevice = NULL;
+static uint8_t dcLevel = 0;                 ///< Level of DC for the next bytes u8x8 sends
+static uint8_t pending = 0;                 ///< Frame transactions queued, not yet returned
+static bool fullFrame = true;               ///< Screen content unknown, next frame sent whole
+static volatile int64_t flushStartUs;
+static volatile int64_t flushEndUs;
+static spi_transaction_t * volatile lastTransaction;  ///< Ends the frame transfer
+
+// Per page: horizontal addressing, window on the page columns to send
+DMA_ATTR static uint8_t windowCommands[DISPLAY_SPI_PAGES][8];
+DMA_ATTR static uint8_t dmaFrame[DISPLAY_SPI_FRAME_SIZE];  ///< Last frame sent
+
+static spi_transaction_t windowTransactions[DISPLAY_SPI_PAGES];
+static spi_transaction_t pixelTransactions[DISPLAY_SPI_PAGES];
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void Display_SPI_Init();
+void Display_SPI_Flush(const uint8_t *frame);
+void Display_SPI_Wait();
+void Display_SPI_PrintStats();
+uint8_t Display_SPI_Byte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t Display_SPI_GpioAndDelay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+void Display_SPI_Benchmark(const uint8_t *frame);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void IRAM_ATTR Display_SPI_PreTransfer(spi_transaction_t *transaction);
+static void IRAM_ATTR Display_SPI_PostTransfer(spi_transaction_t *transaction);
+static bool Display_SPI_Diff(const uint8_t *frame, uint8_t page, uint8_t *first, uint8_t *last);
+#ifdef BENCH_OLED
+static void Display_SPI_Release();
+static void Display_SPI_BitBang(uint8_t dc, const uint8_t *data, size_t len);
+#endif
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn void Display_SPI_Init(void)
+///
+/// \brief Set up the VSPI bus and the OLED device, at OLED_SPI_CLOCK_HZ.
+///        Called by u8g2 begin(), nothing done if already set up.
+/// \param None.
+/// \return None.
+void Display_SPI_Init()
+{
+  spi_bus_config_t bus;
+  spi_device_interface_config_t device;
+
+  if(spiDevice != NULL)
+  {
+    return;
+  }
+
+  memset(&bus, 0, sizeof(bus));
+  bus.mosi_io_num = PIN_OLED_DATA;
+  bus.miso_io_num = -1;
+  bus.sclk_io_num = PIN_OLED_CLOCK;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = DISPLAY_SPI_FRAME_SIZE;
+
+  memset(&device, 0, sizeof(device));
+  device.mode = 0;
+  device.clock_speed_hz = OLED_SPI_CLOCK_HZ;
+  device.spics_io_num = PIN_OLED_CS;
+  device.queue_size = DISPLAY_SPI_QUEUE_SIZE;
+  device.pre_cb = Display_SPI_PreTransfer;
+  device.post_cb = Display_SPI_PostTransfer;
+
+  if((spi_bus_initialize(DISPLAY_SPI_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) ||
+     (spi_bus_add_device(DISPLAY_SPI_HOST, &device, &spiDevice) != ESP_OK))
+  {
+    Serial.println("Display SPI init failed");
+    spiDevice = NULL;
+    return;
+  }
+
+  for(uint8_t page = 0; page < DISPLAY_SPI_PAGES; page++)
+  {
+    uint8_t commands[] = {0x20, 0x00, 0x21, 0x00, 0x7F, 0x22, page, page};
+
+    memcpy(windowCommands[page], commands, sizeof(commands));
+    memset(&windowTransactions[page], 0, sizeof(spi_transaction_t));
+    windowTransactions[page].length = sizeof(commands) * 8;
+    windowTransactions[page].tx_buffer = windowCommands[page];
+    windowTransactions[page].user = (void*)0;
+
+    memset(&pixelTransactions[page], 0, sizeof(spi_transaction_t));
+    pixelTransactions[page].user = (void*)1;
+  }
+
+  fullFrame = true;
+}
+
+
+//---------------------------------------------
+/// \fn void Display_SPI_Flush(const uint8_t *frame)
+///
+/// \brief Send the changes of a frame to the screen, without waiting for
+///        the transfer: they are copied, the caller may draw the next frame
+///        at once. Waits only for the transfer of the previous frame.
+/// \param frame u8g2 full buffer, DISPLAY_SPI_FRAME_SIZE bytes.
+/// \return None.
+void Display_SPI_Flush(const uint8_t *frame)
+{
+  uint32_t startUs = micros();
+  uint32_t blockUs;
+  uint8_t first, last;
+
+  if(spiDevice == NULL)
+  {
+    return;
+  }
+
+  Display_SPI_Wait();
+
+  flushStartUs = esp_timer_get_time();
+  for(uint8_t page = 0; page < DISPLAY_SPI_PAGES; page++)
+  {
+    if(!Display_SPI_Diff(frame, page, &first, &last))
+    {
+      continue;
+    }
+
+    windowCommands[page][3] = first;
+    windowCommands[page][4] = last;
+    pixelTransactions[page].tx_buffer = &dmaFrame[page * DISPLAY_SPI_PAGE_SIZE + first];
+    pixelTransactions[page].length = (last - first + 1) * 8;
+    lastTransaction = &pixelTransactions[page];
+
+    spi_device_queue_trans(spiDevice, &windowTransactions[page], portMAX_DELAY);
+    spi_device_queue_trans(spiDevice, &pixelTransactions[page], portMAX_DELAY);
+    pending += 2;
+    displaySpiStats.bytes += last - first + 1;
+  }
+
+  fullFrame = false;
+  displaySpiStats.flushes++;
+  if(pending == 0)
+  {
+    displaySpiStats.unchanged++;
+  }
+
+  blockUs = micros() - startUs;
+  if(blockUs > displaySpiStats.maxBlockUs)
+  {
+    displaySpiStats.maxBlockUs = blockUs;
+  }
+
+#ifdef DEBUG_DISPLAY_SPI
+  static unsigned long statsMillis = 0;
+  if(millis() - statsMillis >= DISPLAY_SPI_STATS_PERIOD_MS)
+  {
+    statsMillis = millis();
+    Display_SPI_PrintStats();
+  }
+#endif
+}
+
+
+//---------------------------------------------
+/// \fn void Display_SPI_Wait(void)
+///
+/// \brief Wait for the end of the frame transfer in progress, if any.
+/// \param None.
+/// \return None.
+void Display_SPI_Wait()
+{
+  spi_transaction_t *transaction;
+
+  if(pending == 0)
+  {
+    return;
+  }
+
+  displaySpiStats.waits++;
+  while(pending > 0)
+  {
+    spi_device_get_trans_result(spiDevice, &transaction, portMAX_DELAY);
+    pending--;
+  }
+
+  displaySpiStats.lastTransferUs = flushEndUs - flushStartUs;
+  if(displaySpiStats.lastTransferUs > displaySpiStats.maxTransferUs)
+  {
+    displaySpiStats.maxTransferUs = displaySpiStats.lastTransferUs;
+  }
+}
+
+
+//---------------------------------------------
+/// \fn void Display_SPI_PrintStats(void)
+///
+/// \brief Print frame and bus traffic counters on Serial.
+/// \param None.
+/// \return None.
+void Display_SPI_PrintStats()
+{
+  uint32_t flushes = max(displaySpiStats.flushes, (uint32_t)1);
+
+  Serial.printf("Display: %u frames, %u unchanged, %u bytes/frame (%u%% of full frames), %u waits\r\n",
+                displaySpiStats.flushes, displaySpiStats.unchanged, displaySpiStats.bytes / flushes,
+                (uint32_t)((uint64_t)displaySpiStats.bytes * 100 / ((uint64_t)flushes * DISPLAY_SPI_FRAME_SIZE)),
+                displaySpiStats.waits);
+  Serial.printf("- transfer %u us, longest %u us, loop() kept %u us at most\r\n",
+                displaySpiStats.lastTransferUs, displaySpiStats.maxTransferUs, displaySpiStats.maxBlockUs);
+}
+
+
+//---------------------------------------------
+/// \fn uint8_t Display_SPI_Byte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+///
+/// \brief u8x8 byte callback: commands of u8g2 (init, contrast, power save),
+///        sent polled once the frame transfer is over. They may change the
+///        screen memory or addressing: the next frame is sent whole.
+/// \param u8x8 Display.
+/// \param msg U8X8_MSG_BYTE_xxx.
+/// \param arg_int Nb of bytes (SEND), DC level (SET_DC).
+/// \param arg_ptr Bytes (SEND).
+/// \return 1 if the message is handled.
+uint8_t Display_SPI_Byte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  spi_transaction_t transaction;
+
+  (void)u8x8;
+
+  switch(msg)
+  {
+    case U8X8_MSG_BYTE_INIT:
+      Display_SPI_Init();
+      break;
+
+    case U8X8_MSG_BYTE_SET_DC:
+      dcLevel = arg_int;
+      break;
+
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      Display_SPI_Wait();
+      fullFrame = true;
+      break;
+
+    case U8X8_MSG_BYTE_SEND:
+      if(spiDevice == NULL)
+      {
+        break;
+      }
+      memset(&transaction, 0, sizeof(transaction));
+      transaction.length = arg_int * 8;
+      transaction.user = (void*)(uintptr_t)dcLevel;
+      if(arg_int <= sizeof(transaction.tx_data))
+      {
+        transaction.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(transaction.tx_data, arg_ptr, arg_int);
+      }
+      else
+      {
+        transaction.tx_buffer = arg_ptr;
+      }
+      spi_device_polling_transmit(spiDevice, &transaction);
+      break;
+
+    case U8X8_MSG_BYTE_END_TRANSFER:
+      break;
+
+    default:
+      return 0;
+  }
+
+  return 1;
+}
+
+
+//---------------------------------------------
+/// \fn uint8_t Display_SPI_GpioAndDelay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+///
+/// \brief u8x8 GPIO and delay callback: DC and reset pins, CS being driven
+///        by the SPI peripheral.
+/// \param u8x8 Display.
+/// \param msg U8X8_MSG_GPIO_xxx or U8X8_MSG_DELAY_xxx.
+/// \param arg_int Pin level or delay.
+/// \param arg_ptr Not used.
+/// \return 1 if the message is handled.
+uint8_t Display_SPI_GpioAndDelay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  (void)u8x8;
+  (void)arg_ptr;
+
+  switch(msg)
+  {
+    case U8X8_MSG_GPIO_AND_DELAY_INIT:
+      pinMode(PIN_OLED_DC, OUTPUT);
+      pinMode(PIN_OLED_RESET, OUTPUT);
+      digitalWrite(PIN_OLED_RESET, HIGH);
+      break;
+
+    case U8X8_MSG_DELAY_MILLI:
+      delay(arg_int);
+      break;
+
+    case U8X8_MSG_DELAY_10MICRO:
+      delayMicroseconds(arg_int * 10);
+      break;
+
+    case U8X8_MSG_DELAY_100NANO:
+    case U8X8_MSG_DELAY_NANO:
+      break;
+
+    case U8X8_MSG_GPIO_RESET:
+      digitalWrite(PIN_OLED_RESET, arg_int);
+      break;
+
+    default:
+      return 0;
+  }
+
+  return 1;
+}
+
+
+//---------------------------------------------
+/// \fn void Display_SPI_Benchmark(const uint8_t *frame)
+///
+/// \brief Send a frame BENCH_OLED_FRAMES times bit-banged, as the u8g2
+///        software SPI does, then whole with the DMA transport, then with
+///        24 x 16 pixels changing each time (speed digits), and print the
+///        time per frame: time the caller is kept, time to the end of the
+///        transfer, and bytes sent. Built with BENCH_OLED only.
+/// \param frame u8g2 full buffer, sent back at the end.
+/// \return None.
+void Display_SPI_Benchmark(const uint8_t *frame)
+{
+#ifdef BENCH_OLED
+  static const uint8_t fullWindow[] = {0x20, 0x00, 0x21, 0x00, 0x7F, 0x22, 0x00, 0x07};
+  static uint8_t changed[DISPLAY_SPI_FRAME_SIZE];
+  uint32_t bitBangUs, blockUs[2] = {0, 0}, transferUs[2] = {0, 0}, bytes[2];
+  uint32_t startUs;
+
+  Display_SPI_Release();
+
+  pinMode(PIN_OLED_CLOCK, OUTPUT);
+  pinMode(PIN_OLED_DATA, OUTPUT);
+  pinMode(PIN_OLED_CS, OUTPUT);
+  digitalWrite(PIN_OLED_CS, HIGH);
+
+  startUs = micros();
+  for(int i = 0; i < BENCH_OLED_FRAMES; i++)
+  {
+    Display_SPI_BitBang(0, fullWindow, sizeof(fullWindow));
+    Display_SPI_BitBang(1, frame, DISPLAY_SPI_FRAME_SIZE);
+  }
+  bitBangUs = (micros() - startUs) / BENCH_OLED_FRAMES;
+
+  Display_SPI_Init();
+  memcpy(changed, frame, DISPLAY_SPI_FRAME_SIZE);
+
+  for(int pass = 0; pass < 2; pass++)
+  {
+    bytes[pass] = displaySpiStats.bytes;
+    for(int i = 0; i < BENCH_OLED_FRAMES; i++)
+    {
+      if(pass == 0)
+      {
+        fullFrame = true;
+      }
+      else
+      {
+        for(int col = 40; col < 64; col++)
+        {
+          changed[3 * DISPLAY_SPI_PAGE_SIZE + col] ^= i + 1;
+          changed[4 * DISPLAY_SPI_PAGE_SIZE + col] ^= i + 1;
+        }
+      }
+
+      startUs = micros();
+      Display_SPI_Flush(changed);
+      blockUs[pass] += micros() - startUs;
+      Display_SPI_Wait();
+      transferUs[pass] += displaySpiStats.lastTransferUs;
+    }
+    bytes[pass] = displaySpiStats.bytes - bytes[pass];
+  }
+
+  Display_SPI_Flush(frame);
+  Display_SPI_Wait();
+  memset(&displaySpiStats, 0, sizeof(displaySpiStats));
+
+  Serial.printf("OLED flush benchmark, %d frames, SPI clock %u Hz\r\n", BENCH_OLED_FRAMES, OLED_SPI_CLOCK_HZ);
+  Serial.printf("- bit-banged  : %u us/frame, loop() kept all along, %u bytes\r\n", bitBangUs, DISPLAY_SPI_FRAME_SIZE);
+  for(int pass = 0; pass < 2; pass++)
+  {
+    Serial.printf("- DMA %s: %u us/frame transfer, loop() kept %u us, %u bytes\r\n", (pass == 0) ? "full    " : "diff    ",
+                  transferUs[pass] / BENCH_OLED_FRAMES, blockUs[pass] / BENCH_OLED_FRAMES, bytes[pass] / BENCH_OLED_FRAMES);
+  }
+#else
+  (void)frame;
+#endif
+}
+
+
+// Set DC for the transaction, user field: 0 command, 1 data
+static void IRAM_ATTR Display_SPI_PreTransfer(spi_transaction_t *transaction)
+{
+  gpio_set_level((gpio_num_t)PIN_OLED_DC, (uintptr_t)transaction->user);
+}
+
+
+// End of the last pixel transaction closes the frame transfer time
+static void IRAM_ATTR Display_SPI_PostTransfer(spi_transaction_t *transaction)
+{
+  if(transaction == lastTransaction)
+  {
+    flushEndUs = esp_timer_get_time();
+  }
+}
+
+
+// Changed columns of a page, copied to the DMA frame; false if none
+static bool Display_SPI_Diff(const uint8_t *frame, uint8_t page, uint8_t *first, uint8_t *last)
+{
+  const uint8_t *newBytes = &frame[page * DISPLAY_SPI_PAGE_SIZE];
+  uint32_t *sentWords = (uint32_t*)&dmaFrame[page * DISPLAY_SPI_PAGE_SIZE];
+  uint32_t newWord;
+  int firstWord = -1, lastWord = -1;
+
+  for(int i = 0; i < DISPLAY_SPI_PAGE_SIZE / DISPLAY_SPI_SPAN_ALIGN; i++)
+  {
+    memcpy(&newWord, &newBytes[i * DISPLAY_SPI_SPAN_ALIGN], sizeof(newWord));  // u8g2 buffer may not be word aligned
+    if(fullFrame || (newWord != sentWords[i]))
+    {
+      sentWords[i] = newWord;
+      if(firstWord < 0)
+      {
+        firstWord = i;
+      }
+      lastWord = i;
+    }
+  }
+
+  if(firstWord < 0)
+  {
+    return false;
+  }
+
+  *first = firstWord * DISPLAY_SPI_SPAN_ALIGN;
+  *last = (lastWord + 1) * DISPLAY_SPI_SPAN_ALIGN - 1;
+
+  return true;
+}
+
+
+#ifdef BENCH_OLED
+// Give the pins back to the GPIO, Display_SPI_Init() sets the bus up again
+static void Display_SPI_Release()
+{
+  Display_SPI_Wait();
+  spi_bus_remove_device(spiDevice);
+  spi_bus_free(DISPLAY_SPI_HOST);
+  spiDevice = NULL;
+}
+
+
+// Bit-banged SPI mode 0, MSB first, as u8x8_byte_arduino_4wire_sw_spi()
+static void Display_SPI_BitBang(uint8_t dc, const uint8_t *data, size_t len)
+{
+  digitalWrite(PIN_OLED_DC, dc);
+  digitalWrite(PIN_OLED_CS, LOW);
+
+  for(size_t i = 0; i < len; i++)
+  {
+    for(uint8_t mask = 0x80; mask != 0; mask >>= 1)
+    {
+      digitalWrite(PIN_OLED_DATA, (data[i] & mask) ? HIGH : LOW);
+      digitalWrite(PIN_OLED_CLOCK, HIGH);
+      digitalWrite(PIN_OLED_CLOCK, LOW);
+    }
+  }
+
+  digitalWrite(PIN_OLED_CS, HIGH);
+}
+#endif
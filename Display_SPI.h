@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Display_SPI.h
+ * \brief OLED hardware SPI transport header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _DISPLAY_SPI_H
+#define _DISPLAY_SPI_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   DISPLAY_SPI_PAGES         8
+#define   DISPLAY_SPI_PAGE_SIZE     128       ///< Columns of a page, one byte of 8 pixels each
+#define   DISPLAY_SPI_FRAME_SIZE    (DISPLAY_SPI_PAGES * DISPLAY_SPI_PAGE_SIZE)  ///< u8g2 full buffer
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  uint32_t  flushes;              ///< Frames sent
+  uint32_t  unchanged;            ///< Frames identical to the previous one, nothing sent
+  uint32_t  bytes;                ///< Pixel bytes sent, DISPLAY_SPI_FRAME_SIZE per frame without diff
+  uint32_t  waits;                ///< Frames or commands waiting for the previous frame transfer
+  uint32_t  lastTransferUs;       ///< Last frame, queueing to end of the transfer
+  uint32_t  maxTransferUs;
+  uint32_t  maxBlockUs;           ///< Longest time a flush kept the caller
+}s_displaySpiStats;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+extern s_displaySpiStats displaySpiStats;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void Display_SPI_Init();
+extern void Display_SPI_Flush(const uint8_t *frame);
+extern void Display_SPI_Wait();
+extern void Display_SPI_PrintStats();
+extern uint8_t Display_SPI_Byte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+extern uint8_t Display_SPI_GpioAndDelay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+extern void Display_SPI_Benchmark(const uint8_t *frame);
+
+
+//---------------------------------------------
+/// \class U8G2_SSD1309_128X64_NONAME0_F_4W_DMA_SPI
+///
+/// \brief u8g2 SSD1309 full buffer driver on this transport. Draw with it as
+///        with the u8g2 constructors, but send frames with
+///        Display_SPI_Flush(getBufferPtr()) instead of sendBuffer().
+class U8G2_SSD1309_128X64_NONAME0_F_4W_DMA_SPI : public U8G2
+{
+  public:
+    U8G2_SSD1309_128X64_NONAME0_F_4W_DMA_SPI(const u8g2_cb_t *rotation) : U8G2()
+    {
+      u8g2_Setup_ssd1309_128x64_noname0_f(&u8g2, rotation, Display_SPI_Byte, Display_SPI_GpioAndDelay);
+    }
+};
+
+#endif
@@ -6,7 +6,23 @@
  * \author M.Navarro
  * \date 10/2018
  *
- * Uses 
+ * Uses SPIFFS or LittleFS on the internal flash, or an SD card on the HSPI
+ * bus. The backend is chosen by File_Init(): if it cannot be mounted (no
+ * card), the internal FILE_INTERNAL_FS is used instead.
+ * Only FILE_INTERNAL_FS is formatted when it does not mount: SPIFFS and
+ * LittleFS share the same partition, mounting the other one must not erase
+ * the logs.
+ * Sizes are read from the file system once, at mount, along with an index of
+ * the files of the root directory. Writers keep the index up to date
+ * (File_IndexUpdate(), File_IndexRemove()), so used bytes and the file list
+ * are answered from RAM, without walking the directory again.
+ * Past FILE_INDEX_SIZE files, or with a path longer than FILE_NAME_SIZE (an
+ * upload with a long name), the index is incomplete (File_IndexComplete()):
+ * the file list must walk the directory, until a removal lets the index be
+ * built again. Used bytes are still answered from RAM, but the growth of the
+ * files left out is unknown: a write to one of them reads used bytes from
+ * the file system again, once per FILE_USED_REFRESH_MS at most, in the
+ * writer task.
  */
 //-----------------------------------------------------------------------------
 // (c) Copyright MN 2018 - All rights reserved
@@ -17,67 +33,205 @@
 //---------------------------------------------
 #include "FS.h"
 #include "SPIFFS.h"
+#include "LittleFS.h"
+#include "SD.h"
+#include "SPI.h"
 
 #include "File.h"
+#include "Settings.h"
 
 
 //---------------------------------------------
 // Defines
 //---------------------------------------------
 #define   FORMAT_SPIFFS_IF_FAILED true
-#define   SD_CS_pin               5
+#define   FILE_SD_FREQUENCY       20000000  ///< SD card SPI clock, in Hz
+#define   FILE_USED_REFRESH_MS    60000     ///< Shortest time between two used bytes reads, index incomplete
+
+#define   FILE_BENCH_FILE         "/bench.bin"
+#define   FILE_BENCH_RECORD_SIZE  32        ///< One 10 Hz sample of all channels, in bytes
+#define   FILE_BENCH_RECORDS      2000
+#define   FILE_BENCH_FLUSH        10        ///< Records between two flushes, 1 s at 10 Hz
+#define   FILE_BENCH_CHUNK_SIZE   1000      ///< Read size of a download, as the web server chunks
+#define   FILE_BENCH_LISTINGS     10
 
 #define DEBUG_FILE
 
 //---------------------------------------------
 // Variables
 //---------------------------------------------
-bool   SD_present = false;
-
-int File_Init();
-String File_FormatSize(int bytes);
+bool   SD_present = false;                  ///< A file system is mounted, whatever its backend
 
 fs::FS fileSystem = SPIFFS;                 ///< File system to use to read/write file (SPIFFS = internal memory, SD = external SD Card)
+e_fileBackend fileBackend = FILE_BACKEND_NONE;  ///< Backend of fileSystem
+
+// Size index, shared by loop() and the storage task
+static s_fileEntry fileIndex[FILE_INDEX_SIZE];
+static int fileIndexCount = 0;
+static SemaphoreHandle_t fileIndexMutex = NULL;
+static bool fileIndexOverflow = false;      ///< Some files are not indexed
+static int64_t indexBytes = 0;              ///< Sum of indexed file sizes
+static int64_t mountIndexBytes = 0;         ///< indexBytes at mount
+static uint64_t mountUsedBytes = 0;         ///< Used bytes reported by the file system at mount, or at the last refresh
+static unsigned long usedRefreshMillis = 0; ///< Time of the last used bytes read
+static uint64_t mountTotalBytes = 0;
+
+static SPIClass sdSpi(HSPI);                ///< VSPI is the OLED one
+
+static const s_fileBackendInfo backendInfos[] =
+{
+  // name       removable directories powerSafe writeBlock
+  { "none",     false,    false,      false,    256 },
+  { "SPIFFS",   false,    false,      false,    256 },    // Log page
+  { "LittleFS", false,    true,       true,     512 },    // Cache size
+  { "SD",       true,     true,       false,    512 }     // Sector
+};
 
 
 //---------------------------------------------
 // Public Functions
 //---------------------------------------------
-int File_Init();
-String File_FormatSize(int bytes);
+int File_Init(e_fileBackend backend);
+const s_fileBackendInfo *File_Info(e_fileBackend backend);
+void File_PrintInfo();
+void File_Benchmark();
+String File_FormatSize(uint64_t bytes);
 
 int File_Write(fs::FS &fs, const char * path, const char * message);
 int File_Append(fs::FS &fs, const char * path, const char * message);
 int File_Rename(fs::FS &fs, const char * path1, const char * path2);
 int File_Delete(fs::FS &fs, const char * path);
-int File_TotalBytes(fs::FS &fs);
-int File_UsedBytes(fs::FS &fs);
+uint64_t File_TotalBytes();
+uint64_t File_UsedBytes();
 int File_ListDir(fs::FS &fs, const char * dirname, uint8_t levels);
 
+void File_IndexUpdate(const char *path, uint32_t size);
+void File_IndexRemove(const char *path);
+int File_IndexCount();
+bool File_IndexComplete();
+bool File_IndexEntry(int index, s_fileEntry *entry);
+
 //---------------------------------------------
 // Private Functions
 //---------------------------------------------
+static bool File_Mount(e_fileBackend backend);
+static void File_Unmount();
+static void File_IndexBuild();
+static uint64_t File_FileSystemUsedBytes();
+static void File_UsedBytesRefresh();
+static int File_IndexAdd(const char *path, uint32_t size);
+static void File_IndexRename(const char *path1, const char *path2);
+static int File_IndexFind(const char *path);
+#ifdef BENCH_FILE
+static void File_BenchBackend();
+#endif
 
 
 //---------------------------------------------
 // Functions declarations
 //---------------------------------------------
 
-int File_Init()
+//---------------------------------------------
+/// \fn int File_Init(e_fileBackend backend)
+///
+/// \brief Mount a file system as fileSystem, or FILE_INTERNAL_FS if it
+///        fails. May be called again to change the backend, with no file
+///        open.
+/// \param backend Backend wanted, FILE_BACKEND in settings.
+/// \return 1 if a file system is mounted, 0 otherwise.
+int File_Init(e_fileBackend backend)
 {
-  if(!SPIFFS.begin(FORMAT_SPIFFS_IF_FAILED))
+  if(fileIndexMutex == NULL)
+  {
+    fileIndexMutex = xSemaphoreCreateMutex();
+  }
+
+  File_Unmount();
+
+  if(!File_Mount(backend) && ((backend == FILE_INTERNAL_FS) || !File_Mount(FILE_INTERNAL_FS)))
   {
 #ifdef DEBUG_FILE
-    Serial.println("SPIFFS Mount Failed");
+    Serial.println("File system mount failed");
 #endif
 
     return 0;
   }
-  else
+
+#ifdef DEBUG_FILE
+  File_PrintInfo();
+#endif
+
+  return 1;
+}
+
+
+//---------------------------------------------
+/// \fn const s_fileBackendInfo *File_Info(e_fileBackend backend)
+///
+/// \brief Capabilities of a backend.
+/// \param backend Backend, fileBackend for the mounted one.
+/// \return Backend capabilities.
+const s_fileBackendInfo *File_Info(e_fileBackend backend)
+{
+  return &backendInfos[backend];
+}
+
+
+//---------------------------------------------
+/// \fn void File_PrintInfo(void)
+///
+/// \brief Print the mounted backend, its size and capabilities on Serial.
+/// \param None.
+/// \return None.
+void File_PrintInfo()
+{
+  const s_fileBackendInfo *info = File_Info(fileBackend);
+
+  Serial.printf("File system: %s, %s%s%s, write block %u B, size %s\r\n", info->name,
+                info->removable ? "removable" : "internal",
+                info->directories ? ", directories" : "",
+                info->powerSafe ? ", power safe" : "",
+                info->writeBlock, File_FormatSize(File_TotalBytes()).c_str());
+  Serial.printf("- %s used, %d files%s\r\n", File_FormatSize(File_UsedBytes()).c_str(), File_IndexCount(),
+                File_IndexComplete() ? "" : " indexed, index full");
+}
+
+
+//---------------------------------------------
+/// \fn void File_Benchmark(void)
+///
+/// \brief Mount each backend in turn and print its throughput for a 10 Hz
+///        log append, a root directory listing and a download stream, then
+///        mount back the current one. A backend that does not mount without
+///        formatting is reported as not available.
+///        Built with BENCH_FILE only.
+/// \param None.
+/// \return None.
+void File_Benchmark()
+{
+#ifdef BENCH_FILE
+  e_fileBackend current = fileBackend;
+  e_fileBackend backend;
+
+  Serial.printf("File benchmark, %d records of %d B\r\n", FILE_BENCH_RECORDS, FILE_BENCH_RECORD_SIZE);
+
+  for(int i = FILE_BACKEND_SPIFFS; i <= FILE_BACKEND_SD; i++)
   {
-    SD_present = true;
-    return 1;
+    backend = (e_fileBackend)i;
+    File_Unmount();
+
+    if(!File_Mount(backend))
+    {
+      Serial.printf("- %s: not available\r\n", File_Info(backend)->name);
+      continue;
+    }
+
+    File_BenchBackend();
   }
+
+  File_Unmount();
+  File_Mount(current);
+#endif
 }
 
 
@@ -114,6 +268,10 @@ int File_Write(fs::FS &fs, const char * path, const char * message)
     success = 0;
   }
 
+  if(file)
+  {
+    File_IndexUpdate(path, file.size());
+  }
   file.close();
   
   return success;
@@ -154,7 +312,13 @@ int File_Append(fs::FS &fs, const char * path, const char * message)
     success = 0;
   }
 
+  if(file)
+  {
+    File_IndexUpdate(path, file.size());
+  }
   file.close();
+
+  return success;
 }
 
 
@@ -171,6 +335,7 @@ int File_Rename(fs::FS &fs, const char * path1, const char * path2)
 #ifdef DEBUG_FILE
     Serial.println("- file renamed");
 #endif
+    File_IndexRename(path1, path2);
     success = 1;
   }
   else 
@@ -198,6 +363,7 @@ int File_Delete(fs::FS &fs, const char * path)
 #ifdef DEBUG_FILE
     Serial.println("- file deleted");
 #endif
+    File_IndexRemove(path);
     success = 1;
   }
   else
@@ -212,23 +378,159 @@ int File_Delete(fs::FS &fs, const char * path)
 }
 
 
-int File_TotalBytes(fs::FS &fs)
+//---------------------------------------------
+/// \fn uint64_t File_TotalBytes(void)
+///
+/// \brief Size of the mounted file system, read at mount.
+/// \param None.
+/// \return Size, in bytes.
+uint64_t File_TotalBytes()
 {
-  return 4194304;
-  /*
-  FSInfo fs_info;
-  fs.info(fs_info);
-  return fs_info.totalBytes;*/
+  return mountTotalBytes;
 }
 
 
-int File_UsedBytes(fs::FS &fs)
+//---------------------------------------------
+/// \fn uint64_t File_UsedBytes(void)
+///
+/// \brief Used space of the mounted file system: used bytes read at mount,
+///        plus the size changes of the indexed files since. Does not access
+///        the file system.
+/// \param None.
+/// \return Used space, in bytes.
+uint64_t File_UsedBytes()
 {
-  int totalSize = 0;
+  int64_t used;
 
-  totalSize = File_ListDir(fs, "/", 0);
+  if(fileIndexMutex == NULL)
+  {
+    return 0;
+  }
 
-  return totalSize;
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+  used = (int64_t)mountUsedBytes + indexBytes - mountIndexBytes;
+  xSemaphoreGive(fileIndexMutex);
+
+  return constrain(used, (int64_t)0, (int64_t)mountTotalBytes);
+}
+
+
+//---------------------------------------------
+/// \fn void File_IndexUpdate(const char *path, uint32_t size)
+///
+/// \brief Set the size of a file of the index, adding it if needed. To be
+///        called by anything writing a file outside of this module.
+/// \param path Full path, "/name".
+/// \param size New size, in bytes.
+/// \return None.
+void File_IndexUpdate(const char *path, uint32_t size)
+{
+  int index;
+
+  if(fileIndexMutex == NULL)
+  {
+    return;
+  }
+
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+
+  index = File_IndexFind(path);
+  if(index < 0)
+  {
+    index = File_IndexAdd(path, 0);
+  }
+
+  if(index >= 0)
+  {
+    indexBytes += (int64_t)size - fileIndex[index].size;
+    fileIndex[index].size = size;
+  }
+
+  xSemaphoreGive(fileIndexMutex);
+
+  // A file beyond the index still exists, its growth is read from the file system
+  if((index < 0) && (millis() - usedRefreshMillis >= FILE_USED_REFRESH_MS))
+  {
+    File_UsedBytesRefresh();
+  }
+}
+
+
+//---------------------------------------------
+/// \fn void File_IndexRemove(const char *path)
+///
+/// \brief Remove a deleted file from the index.
+/// \param path Full path, "/name".
+/// \return None.
+void File_IndexRemove(const char *path)
+{
+  int index;
+
+  if(fileIndexMutex == NULL)
+  {
+    return;
+  }
+
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+
+  index = File_IndexFind(path);
+  if(index >= 0)
+  {
+    indexBytes -= fileIndex[index].size;
+    fileIndex[index] = fileIndex[--fileIndexCount];
+  }
+
+  xSemaphoreGive(fileIndexMutex);
+
+  // A file left out may fit now
+  if(fileIndexOverflow)
+  {
+    File_IndexBuild();
+  }
+}
+
+
+int File_IndexCount()
+{
+  return fileIndexCount;
+}
+
+
+// False if some files are not in the index: list them from the directory
+bool File_IndexComplete()
+{
+  return !fileIndexOverflow;
+}
+
+
+//---------------------------------------------
+/// \fn bool File_IndexEntry(int index, s_fileEntry *entry)
+///
+/// \brief Copy an entry of the index, to list files without opening the
+///        directory.
+/// \param index Entry, 0 to File_IndexCount() - 1.
+/// \param entry Copy of the entry.
+/// \return false if index is past the last entry.
+bool File_IndexEntry(int index, s_fileEntry *entry)
+{
+  bool found = false;
+
+  if(fileIndexMutex == NULL)
+  {
+    return false;
+  }
+
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+
+  if((index >= 0) && (index < fileIndexCount))
+  {
+    *entry = fileIndex[index];
+    found = true;
+  }
+
+  xSemaphoreGive(fileIndexMutex);
+
+  return found;
 }
 
 
@@ -282,7 +584,7 @@ int File_ListDir(fs::FS &fs, const char * dirname, uint8_t levels)
 
 
 
-String File_FormatSize(int bytes)
+String File_FormatSize(uint64_t bytes)
 {
   String fsize = "";
   
@@ -293,3 +595,301 @@ String File_FormatSize(int bytes)
   
   return fsize;
 }
+
+
+// Mount a backend as fileSystem, only FILE_INTERNAL_FS is formatted if needed
+static bool File_Mount(e_fileBackend backend)
+{
+  bool mounted = false;
+
+  switch(backend)
+  {
+    case FILE_BACKEND_SPIFFS:
+      mounted = SPIFFS.begin(FORMAT_SPIFFS_IF_FAILED && (backend == FILE_INTERNAL_FS));
+      fileSystem = SPIFFS;
+      break;
+
+    case FILE_BACKEND_LITTLEFS:
+      mounted = LittleFS.begin(FORMAT_SPIFFS_IF_FAILED && (backend == FILE_INTERNAL_FS));
+      fileSystem = LittleFS;
+      break;
+
+    case FILE_BACKEND_SD:
+      sdSpi.begin(PIN_SD_CLOCK, PIN_SD_MISO, PIN_SD_MOSI, PIN_SD_CS);
+      mounted = SD.begin(PIN_SD_CS, sdSpi, FILE_SD_FREQUENCY);
+      if(mounted && (SD.cardType() == CARD_NONE))
+      {
+        SD.end();
+        mounted = false;
+      }
+      if(!mounted)
+      {
+        sdSpi.end();
+      }
+      fileSystem = SD;
+      break;
+
+    default:
+      break;
+  }
+
+#ifdef DEBUG_FILE
+  if(!mounted)
+  {
+    Serial.printf("%s mount failed\r\n", File_Info(backend)->name);
+  }
+#endif
+
+  fileBackend = mounted ? backend : FILE_BACKEND_NONE;
+  SD_present = mounted;
+
+  if(mounted)
+  {
+    File_IndexBuild();
+  }
+
+  return mounted;
+}
+
+
+static void File_Unmount()
+{
+  switch(fileBackend)
+  {
+    case FILE_BACKEND_SPIFFS:
+      SPIFFS.end();
+      break;
+
+    case FILE_BACKEND_LITTLEFS:
+      LittleFS.end();
+      break;
+
+    case FILE_BACKEND_SD:
+      SD.end();
+      sdSpi.end();
+      break;
+
+    default:
+      break;
+  }
+
+  fileBackend = FILE_BACKEND_NONE;
+  SD_present = false;
+}
+
+
+// Sizes of the mounted file system and index of the root directory files
+static void File_IndexBuild()
+{
+  File root, file;
+
+  switch(fileBackend)
+  {
+    case FILE_BACKEND_SPIFFS:
+      mountTotalBytes = SPIFFS.totalBytes();
+      break;
+
+    case FILE_BACKEND_LITTLEFS:
+      mountTotalBytes = LittleFS.totalBytes();
+      break;
+
+    case FILE_BACKEND_SD:
+      mountTotalBytes = SD.totalBytes();
+      break;
+
+    default:
+      mountTotalBytes = 0;
+      break;
+  }
+  mountUsedBytes = File_FileSystemUsedBytes();
+  usedRefreshMillis = millis();
+
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+
+  fileIndexCount = 0;
+  fileIndexOverflow = false;
+  indexBytes = 0;
+
+  root = fileSystem.open("/");
+  file = root.openNextFile();
+  while(file && !fileIndexOverflow)
+  {
+    if(!file.isDirectory())
+    {
+      File_IndexAdd(file.path(), file.size());
+    }
+    file = root.openNextFile();
+  }
+  root.close();
+
+  mountIndexBytes = indexBytes;
+
+  xSemaphoreGive(fileIndexMutex);
+}
+
+
+static void File_IndexRename(const char *path1, const char *path2)
+{
+  int index;
+
+  if(fileIndexMutex == NULL)
+  {
+    return;
+  }
+
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+
+  index = File_IndexFind(path1);
+  if((index >= 0) && (strlen(path2) < FILE_NAME_SIZE))
+  {
+    strcpy(fileIndex[index].path, path2);
+  }
+  else if(index >= 0)
+  {
+    // Too long for the index, the file is left out of it. Used bytes unchanged
+    indexBytes -= fileIndex[index].size;
+    mountIndexBytes -= fileIndex[index].size;
+    fileIndex[index] = fileIndex[--fileIndexCount];
+    fileIndexOverflow = true;
+  }
+
+  xSemaphoreGive(fileIndexMutex);
+}
+
+
+// Used bytes reported by the mounted file system, walks it on some backends
+static uint64_t File_FileSystemUsedBytes()
+{
+  switch(fileBackend)
+  {
+    case FILE_BACKEND_SPIFFS:
+      return SPIFFS.usedBytes();
+
+    case FILE_BACKEND_LITTLEFS:
+      return LittleFS.usedBytes();
+
+    case FILE_BACKEND_SD:
+      return SD.usedBytes();
+
+    default:
+      return 0;
+  }
+}
+
+
+// Used bytes read again from the file system, the sizes of the indexed files
+// counted from now. Index mutex not taken, the read may be long
+static void File_UsedBytesRefresh()
+{
+  uint64_t used = File_FileSystemUsedBytes();
+
+  xSemaphoreTake(fileIndexMutex, portMAX_DELAY);
+  mountUsedBytes = used;
+  mountIndexBytes = indexBytes;
+  usedRefreshMillis = millis();
+  xSemaphoreGive(fileIndexMutex);
+}
+
+
+// New entry of the index, -1 if full or if the path is too long, the index
+// is then incomplete. Index mutex taken
+static int File_IndexAdd(const char *path, uint32_t size)
+{
+  if((fileIndexCount >= FILE_INDEX_SIZE) || (strlen(path) >= FILE_NAME_SIZE))
+  {
+    fileIndexOverflow = true;
+    return -1;
+  }
+
+  strcpy(fileIndex[fileIndexCount].path, path);
+  fileIndex[fileIndexCount].size = size;
+  indexBytes += size;
+
+  return fileIndexCount++;
+}
+
+
+// Entry of a path, -1 if not indexed. Index mutex taken
+static int File_IndexFind(const char *path)
+{
+  for(int i = 0; i < fileIndexCount; i++)
+  {
+    if(strcmp(fileIndex[i].path, path) == 0)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+
+#ifdef BENCH_FILE
+// Append, list and stream on the mounted backend
+static void File_BenchBackend()
+{
+  static uint8_t buff[FILE_BENCH_CHUNK_SIZE];
+  uint32_t startUs, callUs, maxUs, appendUs, listUs, readUs;
+  uint32_t bytes = 0;
+  int nbFiles = 0;
+  size_t len;
+  File file, root, entry;
+
+  memset(buff, 0x55, sizeof(buff));
+
+  // Log append: file kept open, flushed every FILE_BENCH_FLUSH records
+  maxUs = 0;
+  startUs = micros();
+  file = fileSystem.open(FILE_BENCH_FILE, FILE_WRITE);
+  for(int i = 0; file && (i < FILE_BENCH_RECORDS); i++)
+  {
+    callUs = micros();
+    file.write(buff, FILE_BENCH_RECORD_SIZE);
+    if((i % FILE_BENCH_FLUSH) == (FILE_BENCH_FLUSH - 1))
+    {
+      file.flush();
+    }
+    callUs = micros() - callUs;
+
+    if(callUs > maxUs)
+    {
+      maxUs = callUs;
+    }
+  }
+  file.close();
+  appendUs = micros() - startUs + 1;
+
+  // Directory listing, as the web server page
+  startUs = micros();
+  for(int i = 0; i < FILE_BENCH_LISTINGS; i++)
+  {
+    nbFiles = 0;
+    root = fileSystem.open("/");
+    entry = root.openNextFile();
+    while(entry)
+    {
+      nbFiles++;
+      entry = root.openNextFile();
+    }
+    root.close();
+  }
+  listUs = (micros() - startUs) / FILE_BENCH_LISTINGS;
+
+  // Download stream
+  startUs = micros();
+  file = fileSystem.open(FILE_BENCH_FILE, FILE_READ);
+  while(file && ((len = file.read(buff, FILE_BENCH_CHUNK_SIZE)) > 0))
+  {
+    bytes += len;
+  }
+  file.close();
+  readUs = micros() - startUs + 1;
+
+  fileSystem.remove(FILE_BENCH_FILE);
+
+  Serial.printf("- %s: append %u KB/s (longest write %u us), list %u files in %u us, stream %u KB/s (%u B)\r\n",
+                File_Info(fileBackend)->name,
+                (uint32_t)(FILE_BENCH_RECORDS * FILE_BENCH_RECORD_SIZE * 1000000ULL / 1024 / appendUs),
+                maxUs, nbFiles, listUs, (uint32_t)(bytes * 1000000ULL / 1024 / readUs), bytes);
+}
+#endif
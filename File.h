@@ -23,11 +23,37 @@
 //---------------------------------------------
 // Defines
 //---------------------------------------------
+#define   FILE_INDEX_SIZE         256       ///< Most files listed in the size index, about 256 rides
+#define   FILE_NAME_SIZE          32        ///< Longest indexed path, terminating 0 included. Trip files are "/YYYYMMDD_hhmmss.trk"
 
 
 //---------------------------------------------
 // Enum, struct, union
 //---------------------------------------------
+typedef enum
+{
+  FILE_BACKEND_NONE = 0,
+  FILE_BACKEND_SPIFFS,                      ///< Internal flash, "spiffs" partition
+  FILE_BACKEND_LITTLEFS,                    ///< Internal flash, same partition, other format
+  FILE_BACKEND_SD                           ///< SD card on the HSPI bus
+}e_fileBackend;
+
+
+typedef struct
+{
+  const char  *name;
+  bool        removable;                    ///< Card may be missing or pulled out
+  bool        directories;                  ///< Real directories, not only '/' in flat names
+  bool        powerSafe;                    ///< File system consistent after a power loss during a write
+  uint16_t    writeBlock;                   ///< Write size and alignment the backend handles best, power of 2
+}s_fileBackendInfo;
+
+
+typedef struct
+{
+  char        path[FILE_NAME_SIZE];         ///< Full path, "/name"
+  uint32_t    size;                         ///< In bytes
+}s_fileEntry;
 
 
 //---------------------------------------------
@@ -41,18 +67,28 @@
 extern bool SD_present;
 
 extern fs::FS fileSystem;
+extern e_fileBackend fileBackend;
 
 //---------------------------------------------
 // Public Functions
 //---------------------------------------------
-extern int File_Init();
-extern String File_FormatSize(int bytes);
+extern int File_Init(e_fileBackend backend);
+extern const s_fileBackendInfo *File_Info(e_fileBackend backend);
+extern void File_PrintInfo();
+extern void File_Benchmark();
+extern String File_FormatSize(uint64_t bytes);
 
 
 extern int File_Write(fs::FS &fs, const char * path, const char * message);
 extern int File_Append(fs::FS &fs, const char * path, const char * message);
 extern int File_Rename(fs::FS &fs, const char * path1, const char * path2);
 extern int File_Delete(fs::FS &fs, const char * path);
-extern int File_TotalBytes(fs::FS &fs);
-extern int File_UsedBytes(fs::FS &fs);
+extern uint64_t File_TotalBytes();
+extern uint64_t File_UsedBytes();
+
+extern void File_IndexUpdate(const char *path, uint32_t size);
+extern void File_IndexRemove(const char *path);
+extern int File_IndexCount();
+extern bool File_IndexComplete();
+extern bool File_IndexEntry(int index, s_fileEntry *entry);
 #endif
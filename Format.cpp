@@ -0,0 +1,311 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Format.cpp
+ * \brief Number to text formatting
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Integer and fixed decimal writers for the display and trip file paths,
+ * in place of sprintf(): no format string parsing, no float, a few bytes of
+ * stack.
+ * Every function writes in a caller buffer, ends the text with 0 and
+ * returns a pointer to that 0, so calls chain to build a line:
+ *   ptr = Format_Str(buff, "Trip ");
+ *   ptr = Format_Fixed(ptr, trip / 100, 1);
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Format.h"
+#include "Settings.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   BENCH_FORMAT_FRAMES       1000
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+char *Format_Str(char *buff, const char *str);
+char *Format_Int(char *buff, int32_t value);
+char *Format_IntPad(char *buff, int32_t value, uint8_t width);
+char *Format_UintPad(char *buff, uint32_t value, uint8_t width, char pad);
+char *Format_Fixed(char *buff, int32_t value, uint8_t decimals);
+void Format_Benchmark();
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+#ifdef BENCH_FORMAT
+static uint32_t Format_BenchSprintf(int frame);
+static uint32_t Format_BenchFormat(int frame);
+#endif
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn char *Format_Str(char *buff, const char *str)
+///
+/// \brief Copy a string.
+/// \param buff Destination.
+/// \param str String to copy.
+/// \return End of the text written (terminating 0).
+char *Format_Str(char *buff, const char *str)
+{
+  while(*str != '\0')
+  {
+    *buff++ = *str++;
+  }
+  *buff = '\0';
+
+  return buff;
+}
+
+
+//---------------------------------------------
+/// \fn char *Format_Int(char *buff, int32_t value)
+///
+/// \brief Write a signed integer, as "%d".
+/// \param buff Destination, FORMAT_INT_SIZE bytes.
+/// \param value Value to write.
+/// \return End of the text written (terminating 0).
+char *Format_Int(char *buff, int32_t value)
+{
+  return Format_IntPad(buff, value, 0);
+}
+
+
+//---------------------------------------------
+/// \fn char *Format_IntPad(char *buff, int32_t value, uint8_t width)
+///
+/// \brief Write a signed integer right aligned on width characters, sign
+///        included, as "%4d".
+/// \param buff Destination, max(width, FORMAT_INT_SIZE - 1) + 1 bytes.
+/// \param value Value to write.
+/// \param width Min nb of characters, 0 for none.
+/// \return End of the text written (terminating 0).
+char *Format_IntPad(char *buff, int32_t value, uint8_t width)
+{
+  uint32_t absValue = (value < 0) ? -(uint32_t)value : value;
+  char digits[FORMAT_INT_SIZE];
+  int len = 0;
+
+  do
+  {
+    digits[len++] = '0' + absValue % 10;
+    absValue /= 10;
+  }while(absValue != 0);
+
+  if(value < 0)
+  {
+    digits[len++] = '-';
+  }
+
+  while(width > len)
+  {
+    *buff++ = ' ';
+    width--;
+  }
+
+  while(len > 0)
+  {
+    *buff++ = digits[--len];
+  }
+  *buff = '\0';
+
+  return buff;
+}
+
+
+//---------------------------------------------
+/// \fn char *Format_UintPad(char *buff, uint32_t value, uint8_t width, char pad)
+///
+/// \brief Write an unsigned integer right aligned on width characters, as
+///        "%5u" (pad ' ') or "%07u" (pad '0').
+/// \param buff Destination, max(width, 10) + 1 bytes.
+/// \param value Value to write.
+/// \param width Min nb of characters, 0 for none.
+/// \param pad Character filling up to width.
+/// \return End of the text written (terminating 0).
+char *Format_UintPad(char *buff, uint32_t value, uint8_t width, char pad)
+{
+  char digits[10];
+  int len = 0;
+
+  do
+  {
+    digits[len++] = '0' + value % 10;
+    value /= 10;
+  }while(value != 0);
+
+  while(width > len)
+  {
+    *buff++ = pad;
+    width--;
+  }
+
+  while(len > 0)
+  {
+    *buff++ = digits[--len];
+  }
+  *buff = '\0';
+
+  return buff;
+}
+
+
+//---------------------------------------------
+/// \fn char *Format_Fixed(char *buff, int32_t value, uint8_t decimals)
+///
+/// \brief Write a fixed point number: value 12345 with 1 decimal is
+///        "1234.5", -5 with 2 decimals is "-0.05".
+/// \param buff Destination, FORMAT_INT_SIZE + 2 bytes.
+/// \param value Value, in 10^-decimals units.
+/// \param decimals Nb of decimals, 0 to 9.
+/// \return End of the text written (terminating 0).
+char *Format_Fixed(char *buff, int32_t value, uint8_t decimals)
+{
+  uint32_t absValue = (value < 0) ? -(uint32_t)value : value;
+  uint32_t scale = 1;
+
+  for(int i = 0; i < decimals; i++)
+  {
+    scale *= 10;
+  }
+
+  if(value < 0)
+  {
+    *buff++ = '-';
+  }
+
+  buff = Format_UintPad(buff, absValue / scale, 0, '0');
+
+  if(decimals > 0)
+  {
+    *buff++ = '.';
+    buff = Format_UintPad(buff, absValue % scale, decimals, '0');
+  }
+
+  return buff;
+}
+
+
+//---------------------------------------------
+/// \fn void Format_Benchmark(void)
+///
+/// \brief Format the texts of a main screen frame (rpm legend and value,
+///        speed, trip, total, time, altitude, satellites, chart scales)
+///        with sprintf() and with this module, and print the CPU cycles per
+///        frame of both. Built with BENCH_FORMAT only.
+/// \param None.
+/// \return None.
+void Format_Benchmark()
+{
+#ifdef BENCH_FORMAT
+  uint32_t sprintfCycles = 0;
+  uint32_t formatCycles = 0;
+  uint32_t check = 0;
+
+  for(int frame = 0; frame < BENCH_FORMAT_FRAMES; frame++)
+  {
+    uint32_t startCycles = ESP.getCycleCount();
+    check += Format_BenchSprintf(frame);
+    sprintfCycles += ESP.getCycleCount() - startCycles;
+
+    startCycles = ESP.getCycleCount();
+    check -= Format_BenchFormat(frame);
+    formatCycles += ESP.getCycleCount() - startCycles;
+  }
+
+  Serial.printf("Format benchmark, %d frames\r\n", BENCH_FORMAT_FRAMES);
+  Serial.printf("- sprintf: %u cycles/frame\r\n", sprintfCycles / BENCH_FORMAT_FRAMES);
+  Serial.printf("- Format : %u cycles/frame, %u saved %s\r\n", formatCycles / BENCH_FORMAT_FRAMES,
+                (sprintfCycles - formatCycles) / BENCH_FORMAT_FRAMES, (check == 0) ? "OK" : "FAIL, texts differ");
+#endif
+}
+
+
+#ifdef BENCH_FORMAT
+// Texts of a frame, returns the sum of their lengths
+static uint32_t Format_BenchSprintf(int frame)
+{
+  char buff[32];
+  uint32_t len = 0;
+  int32_t rpmValue = (frame * 37) % 12000;
+  uint32_t tripValue = frame * 13;
+  double totalValue = 12345.6 + frame;
+
+  for(int i = 0; i < 14; i++)
+  {
+    len += sprintf(buff, "%d", i+1);
+  }
+  len += sprintf(buff, "%5d rpm", rpmValue);
+  len += sprintf(buff, "%d", frame % 130);
+  len += sprintf(buff, "Trip %d.%01d", (int)(tripValue/1000), (int)(tripValue/100)%10);
+  len += sprintf(buff, "Total %d.%02d", (int)totalValue, (int)(totalValue*100)%100);
+  len += sprintf(buff, "%02d:%02d ", frame % 24, frame % 60);
+  len += sprintf(buff, "%4dm", frame % 3000);
+  len += sprintf(buff, "%d", frame % 20);
+  len += sprintf(buff, "%d", 250 + frame % 1000);
+  len += sprintf(buff, "%d", 200 - frame % 500);
+
+  return len;
+}
+
+
+static uint32_t Format_BenchFormat(int frame)
+{
+  char buff[32];
+  char *ptr;
+  uint32_t len = 0;
+  int32_t rpmValue = (frame * 37) % 12000;
+  uint32_t tripValue = frame * 13;
+  double totalValue = 12345.6 + frame;
+
+  for(int i = 0; i < 14; i++)
+  {
+    len += Format_Int(buff, i+1) - buff;
+  }
+  ptr = Format_IntPad(buff, rpmValue, 5);
+  len += Format_Str(ptr, " rpm") - buff;
+  len += Format_Int(buff, frame % 130) - buff;
+  ptr = Format_Str(buff, "Trip ");
+  len += Format_Fixed(ptr, tripValue / 100, 1) - buff;
+  ptr = Format_Str(buff, "Total ");
+  len += Format_Fixed(ptr, (int32_t)(totalValue * 100), 2) - buff;
+  ptr = Format_Uint2(buff, frame % 24);
+  *ptr++ = ':';
+  ptr = Format_Uint2(ptr, frame % 60);
+  len += Format_Str(ptr, " ") - buff;
+  ptr = Format_IntPad(buff, frame % 3000, 4);
+  len += Format_Str(ptr, "m") - buff;
+  len += Format_Int(buff, frame % 20) - buff;
+  len += Format_Int(buff, 250 + frame % 1000) - buff;
+  len += Format_Int(buff, 200 - frame % 500) - buff;
+
+  return len;
+}
+#endif
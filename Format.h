@@ -0,0 +1,71 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Format.h
+ * \brief Number to text formatting header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _FORMAT_H
+#define _FORMAT_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   FORMAT_INT_SIZE           12        ///< Longest int32 text, sign and terminating 0 included
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern char *Format_Str(char *buff, const char *str);
+extern char *Format_Int(char *buff, int32_t value);
+extern char *Format_IntPad(char *buff, int32_t value, uint8_t width);
+extern char *Format_UintPad(char *buff, uint32_t value, uint8_t width, char pad);
+extern char *Format_Fixed(char *buff, int32_t value, uint8_t decimals);
+extern void Format_Benchmark();
+
+
+//---------------------------------------------
+/// \fn char *Format_Uint2(char *buff, uint32_t value)
+///
+/// \brief Write a value of 0 to 99 on 2 digits (clock, date). Inlined width
+///        2 case of Format_UintPad().
+/// \param buff Destination, 3 bytes.
+/// \param value Value to write.
+/// \return End of the text written (terminating 0).
+static inline char *Format_Uint2(char *buff, uint32_t value)
+{
+  buff[0] = '0' + value / 10;
+  buff[1] = '0' + value % 10;
+  buff[2] = '\0';
+
+  return &buff[2];
+}
+
+#endif
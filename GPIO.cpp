@@ -40,7 +40,8 @@ struct S_Button
   long         lastDebounceTime;
   bool         lastState;
   bool         state;
-  bool         clicked;
+  bool         clicked;       ///< Set by GPIO_Handle()
+  bool         latched;       ///< Click of the frame, read by GPIO_IsButtonClicked()
 };
 
 
@@ -60,6 +61,8 @@ void GPIO_Handle();
 
 bool GPIO_IsButtonPressed(int buttonIndex);
 bool GPIO_IsButtonClicked(int buttonIndex);
+bool GPIO_IsButtonEvent();
+void GPIO_LatchButtons();
 
 /*
 void GPIO_LedToggle();
@@ -119,7 +122,7 @@ bool GPIO_IsButtonPressed(int buttonIndex)
 {
   if(buttonIndex < NB_OF_BUTTONS)
   {    
-    Buttons[buttonIndex].clicked = false;
+    Buttons[buttonIndex].latched = false;
     return !Buttons[buttonIndex].state;
   }
   else
@@ -133,9 +136,9 @@ bool GPIO_IsButtonClicked(int buttonIndex)
 {
   if(buttonIndex < NB_OF_BUTTONS)
   {
-    if(Buttons[buttonIndex].clicked)
+    if(Buttons[buttonIndex].latched)
     {
-      Buttons[buttonIndex].clicked = false;
+      Buttons[buttonIndex].latched = false;
       return true;
     }
     else
@@ -150,6 +153,33 @@ bool GPIO_IsButtonClicked(int buttonIndex)
 }
 
 
+// True if a click waits for the next GPIO_LatchButtons(), without taking it
+bool GPIO_IsButtonEvent()
+{
+  for(int i = 0; i < NB_OF_BUTTONS; i++)
+  {
+    if(Buttons[i].clicked)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+// Clicks since the last call become the ones GPIO_IsButtonClicked() returns,
+// the ones not read since the last call are dropped. Called once per frame
+void GPIO_LatchButtons()
+{
+  for(int i = 0; i < NB_OF_BUTTONS; i++)
+  {
+    Buttons[i].latched = Buttons[i].clicked;
+    Buttons[i].clicked = false;
+  }
+}
+
+
 /*
 void GPIO_LedToggle()
 {
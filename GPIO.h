@@ -52,6 +52,8 @@ extern void GPIO_Handle();
 
 extern bool GPIO_IsButtonPressed(int buttonIndex);
 extern bool GPIO_IsButtonClicked(int buttonIndex);
+extern bool GPIO_IsButtonEvent();
+extern void GPIO_LatchButtons();
 /*extern void GPIO_LedToggle();
 extern void GPIO_LedSet(bool state);*/
 
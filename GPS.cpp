@@ -7,9 +7,8 @@
  * \date 10/2018
  *
  * Original GPS Module used: vk2828u7g5lf
- * Wired on hardware serial port, talking @ 921600bds
- * RPM signal must be wired to an pin; Computation then done by interrupt, 
- * counting time period of each rev of the engine.
+ * Wired on hardware serial port, talking @ 921600bds. Bytes are parsed by the
+ * ingest task (see GPS_Ingest.cpp), this file only works on the published fix.
  */
 //-----------------------------------------------------------------------------
 // (c) Copyright MN 2018 - All rights reserved
@@ -20,25 +19,30 @@
 // Include 
 //---------------------------------------------
 #include "GPS.h"
+#include "Odometer.h"
 #include "File.h"
+#include "Storage.h"
+#include "RPM.h"
 #include "GPIO.h"
 #include "Settings.h"
-#include <HardwareSerial.h>
 
 
 //---------------------------------------------
 // Defines
 //---------------------------------------------
-#define   GPS_SPEED_THRSLD      2.0       ///< min speed to compute trip distance (in km/h)
-
-#define   FILTER_PERIOD_MS      1
-#define   CYCLE_PERIOD_MS       1
+#define   GPS_SPEED_THRSLD      556       ///< min speed to compute trip distance (in mm/s, 2 km/h)
 
 #define   GPS_TIMER_PERIOD_US   1000000   ///< Timer interrupt period; at each interrupt, log GPS data
 
 #define   TRIP_RECORD_DELAY_MS  20000     ///< Delay after fist fix to start data record (in ms)
+#define   TRIP_END_DELAY_MS     300000    ///< Time without a new location that ends the trip (in ms)
+
+#define   GPS_TIME_ZONE_S       3600      ///< Local time offset from the GPS (UTC) time, in s
 
-#define   GPS_CHECK_PERIOD_MS   1000      ///< Process count of bytes received from GPS at this period, to check if connected
+#define   LOCATION_HISTORY_SIZE (HISTORY_BUDGET_BYTES / (sizeof(s_historyPoint) + sizeof(s_historyNode) / 4)) ///< Points of gpsHistory, pyramid included
+
+//#define DEBUG_GPS_PROCESS
+#define   GPS_STATS_PERIOD_MS   5000      ///< Period of the GPS_Process() statistics print, with DEBUG_GPS_PROCESS
 
 
 //---------------------------------------------
@@ -49,39 +53,37 @@
 //---------------------------------------------
 // Variables
 //---------------------------------------------
-double previousLatitude;
-double previousLongitude;
+s_odometer tripOdometer;    ///< Trip distance accumulator, fed with each new location
+uint32_t lastLocationCount; ///< gpsFix.locationCount of the last location given to tripOdometer
 
-static const uint32_t GPSBaud = 921600;
-HardwareSerial GPS_Serial(1);
-TinyGPSPlus gps;
-  
-float rpm;
+e_gpsPhase gpsPhase = GPS_PHASE_NO_FIX;
+s_gpsProcessStats gpsProcessStats;
+uint32_t lastFixUpdates;    ///< GPS_Ingest_Updates() value of the last fix processed
+
+s_gpsFix gpsFix;            ///< Copy of the last fix published by the ingest task, refreshed by GPS_Process()
   
-double trip = 0.0;
+uint32_t trip = 0;          ///< Trip distance, in meters
 double total = 12345.6;
 
 portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
 
-volatile int interruptCounter = 0;
-volatile int rpmCounter = 0;
-volatile long microsRPM = 9999;
 volatile bool recordISRappened = false;
 
 bool firstFixDone = false;
 bool recordTrip = false;
 long firstFixMillis = 0;    ///< time in ms at which fix has been done
+long lastLocationMillis = 0;  ///< time in ms of the last new location while recording
 
-char filename[32]; 
-
-// For external RPM interrupt
-portMUX_TYPE extISRmux = portMUX_INITIALIZER_UNLOCKED;
+char filename[STORAGE_PATH_SIZE]; 
 
-// Timer interrupt, te refresh rpm value
+// Timer interrupt, to record a point of the trip
 hw_timer_t * gpsTimer = NULL;
 portMUX_TYPE gpsTimerMux = portMUX_INITIALIZER_UNLOCKED;
 
-gpsHistory_str gpsHistory;
+s_history gpsHistory;                               ///< Ride points of the track and stats screens
+static s_historyPoint historyPoints[LOCATION_HISTORY_SIZE];
+static s_historyNode historyNodes[HISTORY_NODES(LOCATION_HISTORY_SIZE)];
+s_track gpsTrack;                                   ///< Simplified ride of the track screen
 
 
 //---------------------------------------------
@@ -89,12 +91,19 @@ gpsHistory_str gpsHistory;
 //---------------------------------------------
 void GPS_Init();
 void GPS_Process();
-void GPS_Delay(unsigned long ms);
+void GPS_PrintProcessStats();
 
 
 //---------------------------------------------
 // Private Functions
 //---------------------------------------------
+static e_gpsPhase GPS_Phase_NoFix();
+static e_gpsPhase GPS_Phase_FixAcquired();
+static e_gpsPhase GPS_Phase_Warmup();
+static e_gpsPhase GPS_Phase_Recording();
+static void GPS_UpdateTrip();
+static void GPS_RecordPoint();
+static uint32_t GPS_FixTime();
 
 
 //---------------------------------------------
@@ -102,16 +111,6 @@ void GPS_Delay(unsigned long ms);
 //---------------------------------------------
 
  
-void IRAM_ATTR externalISR() 
-{
-  portENTER_CRITICAL_ISR(&extISRmux);
-  interruptCounter++;  
-  rpmCounter = micros() - microsRPM;
-  microsRPM = micros();
-  portEXIT_CRITICAL_ISR(&extISRmux);
-}
-
-
 void IRAM_ATTR gpsTimerISR() 
 {  
   portENTER_CRITICAL_ISR(&gpsTimerMux);
@@ -151,11 +150,13 @@ void IRAM_ATTR gpsTimerISR()
 /// \return None.
 void GPS_Init()
 {
-  GPS_Serial.begin(GPSBaud, SERIAL_8N1, 16, 17);
+  History_Init(&gpsHistory, historyPoints, historyNodes, LOCATION_HISTORY_SIZE, HISTORY_MODE);
+  Track_Clear(&gpsTrack);
+
+#ifndef GPS_REPLAY_FILE
+  GPS_Ingest_Init();
+#endif
 
-  pinMode(PIN_RPM_INPUT, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(PIN_RPM_INPUT), externalISR, FALLING);
-  
   gpsTimer = timerBegin(0, 80, true);
   timerAttachInterrupt(gpsTimer, &gpsTimerISR, true);
   timerAlarmWrite(gpsTimer, GPS_TIMER_PERIOD_US, true);
@@ -163,108 +164,250 @@ void GPS_Init()
 }
 
 
+//---------------------------------------------
+/// \fn void GPS_Process(void)
+///
+/// \brief Run the GPS phase machine. Called at each loop, but only works when
+///        the ingest task published a new fix or a point must be recorded.
+/// \param None.
+/// \return None.
 void GPS_Process()
 {
-  char buff[64];
-  int toto = random(9000);
-  rpm =  rpm * ((float)FILTER_PERIOD_MS / ((float)CYCLE_PERIOD_MS + (float)FILTER_PERIOD_MS)) +  toto * ((float)CYCLE_PERIOD_MS / ((float)CYCLE_PERIOD_MS + (float)FILTER_PERIOD_MS));
+  uint32_t startCycles = ESP.getCycleCount();
+  uint32_t updates;
+  uint32_t cycles;
+  e_gpsPhase phase;
 
-  // If count on period
-  //rpm = (rpmCounter * 1000000.0 / RPM_TIMER_PERIOD_US) * 60.0;
+  gpsProcessStats.calls++;
 
-  // If measure period for each rpm
-  //rpm = (1000000.0/rpmCounter) * 60.0;
+  updates = GPS_Ingest_Updates();
 
-  // Wait everything ok to consider fix done
-  if(!firstFixDone)
+  if((updates == lastFixUpdates) && !recordISRappened)
   {
-     if( gps.location.isValid() && gps.date.isValid()  && gps.time.isValid()     
-      && gps.altitude.isValid() && gps.speed.isValid() && gps.satellites.isValid())
-    {
-      firstFixDone = true;
+    gpsProcessStats.idleCalls++;
+    gpsProcessStats.idleCycles += ESP.getCycleCount() - startCycles;
+    return;
+  }
 
-      // First location
-      previousLatitude  = gps.location.lat();
-      previousLongitude = gps.location.lng();
+  lastFixUpdates = updates;
+  GPS_Ingest_GetFix(&gpsFix);
 
-      // Set Time from GPS data string. Will be then updated by ESP32 RTC functions
-      setTime(gps.time.hour(), gps.time.minute(), gps.time.second(), gps.date.day(), gps.date.month(), gps.date.year());
-      // Calc current Time Zone time by offset value
-      adjustTime(1 * 3600);   
-      
-      firstFixMillis = millis();
+  // A phase may hand over to the next one within the same call
+  do
+  {
+    phase = gpsPhase;
+    gpsProcessStats.phaseRuns[phase]++;
+
+    switch(phase)
+    {
+      case GPS_PHASE_NO_FIX:        gpsPhase = GPS_Phase_NoFix();       break;
+      case GPS_PHASE_FIX_ACQUIRED:  gpsPhase = GPS_Phase_FixAcquired(); break;
+      case GPS_PHASE_WARMUP:        gpsPhase = GPS_Phase_Warmup();      break;
+      case GPS_PHASE_RECORDING:     gpsPhase = GPS_Phase_Recording();   break;
+      default:                      gpsPhase = GPS_PHASE_NO_FIX;        break;
     }
+  }while(gpsPhase != phase);
+
+  cycles = ESP.getCycleCount() - startCycles;
+  gpsProcessStats.busyCycles += cycles;
+  if(cycles > gpsProcessStats.maxCycles)
+  {
+    gpsProcessStats.maxCycles = cycles;
   }
 
-  if(!recordTrip)
+#ifdef DEBUG_GPS_PROCESS
+  static unsigned long statsMillis = 0;
+  if(millis() - statsMillis >= GPS_STATS_PERIOD_MS)
   {
-    if(firstFixDone && (millis() >= (firstFixMillis + TRIP_RECORD_DELAY_MS)) )
-    {
-      recordTrip = true;
-      
-      // Creates File to log GPS Data
-      sprintf( filename, "/%04d%02d%02d_%02d%02d%002d.csv", year(), month(), day(), hour(), minute(), second());
-    
-      // = String(year()) + String(month()) +  String(day()) + "_"+ String(hour()) + String(minute()) + String(second()) +".csv";
-      Serial.print(filename);
-      File_Write( fileSystem, filename, "sep=,\n");
-      File_Append(fileSystem, filename, "Latitude, Longitude, Altitude, Speed\n");
-    }
+    statsMillis = millis();
+    GPS_PrintProcessStats();
   }
+#endif
+}
 
-  if(recordISRappened)
+
+//---------------------------------------------
+/// \fn void GPS_PrintProcessStats(void)
+///
+/// \brief Print GPS_Process() phase counters and cycles on Serial.
+/// \param None.
+/// \return None.
+void GPS_PrintProcessStats()
+{
+  uint32_t busyCalls = gpsProcessStats.calls - gpsProcessStats.idleCalls;
+
+  Serial.printf("GPS_Process: %u calls, %u idle (%u cycles avg), %u busy (%u cycles avg, %u max)\r\n",
+                gpsProcessStats.calls,
+                gpsProcessStats.idleCalls, (uint32_t)(gpsProcessStats.idleCycles / max(gpsProcessStats.idleCalls, (uint32_t)1)),
+                busyCalls, (uint32_t)(gpsProcessStats.busyCycles / max(busyCalls, (uint32_t)1)), gpsProcessStats.maxCycles);
+  Serial.printf("- phase runs: no fix %u, fix acquired %u, warmup %u, recording %u\r\n",
+                gpsProcessStats.phaseRuns[GPS_PHASE_NO_FIX], gpsProcessStats.phaseRuns[GPS_PHASE_FIX_ACQUIRED],
+                gpsProcessStats.phaseRuns[GPS_PHASE_WARMUP], gpsProcessStats.phaseRuns[GPS_PHASE_RECORDING]);
+  Serial.printf("- trip file open failures %u, close failures %u\r\n",
+                gpsProcessStats.tripOpenFailures, gpsProcessStats.tripCloseFailures);
+}
+
+
+// Wait everything ok to consider fix done. After a trip, a new location is
+// needed too: the last fix may still be the one that ended it
+static e_gpsPhase GPS_Phase_NoFix()
+{
+  if( gpsFix.locationValid && gpsFix.dateValid  && gpsFix.timeValid
+   && gpsFix.altitudeValid && gpsFix.speedValid && gpsFix.satellitesValid
+   && (gpsFix.locationCount != lastLocationCount))
   {
-    gpsHistory.lat[gpsHistory.pointsIndex] = gps.location.lat();
-    gpsHistory.lng[gpsHistory.pointsIndex] = gps.location.lng();
-    
-    gpsHistory.spd[gpsHistory.pointsIndex] = gps.speed.kmph();
-    gpsHistory.alt[gpsHistory.pointsIndex] = gps.altitude.meters(); 
+    return GPS_PHASE_FIX_ACQUIRED;
+  }
 
-    sprintf( buff, "%f, %f, %d, %d\n", gps.location.lat(), gps.location.lng(), (int)gps.altitude.meters(), (int)gps.speed.kmph());
-    File_Append(fileSystem, filename, buff);
-    recordISRappened = false;
-    gpsHistory.pointsIndex++;
+  return GPS_PHASE_NO_FIX;
+}
+
+
+// Done once, on first fix
+static e_gpsPhase GPS_Phase_FixAcquired()
+{
+  firstFixDone = true;
+
+  // First location
+  ODO_Reset(&tripOdometer);
+  ODO_Add(&tripOdometer, gpsFix.lat, gpsFix.lng);
+  lastLocationCount = gpsFix.locationCount;
+
+  // Set Time from GPS data string. Will be then updated by ESP32 RTC functions
+  setTime(gpsFix.hour, gpsFix.minute, gpsFix.second, gpsFix.day, gpsFix.month, gpsFix.year);
+  // Calc current Time Zone time by offset value
+  adjustTime(GPS_TIME_ZONE_S);
+
+  firstFixMillis = millis();
+
+  return GPS_PHASE_WARMUP;
+}
+
+
+// Trip distance already counts, record starts after TRIP_RECORD_DELAY_MS
+static e_gpsPhase GPS_Phase_Warmup()
+{
+  GPS_UpdateTrip();
+
+  if(millis() - firstFixMillis < TRIP_RECORD_DELAY_MS)
+  {
+    return GPS_PHASE_WARMUP;
   }
 
-  // Trip distance computation; add elapsed distance since previous point
-  if(gps.location.isValid())
+  // Creates File to log GPS Data
+  sprintf( filename, "/%04d%02d%02d_%02d%02d%02d" TRIPFILE_EXT, year(), month(), day(), hour(), minute(), second());
+
+  // Storage queue full: tried again at the next call, nothing recorded until then
+  if(!Storage_OpenTrip(filename, GPS_FixTime(), GPS_TIME_ZONE_S))
   {
-    if(gps.speed.kmph() >= GPS_SPEED_THRSLD) // Only compute if speed considered as not null
-    {
-       trip += gps.distanceBetween( gps.location.lat(), gps.location.lng(), previousLatitude, previousLongitude);
-       previousLatitude = gps.location.lat();
-       previousLongitude = gps.location.lng();
-    }
+    gpsProcessStats.tripOpenFailures++;
+    return GPS_PHASE_WARMUP;
   }
+
+  Serial.print(filename);
+
+  // Screens show the trip being recorded
+  Track_Clear(&gpsTrack);
+  History_Clear(&gpsHistory);
+
+  recordTrip = true;
+  lastLocationMillis = millis();
+
+  return GPS_PHASE_RECORDING;
 }
-  
 
-// This custom version of delay() ensures that the gps object
-// is being "fed".
-void GPS_Delay(unsigned long ms)
+
+// Points logged until no new location came for TRIP_END_DELAY_MS: the trip
+// file is then closed, and the next fix starts a new trip
+static e_gpsPhase GPS_Phase_Recording()
 {
-  static long checkDataTime;
-  unsigned long start = millis();
-  
-  do 
+  uint32_t locationCount = lastLocationCount;
+
+  GPS_UpdateTrip();
+
+  if(lastLocationCount != locationCount)
+  {
+    lastLocationMillis = millis();
+  }
+  else if(millis() - lastLocationMillis >= TRIP_END_DELAY_MS)
   {
-    while (GPS_Serial.available())
+    // Storage queue full: tried again at the next call, the trip goes on until then
+    if(Storage_CloseTrip())
     {
-      gps.encode(GPS_Serial.read());
+      recordTrip = false;
+      recordISRappened = false;
+      return GPS_PHASE_NO_FIX;
     }
-  } while (millis() - start < ms);
+    gpsProcessStats.tripCloseFailures++;
+  }
 
-  if(millis() > (checkDataTime + GPS_CHECK_PERIOD_MS))
+  if(recordISRappened)
   {
-    if(gps.charsProcessed() < 10)
-    {
-      // Diagnose GPS problem
-      //GPIO_LedSet(true);
-    }
-    else
+    GPS_RecordPoint();
+    recordISRappened = false;
+  }
+
+  return GPS_PHASE_RECORDING;
+}
+
+
+// Trip distance computation; add elapsed distance since previous point, once per new location
+static void GPS_UpdateTrip()
+{
+  if(!gpsFix.locationValid || (gpsFix.locationCount == lastLocationCount))
+  {
+    return;
+  }
+  lastLocationCount = gpsFix.locationCount;
+
+  if(gpsFix.speed >= GPS_SPEED_THRSLD) // Only compute if speed considered as not null
+  {
+    ODO_Add(&tripOdometer, gpsFix.lat, gpsFix.lng);
+    trip = (uint32_t)tripOdometer.meters;
+
+    // Every fix, not only recorded points: simplification keeps it small
+    if(recordTrip)
     {
-      //GPIO_LedSet(false);
+      Track_Add(&gpsTrack, gpsFix.lat, gpsFix.lng);
     }
-    checkDataTime = millis();
-  } 
+  }
+}
+
+
+static void GPS_RecordPoint()
+{
+  s_tripRecord record;
+  s_historyPoint point;
+
+  point.lat = gpsFix.lat;
+  point.lng = gpsFix.lng;
+  point.spd = GPS_MMS_TO_KMH(gpsFix.speed);
+  point.alt = gpsFix.altitude / 1000;
+  History_Add(&gpsHistory, &point);
+
+  record.time = GPS_FixTime();
+  record.lat = gpsFix.lat;
+  record.lng = gpsFix.lng;
+  record.alt = point.alt;
+  record.speed = point.spd;
+  record.rpm = (uint16_t)rpm;
+  record.satellites = gpsFix.satellites;
+
+  Storage_Record(&record);   // Dropped if the storage task is late, counted in storageStats
+}
+
+
+// UTC time of the fix, in s since 01/01/1970
+static uint32_t GPS_FixTime()
+{
+  tmElements_t tm;
+
+  tm.Year = CalendarYrToTm(gpsFix.year);
+  tm.Month = gpsFix.month;
+  tm.Day = gpsFix.day;
+  tm.Hour = gpsFix.hour;
+  tm.Minute = gpsFix.minute;
+  tm.Second = gpsFix.second;
+
+  return makeTime(tm);
 }
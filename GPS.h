@@ -18,24 +18,38 @@
 //---------------------------------------------
 #include <TinyGPS++.h>
 #include <TimeLib.h> 
+#include "GPS_Ingest.h"
+#include "History.h"
+#include "Track.h"
 
 //---------------------------------------------
 // Defines
 //---------------------------------------------
-#define   LOCATION_HISTORY_SIZE     2500
 
 //---------------------------------------------
 // Enum, struct, union
 //---------------------------------------------
+typedef enum
+{
+  GPS_PHASE_NO_FIX = 0,         ///< Waiting for location, altitude, speed, satellites, date and time
+  GPS_PHASE_FIX_ACQUIRED,       ///< First fix: clock set, trip started
+  GPS_PHASE_WARMUP,             ///< Trip distance counted, waiting TRIP_RECORD_DELAY_MS before recording
+  GPS_PHASE_RECORDING,          ///< Points logged at each record timer event
+  GPS_PHASE_NB
+}e_gpsPhase;
+
+
 typedef struct
 {
-  double lng[LOCATION_HISTORY_SIZE];     ///< Longitude
-  double lat[LOCATION_HISTORY_SIZE];     ///< Latitude
-  int alt[LOCATION_HISTORY_SIZE];        ///< Altitude, in meters
-  int spd[LOCATION_HISTORY_SIZE];        ///< Speed, since last point, in km/h
-  
-  int pointsIndex = 0;
-}gpsHistory_str;
+  uint32_t  calls;                        ///< GPS_Process() calls
+  uint32_t  idleCalls;                    ///< Calls with nothing new
+  uint32_t  phaseRuns[GPS_PHASE_NB];      ///< Nb of times each phase ran
+  uint64_t  idleCycles;                   ///< CPU cycles spent in idle calls
+  uint64_t  busyCycles;                   ///< CPU cycles spent in calls running a phase
+  uint32_t  maxCycles;                    ///< Longest call running a phase, in CPU cycles
+  uint32_t  tripOpenFailures;             ///< Trip file opens refused by the storage queue, retried
+  uint32_t  tripCloseFailures;            ///< Trip file closes refused by the storage queue, retried
+}s_gpsProcessStats;
 
 
 //---------------------------------------------
@@ -46,4106 +60,28 @@ typedef struct
 //---------------------------------------------
 // Public variables
 //---------------------------------------------
-extern TinyGPSPlus gps;
+extern s_gpsFix gpsFix;
 
-extern float rpm;
 extern bool firstFixDone;
 extern bool recordTrip;
   
-extern double trip;
+extern uint32_t trip;
 extern double total;
  
 extern int test;
 
-extern gpsHistory_str gpsHistory;
+extern s_history gpsHistory;
+extern s_track gpsTrack;
+
+extern e_gpsPhase gpsPhase;
+extern s_gpsProcessStats gpsProcessStats;
 
-#ifdef SIMU_TEST_GPS
-const int tete[2038]={
-600 ,
-600 ,
-599 ,
-599 ,
-598 ,
-599 ,
-599 ,
-599 ,
-598 ,
-597 ,
-597 ,
-596 ,
-597 ,
-597 ,
-597 ,
-597 ,
-602 ,
-603 ,
-605 ,
-606 ,
-607 ,
-609 ,
-610 ,
-610 ,
-610 ,
-610 ,
-609 ,
-607 ,
-606 ,
-606 ,
-605 ,
-603 ,
-602 ,
-602 ,
-601 ,
-600 ,
-599 ,
-598 ,
-598 ,
-597 ,
-596 ,
-595 ,
-594 ,
-593 ,
-593 ,
-591 ,
-591 ,
-588 ,
-587 ,
-586 ,
-586 ,
-586 ,
-582 ,
-582 ,
-584 ,
-585 ,
-587 ,
-589 ,
-591 ,
-592 ,
-594 ,
-595 ,
-596 ,
-597 ,
-597 ,
-599 ,
-599 ,
-601 ,
-602 ,
-604 ,
-605 ,
-605 ,
-608 ,
-608 ,
-609 ,
-610 ,
-610 ,
-611 ,
-611 ,
-612 ,
-612 ,
-613 ,
-615 ,
-616 ,
-617 ,
-619 ,
-620 ,
-620 ,
-622 ,
-623 ,
-625 ,
-626 ,
-627 ,
-628 ,
-629 ,
-631 ,
-632 ,
-632 ,
-634 ,
-635 ,
-636 ,
-636 ,
-639 ,
-640 ,
-640 ,
-641 ,
-642 ,
-643 ,
-644 ,
-644 ,
-645 ,
-645 ,
-646 ,
-646 ,
-646 ,
-647 ,
-648 ,
-648 ,
-648 ,
-648 ,
-648 ,
-647 ,
-646 ,
-646 ,
-646 ,
-646 ,
-642 ,
-640 ,
-639 ,
-637 ,
-636 ,
-634 ,
-634 ,
-632 ,
-632 ,
-628 ,
-626 ,
-625 ,
-625 ,
-623 ,
-623 ,
-620 ,
-620 ,
-619 ,
-618 ,
-617 ,
-616 ,
-615 ,
-614 ,
-612 ,
-611 ,
-610 ,
-610 ,
-608 ,
-608 ,
-608 ,
-607 ,
-606 ,
-606 ,
-604 ,
-604 ,
-602 ,
-601 ,
-599 ,
-597 ,
-596 ,
-595 ,
-594 ,
-593 ,
-593 ,
-591 ,
-589 ,
-588 ,
-587 ,
-585 ,
-583 ,
-582 ,
-581 ,
-579 ,
-578 ,
-576 ,
-575 ,
-574 ,
-574 ,
-572 ,
-572 ,
-572 ,
-572 ,
-571 ,
-570 ,
-570 ,
-570 ,
-568 ,
-568 ,
-568 ,
-568 ,
-568 ,
-567 ,
-567 ,
-566 ,
-565 ,
-565 ,
-565 ,
-564 ,
-563 ,
-563 ,
-562 ,
-562 ,
-561 ,
-561 ,
-560 ,
-560 ,
-559 ,
-559 ,
-558 ,
-558 ,
-558 ,
-555 ,
-553 ,
-552 ,
-551 ,
-550 ,
-549 ,
-547 ,
-547 ,
-545 ,
-543 ,
-543 ,
-543 ,
-543 ,
-543 ,
-544 ,
-545 ,
-545 ,
-546 ,
-546 ,
-544 ,
-543 ,
-542 ,
-541 ,
-541 ,
-539 ,
-539 ,
-537 ,
-536 ,
-536 ,
-536 ,
-534 ,
-534 ,
-534 ,
-534 ,
-534 ,
-533 ,
-533 ,
-533 ,
-533 ,
-532 ,
-532 ,
-531 ,
-530 ,
-530 ,
-530 ,
-529 ,
-529 ,
-529 ,
-527 ,
-526 ,
-526 ,
-526 ,
-526 ,
-527 ,
-527 ,
-526 ,
-525 ,
-523 ,
-522 ,
-521 ,
-519 ,
-518 ,
-516 ,
-516 ,
-514 ,
-514 ,
-513 ,
-511 ,
-510 ,
-510 ,
-509 ,
-507 ,
-507 ,
-506 ,
-506 ,
-506 ,
-506 ,
-504 ,
-504 ,
-502 ,
-500 ,
-500 ,
-500 ,
-498 ,
-497 ,
-497 ,
-497 ,
-497 ,
-497 ,
-498 ,
-498 ,
-498 ,
-498 ,
-500 ,
-500 ,
-501 ,
-503 ,
-504 ,
-503 ,
-503 ,
-503 ,
-502 ,
-502 ,
-500 ,
-500 ,
-499 ,
-498 ,
-498 ,
-495 ,
-495 ,
-493 ,
-493 ,
-489 ,
-487 ,
-486 ,
-486 ,
-486 ,
-481 ,
-480 ,
-479 ,
-479 ,
-475 ,
-475 ,
-473 ,
-473 ,
-471 ,
-471 ,
-471 ,
-470 ,
-470 ,
-469 ,
-469 ,
-466 ,
-464 ,
-463 ,
-462 ,
-460 ,
-459 ,
-457 ,
-456 ,
-455 ,
-454 ,
-453 ,
-452 ,
-452 ,
-452 ,
-452 ,
-447 ,
-445 ,
-445 ,
-442 ,
-442 ,
-439 ,
-438 ,
-437 ,
-436 ,
-436 ,
-432 ,
-431 ,
-429 ,
-429 ,
-426 ,
-424 ,
-423 ,
-421 ,
-421 ,
-417 ,
-416 ,
-414 ,
-413 ,
-412 ,
-410 ,
-409 ,
-409 ,
-409 ,
-405 ,
-404 ,
-403 ,
-403 ,
-403 ,
-403 ,
-403 ,
-403 ,
-404 ,
-403 ,
-403 ,
-402 ,
-402 ,
-402 ,
-402 ,
-402 ,
-402 ,
-402 ,
-403 ,
-403 ,
-403 ,
-403 ,
-404 ,
-406 ,
-407 ,
-410 ,
-413 ,
-413 ,
-417 ,
-418 ,
-418 ,
-422 ,
-423 ,
-425 ,
-426 ,
-426 ,
-428 ,
-429 ,
-431 ,
-432 ,
-434 ,
-435 ,
-437 ,
-437 ,
-441 ,
-442 ,
-442 ,
-444 ,
-444 ,
-448 ,
-448 ,
-450 ,
-452 ,
-452 ,
-455 ,
-455 ,
-457 ,
-457 ,
-461 ,
-463 ,
-464 ,
-466 ,
-468 ,
-469 ,
-470 ,
-471 ,
-473 ,
-475 ,
-477 ,
-479 ,
-482 ,
-483 ,
-485 ,
-486 ,
-486 ,
-488 ,
-488 ,
-488 ,
-492 ,
-492 ,
-492 ,
-497 ,
-498 ,
-500 ,
-500 ,
-503 ,
-503 ,
-505 ,
-506 ,
-508 ,
-510 ,
-510 ,
-512 ,
-514 ,
-515 ,
-516 ,
-516 ,
-516 ,
-515 ,
-515 ,
-515 ,
-517 ,
-517 ,
-520 ,
-522 ,
-523 ,
-525 ,
-527 ,
-527 ,
-529 ,
-530 ,
-531 ,
-531 ,
-534 ,
-536 ,
-537 ,
-539 ,
-541 ,
-542 ,
-544 ,
-546 ,
-546 ,
-550 ,
-552 ,
-553 ,
-555 ,
-555 ,
-557 ,
-558 ,
-560 ,
-562 ,
-563 ,
-563 ,
-565 ,
-567 ,
-568 ,
-570 ,
-571 ,
-572 ,
-574 ,
-574 ,
-574 ,
-574 ,
-574 ,
-573 ,
-573 ,
-573 ,
-571 ,
-570 ,
-570 ,
-570 ,
-570 ,
-569 ,
-569 ,
-568 ,
-567 ,
-567 ,
-566 ,
-566 ,
-565 ,
-565 ,
-565 ,
-564 ,
-564 ,
-563 ,
-563 ,
-563 ,
-563 ,
-563 ,
-561 ,
-561 ,
-559 ,
-559 ,
-559 ,
-559 ,
-555 ,
-554 ,
-553 ,
-552 ,
-551 ,
-550 ,
-548 ,
-547 ,
-546 ,
-545 ,
-543 ,
-542 ,
-542 ,
-539 ,
-539 ,
-538 ,
-537 ,
-536 ,
-536 ,
-535 ,
-535 ,
-535 ,
-533 ,
-532 ,
-531 ,
-530 ,
-530 ,
-529 ,
-529 ,
-528 ,
-528 ,
-528 ,
-527 ,
-526 ,
-525 ,
-524 ,
-522 ,
-521 ,
-519 ,
-519 ,
-518 ,
-517 ,
-515 ,
-514 ,
-512 ,
-512 ,
-510 ,
-510 ,
-510 ,
-508 ,
-508 ,
-507 ,
-507 ,
-507 ,
-505 ,
-503 ,
-502 ,
-501 ,
-501 ,
-498 ,
-498 ,
-497 ,
-495 ,
-493 ,
-492 ,
-491 ,
-489 ,
-488 ,
-486 ,
-484 ,
-484 ,
-482 ,
-481 ,
-480 ,
-479 ,
-478 ,
-477 ,
-477 ,
-474 ,
-473 ,
-473 ,
-473 ,
-470 ,
-469 ,
-468 ,
-466 ,
-465 ,
-463 ,
-461 ,
-460 ,
-459 ,
-458 ,
-458 ,
-458 ,
-456 ,
-456 ,
-456 ,
-454 ,
-454 ,
-452 ,
-450 ,
-449 ,
-447 ,
-445 ,
-444 ,
-444 ,
-443 ,
-442 ,
-442 ,
-442 ,
-443 ,
-443 ,
-443 ,
-443 ,
-443 ,
-442 ,
-441 ,
-440 ,
-440 ,
-438 ,
-438 ,
-437 ,
-437 ,
-437 ,
-436 ,
-436 ,
-436 ,
-436 ,
-436 ,
-436 ,
-436 ,
-436 ,
-436 ,
-435 ,
-434 ,
-433 ,
-432 ,
-432 ,
-431 ,
-430 ,
-429 ,
-429 ,
-430 ,
-430 ,
-432 ,
-435 ,
-437 ,
-439 ,
-441 ,
-443 ,
-445 ,
-447 ,
-448 ,
-450 ,
-450 ,
-454 ,
-455 ,
-457 ,
-458 ,
-460 ,
-462 ,
-463 ,
-464 ,
-464 ,
-464 ,
-468 ,
-468 ,
-470 ,
-472 ,
-473 ,
-474 ,
-476 ,
-478 ,
-479 ,
-480 ,
-480 ,
-480 ,
-480 ,
-481 ,
-482 ,
-484 ,
-485 ,
-486 ,
-487 ,
-488 ,
-488 ,
-491 ,
-492 ,
-493 ,
-494 ,
-495 ,
-496 ,
-496 ,
-497 ,
-498 ,
-499 ,
-500 ,
-500 ,
-501 ,
-501 ,
-501 ,
-502 ,
-503 ,
-504 ,
-505 ,
-505 ,
-506 ,
-507 ,
-506 ,
-506 ,
-505 ,
-505 ,
-505 ,
-505 ,
-506 ,
-507 ,
-507 ,
-508 ,
-510 ,
-511 ,
-511 ,
-514 ,
-515 ,
-515 ,
-517 ,
-517 ,
-517 ,
-516 ,
-516 ,
-515 ,
-515 ,
-515 ,
-515 ,
-515 ,
-515 ,
-511 ,
-510 ,
-509 ,
-508 ,
-507 ,
-506 ,
-506 ,
-504 ,
-502 ,
-501 ,
-500 ,
-498 ,
-497 ,
-496 ,
-495 ,
-494 ,
-493 ,
-491 ,
-490 ,
-489 ,
-488 ,
-487 ,
-487 ,
-484 ,
-483 ,
-482 ,
-481 ,
-479 ,
-479 ,
-475 ,
-474 ,
-474 ,
-471 ,
-469 ,
-468 ,
-467 ,
-466 ,
-465 ,
-465 ,
-463 ,
-462 ,
-462 ,
-461 ,
-460 ,
-460 ,
-459 ,
-459 ,
-457 ,
-456 ,
-456 ,
-455 ,
-455 ,
-455 ,
-454 ,
-454 ,
-454 ,
-454 ,
-450 ,
-450 ,
-450 ,
-452 ,
-453 ,
-453 ,
-451 ,
-450 ,
-450 ,
-450 ,
-448 ,
-446 ,
-445 ,
-444 ,
-443 ,
-443 ,
-443 ,
-441 ,
-440 ,
-440 ,
-440 ,
-442 ,
-443 ,
-445 ,
-446 ,
-446 ,
-446 ,
-448 ,
-448 ,
-450 ,
-450 ,
-450 ,
-449 ,
-449 ,
-447 ,
-446 ,
-446 ,
-444 ,
-444 ,
-442 ,
-441 ,
-441 ,
-441 ,
-441 ,
-441 ,
-438 ,
-438 ,
-437 ,
-435 ,
-435 ,
-435 ,
-435 ,
-435 ,
-436 ,
-436 ,
-437 ,
-437 ,
-435 ,
-434 ,
-434 ,
-435 ,
-437 ,
-439 ,
-439 ,
-441 ,
-443 ,
-444 ,
-446 ,
-447 ,
-449 ,
-449 ,
-449 ,
-449 ,
-450 ,
-451 ,
-451 ,
-452 ,
-452 ,
-452 ,
-455 ,
-457 ,
-458 ,
-460 ,
-461 ,
-461 ,
-461 ,
-466 ,
-468 ,
-469 ,
-469 ,
-469 ,
-471 ,
-473 ,
-475 ,
-475 ,
-478 ,
-478 ,
-481 ,
-482 ,
-482 ,
-483 ,
-483 ,
-483 ,
-485 ,
-486 ,
-487 ,
-488 ,
-489 ,
-489 ,
-492 ,
-493 ,
-495 ,
-496 ,
-497 ,
-497 ,
-498 ,
-498 ,
-498 ,
-501 ,
-503 ,
-503 ,
-504 ,
-504 ,
-506 ,
-508 ,
-508 ,
-508 ,
-508 ,
-508 ,
-507 ,
-507 ,
-505 ,
-504 ,
-503 ,
-504 ,
-505 ,
-506 ,
-506 ,
-508 ,
-508 ,
-508 ,
-512 ,
-514 ,
-514 ,
-514 ,
-514 ,
-518 ,
-519 ,
-521 ,
-521 ,
-522 ,
-522 ,
-522 ,
-524 ,
-524 ,
-527 ,
-529 ,
-530 ,
-531 ,
-531 ,
-535 ,
-535 ,
-537 ,
-539 ,
-540 ,
-541 ,
-541 ,
-541 ,
-542 ,
-542 ,
-542 ,
-546 ,
-547 ,
-548 ,
-549 ,
-550 ,
-551 ,
-552 ,
-552 ,
-554 ,
-554 ,
-555 ,
-556 ,
-556 ,
-558 ,
-559 ,
-560 ,
-562 ,
-564 ,
-564 ,
-565 ,
-565 ,
-567 ,
-567 ,
-567 ,
-569 ,
-569 ,
-571 ,
-571 ,
-572 ,
-573 ,
-572 ,
-570 ,
-570 ,
-568 ,
-568 ,
-567 ,
-568 ,
-568 ,
-569 ,
-569 ,
-571 ,
-571 ,
-573 ,
-573 ,
-573 ,
-574 ,
-574 ,
-574 ,
-574 ,
-571 ,
-570 ,
-570 ,
-570 ,
-571 ,
-573 ,
-575 ,
-577 ,
-579 ,
-579 ,
-579 ,
-584 ,
-586 ,
-587 ,
-589 ,
-590 ,
-591 ,
-592 ,
-592 ,
-592 ,
-594 ,
-595 ,
-597 ,
-597 ,
-601 ,
-602 ,
-604 ,
-605 ,
-607 ,
-607 ,
-613 ,
-615 ,
-617 ,
-618 ,
-619 ,
-620 ,
-620 ,
-620 ,
-620 ,
-621 ,
-621 ,
-621 ,
-623 ,
-624 ,
-624 ,
-626 ,
-627 ,
-627 ,
-626 ,
-625 ,
-624 ,
-624 ,
-626 ,
-626 ,
-628 ,
-630 ,
-630 ,
-631 ,
-632 ,
-632 ,
-632 ,
-632 ,
-632 ,
-632 ,
-632 ,
-631 ,
-630 ,
-628 ,
-628 ,
-628 ,
-625 ,
-624 ,
-623 ,
-623 ,
-622 ,
-621 ,
-621 ,
-621 ,
-620 ,
-620 ,
-619 ,
-618 ,
-617 ,
-617 ,
-615 ,
-615 ,
-615 ,
-615 ,
-615 ,
-615 ,
-617 ,
-617 ,
-618 ,
-620 ,
-622 ,
-622 ,
-622 ,
-622 ,
-621 ,
-620 ,
-618 ,
-617 ,
-616 ,
-614 ,
-614 ,
-612 ,
-610 ,
-609 ,
-608 ,
-608 ,
-608 ,
-608 ,
-608 ,
-608 ,
-608 ,
-608 ,
-609 ,
-610 ,
-610 ,
-612 ,
-612 ,
-612 ,
-611 ,
-609 ,
-608 ,
-608 ,
-608 ,
-606 ,
-605 ,
-604 ,
-603 ,
-602 ,
-601 ,
-601 ,
-600 ,
-599 ,
-598 ,
-598 ,
-597 ,
-596 ,
-595 ,
-594 ,
-594 ,
-594 ,
-593 ,
-593 ,
-593 ,
-593 ,
-589 ,
-588 ,
-587 ,
-587 ,
-585 ,
-585 ,
-583 ,
-582 ,
-580 ,
-579 ,
-578 ,
-576 ,
-575 ,
-574 ,
-573 ,
-572 ,
-572 ,
-572 ,
-570 ,
-569 ,
-569 ,
-569 ,
-566 ,
-565 ,
-565 ,
-563 ,
-563 ,
-562 ,
-561 ,
-561 ,
-559 ,
-558 ,
-558 ,
-557 ,
-556 ,
-555 ,
-553 ,
-552 ,
-552 ,
-551 ,
-551 ,
-551 ,
-550 ,
-550 ,
-550 ,
-549 ,
-547 ,
-546 ,
-545 ,
-544 ,
-543 ,
-542 ,
-541 ,
-541 ,
-539 ,
-539 ,
-538 ,
-538 ,
-536 ,
-535 ,
-533 ,
-532 ,
-530 ,
-529 ,
-528 ,
-527 ,
-525 ,
-525 ,
-525 ,
-525 ,
-525 ,
-524 ,
-523 ,
-523 ,
-521 ,
-520 ,
-519 ,
-518 ,
-516 ,
-515 ,
-514 ,
-513 ,
-512 ,
-512 ,
-512 ,
-511 ,
-511 ,
-511 ,
-510 ,
-508 ,
-506 ,
-506 ,
-505 ,
-504 ,
-503 ,
-502 ,
-501 ,
-500 ,
-498 ,
-498 ,
-498 ,
-494 ,
-494 ,
-492 ,
-490 ,
-489 ,
-488 ,
-488 ,
-488 ,
-487 ,
-487 ,
-486 ,
-485 ,
-484 ,
-484 ,
-481 ,
-479 ,
-478 ,
-478 ,
-478 ,
-477 ,
-477 ,
-476 ,
-474 ,
-473 ,
-472 ,
-470 ,
-470 ,
-468 ,
-467 ,
-466 ,
-465 ,
-465 ,
-463 ,
-463 ,
-461 ,
-460 ,
-460 ,
-457 ,
-455 ,
-454 ,
-452 ,
-451 ,
-450 ,
-449 ,
-448 ,
-448 ,
-448 ,
-447 ,
-447 ,
-447 ,
-446 ,
-446 ,
-443 ,
-443 ,
-440 ,
-438 ,
-438 ,
-439 ,
-439 ,
-439 ,
-441 ,
-441 ,
-441 ,
-440 ,
-440 ,
-440 ,
-440 ,
-440 ,
-440 ,
-438 ,
-437 ,
-436 ,
-434 ,
-433 ,
-433 ,
-431 ,
-431 ,
-431 ,
-430 ,
-430 ,
-431 ,
-430 ,
-430 ,
-431 ,
-431 ,
-431 ,
-431 ,
-430 ,
-430 ,
-430 ,
-431 ,
-433 ,
-434 ,
-434 ,
-434 ,
-434 ,
-434 ,
-438 ,
-438 ,
-439 ,
-439 ,
-439 ,
-440 ,
-440 ,
-440 ,
-440 ,
-440 ,
-439 ,
-439 ,
-438 ,
-437 ,
-437 ,
-437 ,
-437 ,
-435 ,
-433 ,
-433 ,
-433 ,
-430 ,
-430 ,
-429 ,
-430 ,
-431 ,
-432 ,
-434 ,
-434 ,
-436 ,
-437 ,
-438 ,
-439 ,
-440 ,
-441 ,
-441 ,
-442 ,
-443 ,
-444 ,
-445 ,
-447 ,
-448 ,
-448 ,
-450 ,
-450 ,
-450 ,
-451 ,
-451 ,
-452 ,
-452 ,
-453 ,
-453 ,
-457 ,
-458 ,
-460 ,
-461 ,
-461 ,
-464 ,
-465 ,
-465 ,
-465 ,
-468 ,
-469 ,
-469 ,
-471 ,
-472 ,
-473 ,
-475 ,
-476 ,
-477 ,
-479 ,
-480 ,
-481 ,
-481 ,
-482 ,
-482 ,
-483 ,
-484 ,
-484 ,
-485 ,
-487 ,
-487 ,
-490 ,
-490 ,
-493 ,
-494 ,
-494 ,
-496 ,
-498 ,
-498 ,
-498 ,
-501 ,
-503 ,
-503 ,
-504 ,
-505 ,
-506 ,
-506 ,
-506 ,
-507 ,
-507 ,
-508 ,
-508 ,
-508 ,
-507 ,
-506 ,
-506 ,
-505 ,
-504 ,
-504 ,
-506 ,
-506 ,
-507 ,
-508 ,
-508 ,
-512 ,
-513 ,
-514 ,
-514 ,
-516 ,
-517 ,
-519 ,
-520 ,
-520 ,
-522 ,
-522 ,
-522 ,
-522 ,
-525 ,
-526 ,
-526 ,
-526 ,
-525 ,
-524 ,
-526 ,
-528 ,
-528 ,
-526 ,
-525 ,
-524 ,
-524 ,
-523 ,
-523 ,
-522 ,
-521 ,
-520 ,
-520 ,
-518 ,
-517 ,
-516 ,
-515 ,
-514 ,
-514 ,
-512 ,
-512 ,
-511 ,
-511 ,
-510 ,
-509 ,
-509 ,
-509 ,
-508 ,
-507 ,
-507 ,
-506 ,
-506 ,
-505 ,
-505 ,
-505 ,
-505 ,
-505 ,
-505 ,
-505 ,
-506 ,
-506 ,
-506 ,
-504 ,
-503 ,
-502 ,
-502 ,
-501 ,
-501 ,
-501 ,
-499 ,
-499 ,
-499 ,
-498 ,
-498 ,
-497 ,
-496 ,
-495 ,
-494 ,
-492 ,
-490 ,
-490 ,
-490 ,
-486 ,
-484 ,
-483 ,
-481 ,
-481 ,
-480 ,
-480 ,
-478 ,
-478 ,
-476 ,
-474 ,
-473 ,
-473 ,
-470 ,
-469 ,
-467 ,
-466 ,
-464 ,
-463 ,
-463 ,
-459 ,
-458 ,
-458 ,
-456 ,
-456 ,
-452 ,
-451 ,
-449 ,
-447 ,
-447 ,
-445 ,
-444 ,
-442 ,
-441 ,
-440 ,
-438 ,
-436 ,
-434 ,
-433 ,
-433 ,
-430 ,
-428 ,
-428 ,
-429 ,
-430 ,
-431 ,
-432 ,
-434 ,
-435 ,
-435 ,
-437 ,
-438 ,
-438 ,
-438 ,
-438 ,
-437 ,
-437 ,
-436 ,
-436 ,
-436 ,
-437 ,
-438 ,
-438 ,
-439 ,
-440 ,
-442 ,
-443 ,
-443 ,
-443 ,
-443 ,
-442 ,
-442 ,
-442 ,
-442 ,
-442 ,
-441 ,
-442 ,
-443 ,
-445 ,
-445 ,
-447 ,
-448 ,
-450 ,
-451 ,
-452 ,
-452 ,
-455 ,
-456 ,
-458 ,
-459 ,
-460 ,
-462 ,
-464 ,
-465 ,
-467 ,
-468 ,
-469 ,
-469 ,
-471 ,
-472 ,
-473 ,
-474 ,
-475 ,
-475 ,
-478 ,
-478 ,
-480 ,
-481 ,
-481 ,
-483 ,
-483 ,
-484 ,
-485 ,
-485 ,
-488 ,
-490 ,
-491 ,
-493 ,
-494 ,
-494 ,
-497 ,
-497 ,
-499 ,
-501 ,
-501 ,
-504 ,
-505 ,
-505 ,
-506 ,
-507 ,
-507 ,
-509 ,
-509 ,
-509 ,
-510 ,
-511 ,
-513 ,
-514 ,
-514 ,
-514 ,
-517 ,
-518 ,
-519 ,
-519 ,
-519 ,
-521 ,
-521 ,
-522 ,
-524 ,
-525 ,
-525 ,
-525 ,
-525 ,
-525 ,
-526 ,
-528 ,
-529 ,
-530 ,
-531 ,
-531 ,
-531 ,
-532 ,
-533 ,
-534 ,
-534 ,
-534 ,
-538 ,
-538 ,
-540 ,
-542 ,
-543 ,
-543 ,
-544 ,
-545 ,
-546 ,
-546 ,
-547 ,
-548 ,
-548 ,
-551 ,
-552 ,
-553 ,
-553 ,
-554 ,
-554 ,
-556 ,
-557 ,
-557 ,
-557 ,
-558 ,
-558 ,
-559 ,
-560 ,
-561 ,
-561 ,
-562 ,
-562 ,
-563 ,
-563 ,
-564 ,
-564 ,
-564 ,
-564 ,
-565 ,
-566 ,
-566 ,
-566 ,
-566 ,
-567 ,
-567 ,
-568 ,
-568 ,
-568 ,
-569 ,
-570 ,
-570 ,
-571 ,
-573 ,
-574 ,
-575 ,
-577 ,
-577 ,
-580 ,
-581 ,
-583 ,
-583 ,
-586 ,
-586 ,
-590 ,
-591 ,
-592 ,
-594 ,
-595 ,
-595 ,
-599 ,
-600 ,
-600 ,
-604 ,
-604 ,
-604 ,
-606 ,
-606 ,
-606 ,
-607 ,
-608 ,
-608 ,
-610 ,
-610 ,
-613 ,
-615 ,
-616 ,
-617 ,
-617 ,
-621 ,
-622 ,
-624 ,
-624 ,
-627 ,
-629 ,
-630 ,
-632 ,
-633 ,
-634 ,
-636 ,
-636 ,
-636 ,
-639 ,
-640 ,
-641 ,
-641 ,
-644 ,
-644 ,
-644 ,
-644 ,
-645 ,
-646 ,
-646 ,
-648 ,
-649 ,
-650 ,
-650 ,
-650 ,
-653 ,
-653 ,
-652 ,
-652 ,
-653 ,
-653 ,
-653 ,
-653 ,
-652 ,
-650 ,
-649 ,
-649 ,
-648 ,
-647 ,
-646 ,
-645 ,
-644 ,
-644 ,
-644 ,
-643 ,
-643 ,
-643 ,
-639 ,
-638 ,
-637 ,
-636 ,
-636 ,
-636 ,
-636 ,
-629 ,
-627 ,
-627 ,
-625 ,
-624 ,
-624 ,
-623 ,
-623 ,
-622 ,
-621 ,
-619 ,
-618 ,
-616 ,
-616 ,
-614 ,
-612 ,
-610 ,
-608 ,
-606 ,
-605 ,
-605 ,
-601 ,
-600 ,
-599 ,
-597 ,
-596 ,
-596 ,
-595 ,
-595 ,
-595 ,
-595 ,
-595 ,
-598 ,
-599 ,
-600 ,
-601 ,
-601 ,
-600 ,
-600 ,
-598 ,
-598 ,
-596 ,
-595 ,
-593 ,
-593 ,
-593 ,
-590 ,
-588 ,
-587 ,
-587 ,
-587 ,
-584 ,
-583 ,
-581 ,
-581 ,
-581 ,
-581 ,
-581 ,
-576 ,
-576 ,
-575 ,
-575 ,
-575 ,
-575 ,
-574 ,
-574 ,
-573 ,
-573 ,
-573 ,
-573 ,
-574 ,
-575 ,
-575 ,
-575 ,
-576 ,
-576 ,
-575 ,
-575 ,
-575 ,
-576 ,
-576 ,
-576 ,
-574 ,
-574 ,
-573 ,
-575 ,
-577 ,
-578 ,
-580 ,
-580 ,
-582 ,
-584 ,
-585 ,
-585 ,
-585 ,
-587 ,
-589 ,
-590 ,
-591 ,
-593 ,
-594 ,
-594 ,
-595 ,
-595 ,
-595 ,
-595 
-};
-const double titi[4076] = {
-4.29862802848219  , 45.4866012465208  ,
-4.29862995631992  , 45.4866286553442  ,
-4.29863364435732  , 45.4868713114410  ,
-4.29849517531692  , 45.4869143944233  ,
-4.29825553670525  , 45.4869186691939  ,
-4.29751323536038  , 45.4868704732507  ,
-4.29686757735908  , 45.4869803600013  ,
-4.29630976170301  , 45.4870548751205  ,
-4.29560492746531  , 45.4870089422911  ,
-4.29544877260923  , 45.4870021529495  ,
-4.29496765136718  , 45.4870081879198  ,
-4.29467151872813  , 45.4870515223592  ,
-4.29443045519292  , 45.4871493391692  ,
-4.29420020431280  , 45.4872620757669  ,
-4.29407078772783  , 45.4873062483966  ,
-4.29393424652516  , 45.4873335734009  ,
-4.29379393346607  , 45.4873415362089  ,
-4.29364574141800  , 45.4873275384306  ,
-4.29350014775991  , 45.4872984532266  ,
-4.29335840977728  , 45.4872632492333  ,
-4.29306772537529  , 45.4871859680861  ,
-4.29261560551822  , 45.4870542883872  ,
-4.29215233772993  , 45.4868823755532  ,
-4.29158781655132  , 45.4865871649235  ,
-4.29149687290191  , 45.4865516256541  ,
-4.29129319265484  , 45.4864647053182  ,
-4.29108372889459  , 45.4863368812948  ,
-4.29089421406388  , 45.4861763678491  ,
-4.29081014357507  , 45.4860863462090  ,
-4.29072003811597  , 45.4859957378357  ,
-4.29061710834503  , 45.4859172832220  ,
-4.29050621576607  , 45.4858545027673  ,
-4.29039347916841  , 45.4858034569770  ,
-4.29027453996241  , 45.4857741203159  ,
-4.29013732820749  , 45.4857580270618  ,
-4.28985904902219  , 45.4856964200735  ,
-4.28963349200785  , 45.4856238327920  ,
-4.28952704183757  , 45.4856015369296  ,
-4.28940583951771  , 45.4855887126177  ,
-4.28914549760520  , 45.4855778999626  ,
-4.28901130333542  , 45.4855602141469  ,
-4.28887702524662  , 45.4855343978852  ,
-4.28874014876782  , 45.4855131078511  ,
-4.28860561922192  , 45.4854938294738  ,
-4.28847611881792  , 45.4854684323072  ,
-4.28836019709706  , 45.4854383412748  ,
-4.28817395120859  , 45.4853774048388  ,
-4.28810396231710  , 45.4853525105863  ,
-4.28804797120392  , 45.4853323940187  ,
-4.28800279274582  , 45.4853117745369  ,
-4.28794034756720  , 45.4852764029055  ,
-4.28793355822563  , 45.4852731339633  ,
-4.28792928345501  , 45.4852446354925  ,
-4.28810371086001  , 45.4849456530064  ,
-4.28819733671844  , 45.4846848081797  ,
-4.28832666948437  , 45.4843890946358  ,
-4.28850336000323  , 45.4840688221156  ,
-4.28859530948102  , 45.4839130863547  ,
-4.28870226256549  , 45.4837682470679  ,
-4.28882002830505  , 45.4836360644549  ,
-4.28895003162324  , 45.4835145268589  ,
-4.28908707574009  , 45.4834018740803  ,
-4.28922696970403  , 45.4832998663187  ,
-4.28937884978950  , 45.4832281172275  ,
-4.28954422473907  , 45.4831774905323  ,
-4.28973977454006  , 45.4831777419894  ,
-4.28995208814740  , 45.4831994511187  ,
-4.29041024297475  , 45.4832974355667  ,
-4.29064317606389  , 45.4833665024489  ,
-4.29086529649794  , 45.4834463819861  ,
-4.29106612689793  , 45.4835296142846  ,
-4.29123854264616  , 45.4836031235754  ,
-4.29139201529324  , 45.4836593661457  ,
-4.29153786040842  , 45.4836985096335  ,
-4.29168001748621  , 45.4837204702198  ,
-4.29182577878236  , 45.4837188776582  ,
-4.29210204631090  , 45.4836525768041  ,
-4.29220556281507  , 45.4835782293230  ,
-4.29226398468017  , 45.4834788199514  ,
-4.29229097440838  , 45.4833627305924  ,
-4.29230262525379  , 45.4832311347126  ,
-4.29230337962508  , 45.4830862954258  ,
-4.29230849258601  , 45.4827724769711  ,
-4.29231679067015  , 45.4826065991073  ,
-4.29232383146882  , 45.4824399668723  ,
-4.29233246482908  , 45.4822857398539  ,
-4.29235182702541  , 45.4821487795561  ,
-4.29238812066614  , 45.4820293374359  ,
-4.29244386032223  , 45.4819234739989  ,
-4.29253136739134  , 45.4818444326519  ,
-4.29279606789350  , 45.4817704204469  ,
-4.29311851970851  , 45.4818026907742  ,
-4.29327215999364  , 45.4818228911608  ,
-4.29341205395758  , 45.4818409960716  ,
-4.29353451356291  , 45.4818456899374  ,
-4.29376174695789  , 45.4818302672356  ,
-4.29410330951213  , 45.4817969072610  ,
-4.29468006826937  , 45.4817188717424  ,
-4.29498860612511  , 45.4816471226513  ,
-4.29512975737452  , 45.4815933108329  ,
-4.29526026360690  , 45.4815306980162  ,
-4.29553577676415  , 45.4813804104924  ,
-4.29569947533309  , 45.4813086614012  ,
-4.29586602374911  , 45.4812546819448  ,
-4.29602670483291  , 45.4812195617705  ,
-4.29618436843156  , 45.4812117666006  ,
-4.29635301232337  , 45.4812245909124  ,
-4.29652425460517  , 45.4812424443662  ,
-4.29669063538312  , 45.4812501557171  ,
-4.29685173556208  , 45.4812446236610  ,
-4.29719195701181  , 45.4811924044042  ,
-4.29723948240280  , 45.4811628162860  ,
-4.29724291898310  , 45.4811129439622  ,
-4.29715549573302  , 45.4810081701725  ,
-4.29709933698177  , 45.4809634946286  ,
-4.29693857207894  , 45.4807531926780  ,
-4.29693706333637  , 45.4807415418326  ,
-4.29691862314939  , 45.4807041585445  ,
-4.29683094844222  , 45.4806077666580  ,
-4.29643020965158  , 45.4802365321666  ,
-4.29632627405226  , 45.4801408946514  ,
-4.29587122052907  , 45.4797493759542  ,
-4.29573426023125  , 45.4796677362173  ,
-4.29557709954679  , 45.4795959871262  ,
-4.29522983729839  , 45.4794719349592  ,
-4.29491316899657  , 45.4793436918407  ,
-4.29466271772980  , 45.4791867826133  ,
-4.29444721899926  , 45.4789978545159  ,
-4.29422250017523  , 45.4787878040224  ,
-4.29398990236222  , 45.4785619117319  ,
-4.29375210776925  , 45.4783268831670  ,
-4.29351741448044  , 45.4780852328985  ,
-4.29327425546944  , 45.4778499528765  ,
-4.29303822107613  , 45.4776247311383  ,
-4.29282515309751  , 45.4774257447570  ,
-4.29262138903141  , 45.4772203881293  ,
-4.29239893332123  , 45.4770036321133  ,
-4.29216667078435  , 45.4767766501754  ,
-4.29192669689655  , 45.4765409510582  ,
-4.29168823175132  , 45.4763020668178  ,
-4.29143895395100  , 45.4760682117193  ,
-4.29130207747220  , 45.4759600851684  ,
-4.29115338250994  , 45.4758646991103  ,
-4.29099253378808  , 45.4757807962596  ,
-4.29081374779343  , 45.4757072031497  ,
-4.29060428403317  , 45.4756423272192  ,
-4.29036271758377  , 45.4755881801247  ,
-4.28982409648597  , 45.4754877649247  ,
-4.28955998271703  , 45.4754372220486  ,
-4.28931271657347  , 45.4753893613815  ,
-4.28907651454210  , 45.4753494635224  ,
-4.28884693421423  , 45.4753187857568  ,
-4.28861374966800  , 45.4753055423498  ,
-4.28837033919990  , 45.4753111582249  ,
-4.28753709420561  , 45.4753879364579  ,
-4.28672698326408  , 45.4754619486629  ,
-4.28648625500500  , 45.4754810594022  ,
-4.28605131804943  , 45.4754865914583  ,
-4.28568058647215  , 45.4754047840833  ,
-4.28536928258836  , 45.4752350505441  ,
-4.28523642942309  , 45.4751275945454  ,
-4.28488514386117  , 45.4747881274670  ,
-4.28465589880943  , 45.4745793342590  ,
-4.28442581556737  , 45.4743784200400  ,
-4.28416731767356  , 45.4741970356553  ,
-4.28402080200612  , 45.4741204250603  ,
-4.28386330604553  , 45.4740547947585  ,
-4.28369700908660  , 45.4740008153021  ,
-4.28352291695773  , 45.4739598277956  ,
-4.28334563970565  , 45.4739313293248  ,
-4.28298790007829  , 45.4739060997962  ,
-4.28262823261320  , 45.4739019088447  ,
-4.28245455957949  , 45.4739024955779  ,
-4.28212556988000  , 45.4738993104547  ,
-4.28178710862994  , 45.4738965444266  ,
-4.28144554607570  , 45.4738910961896  ,
-4.28111345507204  , 45.4738952033221  ,
-4.28078941069543  , 45.4738925211131  ,
-4.28047249093651  , 45.4738509468734  ,
-4.28016319870948  , 45.4737488552927  ,
-4.27989221177995  , 45.4735842347145  ,
-4.27969733253121  , 45.4733685683459  ,
-4.27953463979065  , 45.4729928076267  ,
-4.27943967282772  , 45.4727333877235  ,
-4.27937890402972  , 45.4726100061088  ,
-4.27930380217730  , 45.4724943358451  ,
-4.27921378053724  , 45.4723880533128  ,
-4.27897640503942  , 45.4722122009843  ,
-4.27883232012391  , 45.4721425473690  ,
-4.27867524325847  , 45.4720835387706  ,
-4.27833845838904  , 45.4719958640635  ,
-4.27798147313296  , 45.4719604924321  ,
-4.27719919010996  , 45.4720350075513  ,
-4.27640684880316  , 45.4721961077302  ,
-4.27579253911972  , 45.4724332317709  ,
-4.27557134069502  , 45.4725059028714  ,
-4.27478184923529  , 45.4726364929229  ,
-4.27451999858021  , 45.4726654943078  ,
-4.27388087846338  , 45.4727193061262  ,
-4.27370368503034  , 45.4727123491466  ,
-4.27338642999529  , 45.4726365767419  ,
-4.27324427291750  , 45.4725670069456  ,
-4.27311074919998  , 45.4724812600761  ,
-4.27286189049482  , 45.4722914099693  ,
-4.27236593328416  , 45.4719003103673  ,
-4.27222520112991  , 45.4718250408768  ,
-4.27190140821039  , 45.4717228654772  ,
-4.27172245457768  , 45.4716976359486  ,
-4.27153754979372  , 45.4716881643980  ,
-4.27135356701910  , 45.4716827161610  ,
-4.27082072943449  , 45.4716254677623  ,
-4.27065652795135  , 45.4715787805616  ,
-4.27050808444619  , 45.4715136531740  ,
-4.27025101147592  , 45.4713398125022  ,
-4.27001740783452  , 45.4711310192942  ,
-4.26954718306660  , 45.4707317054271  ,
-4.26919807679951  , 45.4704454634338  ,
-4.26881007850170  , 45.4701464809477  ,
-4.26830490119755  , 45.4699113685637  ,
-4.26791799254715  , 45.4698339197784  ,
-4.26752815023064  , 45.4698135517537  ,
-4.26718180999159  , 45.4698381107300  ,
-4.26689783111214  , 45.4698850493878  ,
-4.26664478145539  , 45.4699326585978  ,
-4.26642953418195  , 45.4699806869029  ,
-4.26620716229081  , 45.4700153879821  ,
-4.26593340933322  , 45.4700358398258  ,
-4.26580944098532  , 45.4700604826211  ,
-4.26578555256128  , 45.4700715467333  ,
-4.26566577516496  , 45.4700897354632  ,
-4.26538866944611  , 45.4701415356248  ,
-4.26495515741407  , 45.4702923260629  ,
-4.26477796398103  , 45.4704009555280  ,
-4.26466489210724  , 45.4705162905156  ,
-4.26462532952427  , 45.4705740418285  ,
-4.26458350382745  , 45.4706269316375  ,
-4.26438854075968  , 45.4708354733884  ,
-4.26438963040709  , 45.4708341322839  ,
-4.26435962319374  , 45.4708408378064  ,
-4.26430229097604  , 45.4708872735500  ,
-4.26423305645585  , 45.4709569271653  ,
-4.26416533067822  , 45.4710399080067  ,
-4.26411487162113  , 45.4710929654538  ,
-4.26407908089458  , 45.4711135011166  ,
-4.26403909921646  , 45.4711417481303  ,
-4.26396961323916  , 45.4711756110191  ,
-4.26396785303950  , 45.4711832385510  ,
-4.26403306424617  , 45.4711829032748  ,
-4.26406944170594  , 45.4711782932281  ,
-4.26401294767856  , 45.4711909499019  ,
-4.26396215334534  , 45.4712077137082  ,
-4.26395553164184  , 45.4712093062698  ,
-4.26388395018875  , 45.4712326917797  ,
-4.26366300322115  , 45.4711814783513  ,
-4.26301826722919  , 45.4708701744675  ,
-4.26273403689265  , 45.4707379918545  ,
-4.26257285289466  , 45.4706816654652  ,
-4.26221075467765  , 45.4706163704395  ,
-4.26182912662625  , 45.4706107545644  ,
-4.26164489239454  , 45.4706297814846  ,
-4.26146786659955  , 45.4706620518118  ,
-4.26117508672177  , 45.4707478825002  ,
-4.26107425242662  , 45.4707894567400  ,
-4.26099923439323  , 45.4708287678658  ,
-4.26091164350509  , 45.4708891175687  ,
-4.26087903790175  , 45.4709255788475  ,
-4.26088163629174  , 45.4709258303046  ,
-4.26080251112580  , 45.4709758702665  ,
-4.26066379062831  , 45.4711138363927  ,
-4.26041887141764  , 45.4715316742658  ,
-4.26022172905504  , 45.4720355104655  ,
-4.26012533716857  , 45.4721790086477  ,
-4.25985124893486  , 45.4724233411252  ,
-4.25949971191585  , 45.4725795798003  ,
-4.25912152044475  , 45.4726500716060  ,
-4.25877995789051  , 45.4726458806544  ,
-4.25825860351324  , 45.4725567810237  ,
-4.25789684057235  , 45.4724872950464  ,
-4.25740281119942  , 45.4723940882831  ,
-4.25716007128357  , 45.4723406117409  ,
-4.25698329694569  , 45.4722938407212  ,
-4.25686502829194  , 45.4722583852708  ,
-4.25676696002483  , 45.4722381848841  ,
-4.25672345794737  , 45.4722567088901  ,
-4.25672991201281  , 45.4725598823279  ,
-4.25680777989327  , 45.4731296841055  ,
-4.25690853036940  , 45.4734333604574  ,
-4.25715026445686  , 45.4737046826630  ,
-4.25753197632730  , 45.4739128053188  ,
-4.25833647139370  , 45.4741299804300  ,
-4.25899202004075  , 45.4743366781622  ,
-4.25936887040734  , 45.4744313098490  ,
-4.26004093140363  , 45.4744955990463  ,
-4.26048994995653  , 45.4745746403932  ,
-4.26098573952913  , 45.4746845271438  ,
-4.26116771064698  , 45.4748231638222  ,
-4.26121582277119  , 45.4750266764312  ,
-4.26120283082127  , 45.4752273391932  ,
-4.26122663542628  , 45.4752985853701  ,
-4.26136669702827  , 45.4753601085394  ,
-4.26145470701158  , 45.4753829073160  ,
-4.26140265539288  , 45.4754639603197  ,
-4.26092170178890  , 45.4757638648152  ,
-4.26082380115985  , 45.4758537188172  ,
-4.26065398380160  , 45.4760416410863  ,
-4.26036187447607  , 45.4765553679317  ,
-4.26033438183367  , 45.4766513407230  ,
-4.26032708957791  , 45.4767373390495  ,
-4.26035433076322  , 45.4768218286335  ,
-4.26047930493950  , 45.4769736248999  ,
-4.26065809093415  , 45.4771395027637  ,
-4.26076462492346  , 45.4773853439837  ,
-4.26072145812213  , 45.4776487033814  ,
-4.26064467988908  , 45.4778286628425  ,
-4.26057477481663  , 45.4779716581106  ,
-4.26052163355052  , 45.4780735820531  ,
-4.26045700907707  , 45.4781466722488  ,
-4.26043647341430  , 45.4781958740204  ,
-4.26041535101830  , 45.4782493505626  ,
-4.26033890806138  , 45.4783511068671  ,
-4.26018669269979  , 45.4785410407930  ,
-4.26000212319195  , 45.4787623230367  ,
-4.25984957255423  , 45.4789043962955  ,
-4.25962845794856  , 45.4791364911943  ,
-4.25950105302035  , 45.4793115053325  ,
-4.25935202278196  , 45.4795913770794  ,
-4.25923467613756  , 45.4797896929085  ,
-4.25912244245409  , 45.4799709934741  ,
-4.25903485156595  , 45.4801571555435  ,
-4.25897651351988  , 45.4803468380123  ,
-4.25892622210085  , 45.4805240314453  ,
-4.25890141166746  , 45.4806985426694  ,
-4.25892865285277  , 45.4808876384049  ,
-4.25893058069050  , 45.4809924121946  ,
-4.25891088321805  , 45.4811994452029  ,
-4.25886763259768  , 45.4814018681645  ,
-4.25883284769952  , 45.4815078154206  ,
-4.25876210443675  , 45.4817146807909  ,
-4.25869982689619  , 45.4819002561271  ,
-4.25860888324677  , 45.4821471869945  ,
-4.25855138339102  , 45.4823374561965  ,
-4.25856362096965  , 45.4824478458613  ,
-4.25859413109719  , 45.4824450798332  ,
-4.25869471393525  , 45.4825050942599  ,
-4.25882463343441  , 45.4826057609170  ,
-4.25889554433524  , 45.4826581478118  ,
-4.25895673222839  , 45.4827236942946  ,
-4.25919846631586  , 45.4832142032682  ,
-4.25924733281135  , 45.4833180550485  ,
-4.25930131226778  , 45.4834210686385  ,
-4.25935696810483  , 45.4835207294672  ,
-4.25940340384840  , 45.4836187977343  ,
-4.25949510186910  , 45.4838251601904  ,
-4.25953843630850  , 45.4839232284575  ,
-4.25958621315658  , 45.4840160161256  ,
-4.25964505411684  , 45.4841032717376  ,
-4.25970741547644  , 45.4841882642358  ,
-4.25977271050214  , 45.4842715803533  ,
-4.25984571687877  , 45.4843471851199  ,
-4.25992542877793  , 45.4844130668789  ,
-4.26000958308577  , 45.4844755958765  ,
-4.26008309237658  , 45.4845531284809  ,
-4.26020236685872  , 45.4847775120288  ,
-4.26025768741965  , 45.4849060066044  ,
-4.26031468436121  , 45.4850394465029  ,
-4.26042700186371  , 45.4853088408708  ,
-4.26049699075520  , 45.4855737090110  ,
-4.26051576621830  , 45.4857044667005  ,
-4.26053663715720  , 45.4859658144414  ,
-4.26055960357189  , 45.4860891122370  ,
-4.26059053279459  , 45.4862040281295  ,
-4.26061416976153  , 45.4863174352794  ,
-4.26062338985502  , 45.4864258132874  ,
-4.26063587889075  , 45.4866312537342  ,
-4.26065222360193  , 45.4867273103445  ,
-4.26066488027572  , 45.4868184216320  ,
-4.26067619584500  , 45.4869060963392  ,
-4.26069731824100  , 45.4869967047125  ,
-4.26076588220894  , 45.4871906619518  ,
-4.26081013865768  , 45.4872901551425  ,
-4.26085439510643  , 45.4873843677341  ,
-4.26089429296553  , 45.4874819330871  ,
-4.26093293353915  , 45.4875839408487  ,
-4.26097006537020  , 45.4876847751438  ,
-4.26100694574415  , 45.4877737909555  ,
-4.26103351637721  , 45.4878580290824  ,
-4.26106587052345  , 45.4879396688193  ,
-4.26114893518388  , 45.4880831670016  ,
-4.26121699623763  , 45.4882276710122  ,
-4.26124289631843  , 45.4883010964840  ,
-4.26126753911375  , 45.4883621167391  ,
-4.26129008643329  , 45.4884186107665  ,
-4.26133652217686  , 45.4885194450616  ,
-4.26137583330273  , 45.4886044375598  ,
-4.26140936091542  , 45.4886761028319  ,
-4.26139561459422  , 45.4887246340513  ,
-4.26134046167135  , 45.4887850675731  ,
-4.26104935817420  , 45.4890333395451  ,
-4.26098456606268  , 45.4892406240105  ,
-4.26106997765600  , 45.4895019717514  ,
-4.26133970730006  , 45.4899886250495  ,
-4.26154950633645  , 45.4904579278081  ,
-4.26170482300221  , 45.4907282441854  ,
-4.26196047104895  , 45.4909696429967  ,
-4.26224277354776  , 45.4911682941019  ,
-4.26271526142954  , 45.4915267042815  ,
-4.26283353008329  , 45.4916132055222  ,
-4.26305883564054  , 45.4914548713713  ,
-4.26304693333804  , 45.4914029035717  ,
-4.26304626278579  , 45.4913193359971  ,
-4.26310426555573  , 45.4912444856017  ,
-4.26326075568795  , 45.4911757539957  ,
-4.26334658637642  , 45.4911312460899  ,
-4.26343174651265  , 45.4910767637193  ,
-4.26364959217607  , 45.4909617640078  ,
-4.26377724856138  , 45.4909000732004  ,
-4.26390130072832  , 45.4908322636038  ,
-4.26401747390627  , 45.4907564073801  ,
-4.26412099041044  , 45.4906741809099  ,
-4.26421721465885  , 45.4905825667083  ,
-4.26431536674499  , 45.4904796369373  ,
-4.26442265510559  , 45.4903647210448  ,
-4.26453614607453  , 45.4902414232492  ,
-4.26464955322444  , 45.4901138506829  ,
-4.26474753767251  , 45.4899825900793  ,
-4.26482993178069  , 45.4898491501808  ,
-4.26499698311090  , 45.4895596392452  ,
-4.26509832032024  , 45.4894158057868  ,
-4.26520502194762  , 45.4892818629741  ,
-4.26541867665946  , 45.4890431463718  ,
-4.26564339548349  , 45.4887982271611  ,
-4.26575923338532  , 45.4886654578149  ,
-4.26588051952421  , 45.4885307606309  ,
-4.26612761802971  , 45.4882604442536  ,
-4.26638334989547  , 45.4879815783351  ,
-4.26663639955222  , 45.4877054784446  ,
-4.26685818471014  , 45.4874527640640  ,
-4.26698014140129  , 45.4873412009328  ,
-4.26711743697524  , 45.4872376006096  ,
-4.26725456491112  , 45.4871332459151  ,
-4.26737559959292  , 45.4870286397635  ,
-4.26747249439358  , 45.4869091138243  ,
-4.26755195483565  , 45.4867909289896  ,
-4.26763988099992  , 45.4866817127913  ,
-4.26774155348539  , 45.4865828063338  ,
-4.26785303279757  , 45.4864859115332  ,
-4.26797389984130  , 45.4863880947232  ,
-4.26809887401759  , 45.4862834047526  ,
-4.26822401583194  , 45.4861787147819  ,
-4.26835142076015  , 45.4860779643058  ,
-4.26848058588802  , 45.4859766270965  ,
-4.26861285232007  , 45.4858713503926  ,
-4.26874025724828  , 45.4857618827372  ,
-4.26886430941522  , 45.4856405127793  ,
-4.26912833936512  , 45.4853778239339  ,
-4.26926747895777  , 45.4852356668561  ,
-4.26941189914941  , 45.4850904922932  ,
-4.26956302486360  , 45.4849446471780  ,
-4.26971859298646  , 45.4847986344248  ,
-4.26987265236675  , 45.4846548009663  ,
-4.27002671174705  , 45.4845190141350  ,
-4.27018580026924  , 45.4843981470912  ,
-4.27035737782716  , 45.4842941276729  ,
-4.27054152823984  , 45.4842060338705  ,
-4.27073598839342  , 45.4841272439807  ,
-4.27093162201344  , 45.4840577580034  ,
-4.27130998112261  , 45.4839300177991  ,
-4.27166772074997  , 45.4838004335761  ,
-4.27213241346180  , 45.4836172051727  ,
-4.27240851335227  , 45.4834422748535  ,
-4.27264463156461  , 45.4832153767347  ,
-4.27286859601736  , 45.4829559568315  ,
-4.27310069091618  , 45.4826726485043  ,
-4.27322046831250  , 45.4825232829898  ,
-4.27334083244204  , 45.4823740851134  ,
-4.27346195094287  , 45.4822237975895  ,
-4.27357963286340  , 45.4820738453418  ,
-4.27368767559528  , 45.4819352086633  ,
-4.27378155291080  , 45.4818073008209  ,
-4.27386160008609  , 45.4816836677491  ,
-4.27392932586371  , 45.4815636388957  ,
-4.27404516376554  , 45.4813362378627  ,
-4.27408724091947  , 45.4812161251902  ,
-4.27413183264434  , 45.4810941684991  ,
-4.27418966777622  , 45.4809687752276  ,
-4.27427231334149  , 45.4808491654694  ,
-4.27437524311244  , 45.4807379376143  ,
-4.27457951009273  , 45.4805547930300  ,
-4.27504319697618  , 45.4802068602293  ,
-4.27551778033375  , 45.4798938799649  ,
-4.27580804564058  , 45.4797067120671  ,
-4.27632051520049  , 45.4793120920658  ,
-4.27642805501818  , 45.4791358206421  ,
-4.27650743164122  , 45.4789101798087  ,
-4.27661656402051  , 45.4785434715449  ,
-4.27665914408862  , 45.4784110374748  ,
-4.27671044133603  , 45.4782754182815  ,
-4.27676282823085  , 45.4781402181833  ,
-4.27685754373669  , 45.4778939578682  ,
-4.27692677825689  , 45.4777896031737  ,
-4.27699341438710  , 45.4776971507817  ,
-4.27704454399645  , 45.4776268266141  ,
-4.27707974798977  , 45.4775842465460  ,
-4.27711461670696  , 45.4775534849613  ,
-4.27720597945153  , 45.4774733539670  ,
-4.27738183178007  , 45.4772811569273  ,
-4.27750144153833  , 45.4771576914936  ,
-4.27762893028557  , 45.4770179651677  ,
-4.27775952033698  , 45.4768620617687  ,
-4.27804039791226  , 45.4765303060412  ,
-4.27819772623479  , 45.4763634223490  ,
-4.27837626077234  , 45.4761989694088  ,
-4.27857147529721  , 45.4760346841067  ,
-4.27877440117299  , 45.4758702311664  ,
-4.27897095680236  , 45.4757045209407  ,
-4.27914186380803  , 45.4755454324185  ,
-4.27929282188415  , 45.4753909539431  ,
-4.27942559123039  , 45.4752539936453  ,
-4.27954612299799  , 45.4751327913254  ,
-4.27965885959565  , 45.4750168696045  ,
-4.27977084182202  , 45.4749063123017  ,
-4.27999623119831  , 45.4746947530657  ,
-4.28020929917693  , 45.4744924139231  ,
-4.28030963055789  , 45.4743944294750  ,
-4.28039873018860  , 45.4743025638163  ,
-4.28047919645905  , 45.4742186609655  ,
-4.28055572323501  , 45.4741423018276  ,
-4.28062395192682  , 45.4740747436881  ,
-4.28067893721163  , 45.4740187525749  ,
-4.28071606904268  , 45.4739780165255  ,
-4.28073677234351  , 45.4739490989595  ,
-4.28075512871146  , 45.4739167448133  ,
-4.28075521253049  , 45.4739148169755  ,
-4.28066493943333  , 45.4738838039338  ,
-4.28048078902065  , 45.4738418105989  ,
-4.28028230555355  , 45.4737703967839  ,
-4.27992682904005  , 45.4735409840941  ,
-4.27984334528446  , 45.4734664689749  ,
-4.27972013130784  , 45.4733044467866  ,
-4.27967830561101  , 45.4732167720794  ,
-4.27956263534724  , 45.4729031212627  ,
-4.27943690679967  , 45.4726263508200  ,
-4.27922375500202  , 45.4723686072975  ,
-4.27895251661539  , 45.4721763264387  ,
-4.27862193435430  , 45.4720421321690  ,
-4.27823309786617  , 45.4719650186598  ,
-4.27802053280174  , 45.4719596542418  ,
-4.27736481651663  , 45.4720063414424  ,
-4.27675620652735  , 45.4720915853977  ,
-4.27606671117246  , 45.4723045695573  ,
-4.27536279894411  , 45.4725504107773  ,
-4.27461119368672  , 45.4726537596434  ,
-4.27393318153917  , 45.4727232456207  ,
-4.27374450489878  , 45.4727221559733  ,
-4.27337930537760  , 45.4726368281990  ,
-4.27320672199130  , 45.4725384246557  ,
-4.27303313277661  , 45.4724164679646  ,
-4.27285543642938  , 45.4722757358103  ,
-4.27234087139368  , 45.4719024058431  ,
-4.27216527052223  , 45.4718112945556  ,
-4.27196963690221  , 45.4717434011399  ,
-4.27149991504848  , 45.4716725740581  ,
-4.27078862674534  , 45.4715897608548  ,
-4.27042393013834  , 45.4714471008628  ,
-4.27008052356541  , 45.4712040256708  ,
-4.26952958106994  , 45.4707229044288  ,
-4.26936076954007  , 45.4705805797129  ,
-4.26891309209167  , 45.4702211637049  ,
-4.26875224336981  , 45.4701165575534  ,
-4.26857957616448  , 45.4700241051614  ,
-4.26839550957083  , 45.4699458181858  ,
-4.26798873580992  , 45.4698416311293  ,
-4.26754591986536  , 45.4698214307427  ,
-4.26706848666071  , 45.4698693752288  ,
-4.26657772623002  , 45.4699600674211  ,
-4.26612133160233  , 45.4700689483433  ,
-4.26572361029684  , 45.4702417831867  ,
-4.26539411768317  , 45.4704775661230  ,
-4.26525891758501  , 45.4706138558685  ,
-4.26501257345080  , 45.4708951525390  ,
-4.26488022319972  , 45.4710153490304  ,
-4.26473513245582  , 45.4711153451353  ,
-4.26456774584949  , 45.4711938835680  ,
-4.26438217051327  , 45.4712497070431  ,
-4.26418393850326  , 45.4712818097323  ,
-4.26398386247456  , 45.4712841566652  ,
-4.26378537900745  , 45.4712484497576  ,
-4.26359485834836  , 45.4711857531219  ,
-4.26340517587959  , 45.4711012635380  ,
-4.26321423612534  , 45.4709958191961  ,
-4.26283897832036  , 45.4707962460815  ,
-4.26247629337012  , 45.4706470482051  ,
-4.26227445714175  , 45.4706090781837  ,
-4.26205929368734  , 45.4705961700528  ,
-4.26162008196115  , 45.4706321284174  ,
-4.26120484247803  , 45.4707508161664  ,
-4.26101859658956  , 45.4708394128829  ,
-4.26085380837321  , 45.4709456954151  ,
-4.26058298908174  , 45.4712043609470  ,
-4.26039397716522  , 45.4715455044060  ,
-4.26017822697758  , 45.4720811080187  ,
-4.25993850454688  , 45.4723546933382  ,
-4.25958244130015  , 45.4725529253482  ,
-4.25915169529616  , 45.4726482275873  ,
-4.25867166370153  , 45.4726348165422  ,
-4.25813220441341  , 45.4725451301783  ,
-4.25740851089358  , 45.4724097624421  ,
-4.25720122642815  , 45.4723632428795  ,
-4.25700659863650  , 45.4723107721656  ,
-4.25681691616773  , 45.4722526017576  ,
-4.25643243826925  , 45.4721148870885  ,
-4.25607402808964  , 45.4719096980988  ,
-4.25574067980051  , 45.4716734960675  ,
-4.25532996654510  , 45.4712569154798  ,
-4.25500189885497  , 45.4707570187747  ,
-4.25472152419388  , 45.4703178070485  ,
-4.25446906127035  , 45.4698893241584  ,
-4.25440896302461  , 45.4697407130151  ,
-4.25433612428605  , 45.4694267269223  ,
-4.25423654727637  , 45.4689385648816  ,
-4.25420586951076  , 45.4687788896262  ,
-4.25411777570843  , 45.4683627281337  ,
-4.25403856672346  , 45.4681303817778  ,
-4.25388903357088  , 45.4679126199334  ,
-4.25368510186672  , 45.4676883202046  ,
-4.25345904193818  , 45.4674625955522  ,
-4.25332593731582  , 45.4673632699996  ,
-4.25316718406975  , 45.4672781936824  ,
-4.25278631038963  , 45.4671414010226  ,
-4.25238691270351  , 45.4670107271522  ,
-4.25202833488583  , 45.4668946377933  ,
-4.25185424275696  , 45.4668603558093  ,
-4.25167998299002  , 45.4668497107923  ,
-4.25151016563177  , 45.4668651334941  ,
-4.25120858475565  , 45.4669680632650  ,
-4.25095888786017  , 45.4671717435121  ,
-4.25083123147487  , 45.4672864079475  ,
-4.25069846212863  , 45.4674043413251  ,
-4.25056435167789  , 45.4675244539976  ,
-4.25044340081512  , 45.4676495958119  ,
-4.25035245716571  , 45.4677837900817  ,
-4.25029780715703  , 45.4679273720830  ,
-4.25027794204652  , 45.4680793359875  ,
-4.25029059872031  , 45.4682292882353  ,
-4.25034030340611  , 45.4683784022927  ,
-4.25041900947690  , 45.4685197211802  ,
-4.25049687735736  , 45.4686548374593  ,
-4.25054708495736  , 45.4687843378633  ,
-4.25055881962180  , 45.4689052049070  ,
-4.25053258426487  , 45.4690207075327  ,
-4.25046460703015  , 45.4691245593130  ,
-4.25035706721246  , 45.4692328535020  ,
-4.25023033283650  , 45.4693336877971  ,
-4.24998071976006  , 45.4695045109838  ,
-4.24972557462751  , 45.4695929400622  ,
-4.24944989383220  , 45.4695527069270  ,
-4.24934143200516  , 45.4694808740168  ,
-4.24928359687328  , 45.4693751782178  ,
-4.24928963184356  , 45.4692554008215  ,
-4.24934679642319  , 45.4691516328603  ,
-4.24945777282118  , 45.4690696578472  ,
-4.24959481693804  , 45.4690057877451  ,
-4.24972398206591  , 45.4689481202512  ,
-4.24983018077909  , 45.4688803106546  ,
-4.24991458654403  , 45.4686976689845  ,
-4.24978994764387  , 45.4685002751648  ,
-4.24959230236709  , 45.4683158732950  ,
-4.24948727712035  , 45.4681254364550  ,
-4.24945014528930  , 45.4679071716964  ,
-4.24942960962653  , 45.4676757473498  ,
-4.24930647946894  , 45.4674582369625  ,
-4.24908117391169  , 45.4672704823315  ,
-4.24883097410202  , 45.4670936241745  ,
-4.24869024194777  , 45.4670184385031  ,
-4.24853333272039  , 45.4669613577425  ,
-4.24817978404462  , 45.4669116530567  ,
-4.24781969748437  , 45.4669592622667  ,
-4.24749087542295  , 45.4670796263962  ,
-4.24720094539225  , 45.4672772716730  ,
-4.24673323519527  , 45.4676789324730  ,
-4.24621531739830  , 45.4680322296917  ,
-4.24607039429247  , 45.4681183956563  ,
-4.24578524194657  , 45.4682196490466  ,
-4.24547100439667  , 45.4682312160730  ,
-4.24514595419168  , 45.4681971855461  ,
-4.24498703330755  , 45.4682061541825  ,
-4.24485216848552  , 45.4682214092463  ,
-4.24474563449621  , 45.4682566970586  ,
-4.24460473470389  , 45.4683669190853  ,
-4.24445947632193  , 45.4687068052589  ,
-4.24433961510658  , 45.4688210505992  ,
-4.24412939697504  , 45.4689216334372  ,
-4.24412277527153  , 45.4689236450940  ,
-4.24406209029257  , 45.4689106531441  ,
-4.24390342086553  , 45.4688740242272  ,
-4.24368523992598  , 45.4688135068863  ,
-4.24306791275739  , 45.4686381574720  ,
-4.24290572293102  , 45.4685716889798  ,
-4.24263398163020  , 45.4683807492256  ,
-4.24233156256377  , 45.4681913182139  ,
-4.24193476326763  , 45.4680565372109  ,
-4.24150988459587  , 45.4679628275334  ,
-4.24114476889371  , 45.4678901564329  ,
-4.24099221825599  , 45.4678608197718  ,
-4.24086070619523  , 45.4678396135568  ,
-4.24075006507337  , 45.4678302258253  ,
-4.24059030599892  , 45.4678973648697  ,
-4.24060883000493  , 45.4679495841264  ,
-4.24085073173046  , 45.4680252727121  ,
-4.24115516245365  , 45.4681850317865  ,
-4.24129044637084  , 45.4682987742125  ,
-4.24157274886965  , 45.4686032887548  ,
-4.24186569638550  , 45.4689375590533  ,
-4.24198027700185  , 45.4691207036375  ,
-4.24207717180252  , 45.4693074524402  ,
-4.24216660670936  , 45.4695091210305  ,
-4.24225335940718  , 45.4697191715240  ,
-4.24233877100050  , 45.4699244443327  ,
-4.24242468550801  , 45.4701059125363  ,
-4.24252258613705  , 45.4702530987560  ,
-4.24264647066593  , 45.4703847784548  ,
-4.24280354753136  , 45.4705079924315  ,
-4.24299239180982  , 45.4706170409917  ,
-4.24319230020046  , 45.4707246646285  ,
-4.24337242729961  , 45.4708246607333  ,
-4.24350670538842  , 45.4709295183420  ,
-4.24359991215169  , 45.4710411652922  ,
-4.24366227351129  , 45.4711471963673  ,
-4.24369588494300  , 45.4712688177824  ,
-4.24369353801012  , 45.4714227095246  ,
-4.24365330487489  , 45.4715854022651  ,
-4.24357485026121  , 45.4717537108808  ,
-4.24336194992065  , 45.4721096903085  ,
-4.24312021583318  , 45.4725020471960  ,
-4.24299633130431  , 45.4727074876427  ,
-4.24287705682218  , 45.4729138500988  ,
-4.24276482313871  , 45.4731147643178  ,
-4.24266264773905  , 45.4732958134263  ,
-4.24250003881752  , 45.4735977295786  ,
-4.24238051287829  , 45.4738060198724  ,
-4.24231505021452  , 45.4739212710410  ,
-4.24224807880818  , 45.4739691317081  ,
-4.24216618761420  , 45.4739586543291  ,
-4.24211036413908  , 45.4739218577742  ,
-4.24205361865460  , 45.4738501086831  ,
-4.24195018596947  , 45.4735824745148  ,
-4.24192638136446  , 45.4732197895646  ,
-4.24193266779184  , 45.4728232417255  ,
-4.24192076548933  , 45.4726284462958  ,
-4.24188824370503  , 45.4724479001015  ,
-4.24183619208633  , 45.4722735565155  ,
-4.24168137833476  , 45.4719065129756  ,
-4.24158029258251  , 45.4717088676989  ,
-4.24147836863994  , 45.4715085402131  ,
-4.24137426540255  , 45.4713173490017  ,
-4.24113085493445  , 45.4709865991026  ,
-4.24081753939390  , 45.4707084875553  ,
-4.24062852747738  , 45.4705804958939  ,
-4.24018168821930  , 45.4703248478472  ,
-4.23996149562299  , 45.4701806791126  ,
-4.23959109932184  , 45.4698594845831  ,
-4.23932053148746  , 45.4695696383714  ,
-4.23905784264206  , 45.4692193586379  ,
-4.23895021900534  , 45.4691351205110  ,
-4.23881376162171  , 45.4690784588456  ,
-4.23847756348550  , 45.4690549895167  ,
-4.23831436783075  , 45.4691024310886  ,
-4.23818117938935  , 45.4691909439861  ,
-4.23799183219671  , 45.4694438260048  ,
-4.23766091465950  , 45.4699222650378  ,
-4.23728330992162  , 45.4701526835560  ,
-4.23708331771194  , 45.4702500812709  ,
-4.23691945150494  , 45.4703629855066  ,
-4.23677938990294  , 45.4704686813056  ,
-4.23636968247592  , 45.4708410892635  ,
-4.23627907410264  , 45.4709100723266  ,
-4.23611210659146  , 45.4709741100668  ,
-4.23601563088595  , 45.4710230603814  ,
-4.23607413657009  , 45.4711082205176  ,
-4.23614781349897  , 45.4711400717496  ,
-4.23674033023416  , 45.4713631980121  ,
-4.23685675486922  , 45.4714415688067  ,
-4.23696924000978  , 45.4715495277196  ,
-4.23707342706620  , 45.4716753400862  ,
-4.23716931603848  , 45.4717962909489  ,
-4.23725531436502  , 45.4719060938805  ,
-4.23732572235167  , 45.4719956126064  ,
-4.23738037236034  , 45.4720702115446  ,
-4.23741607926785  , 45.4721350036561  ,
-4.23744952306151  , 45.4722558706998  ,
-4.23747265711426  , 45.4723186511546  ,
-4.23756276257336  , 45.4725218284875  ,
-4.23760358244180  , 45.4726287815719  ,
-4.23785403370857  , 45.4729836713522  ,
-4.23802133649587  , 45.4730600304901  ,
-4.23820741474628  , 45.4730964917689  ,
-4.23830757848918  , 45.4731348808854  ,
-4.23841000534594  , 45.4731922969222  ,
-4.23859516158699  , 45.4733353760093  ,
-4.23882231116294  , 45.4736019205302  ,
-4.23897427506744  , 45.4738933593034  ,
-4.23906144686043  , 45.4740925971418  ,
-4.23908248543739  , 45.4742057528346  ,
-4.23908525146543  , 45.4743183217942  ,
-4.23905448988080  , 45.4745299648493  ,
-4.23895357176661  , 45.4747217427939  ,
-4.23883756622672  , 45.4748964216560  ,
-4.23868778161704  , 45.4751525726169  ,
-4.23861770890653  , 45.4753036983311  ,
-4.23857018351554  , 45.4754115734249  ,
-4.23854453489184  , 45.4754927940666  ,
-4.23852114938199  , 45.4755644593387  ,
-4.23847530037164  , 45.4756409861147  ,
-4.23846658319234  , 45.4756810516119  ,
-4.23845794983208  , 45.4757255595177  ,
-4.23844235949218  , 45.4757692292332  ,
-4.23843473196029  , 45.4758083727210  ,
-4.23844487406313  , 45.4758532159030  ,
-4.23849583603441  , 45.4759405553340  ,
-4.23851427622139  , 45.4759857337921  ,
-4.23852701671421  , 45.4760384559631  ,
-4.23853942193090  , 45.4760861489921  ,
-4.23857135698199  , 45.4762069322168  ,
-4.23859155736863  , 45.4762652702629  ,
-4.23861184157431  , 45.4763448145240  ,
-4.23865123651921  , 45.4764899052679  ,
-4.23867462202906  , 45.4765764065086  ,
-4.23870638944208  , 45.4766684398055  ,
-4.23880227841436  , 45.4768276121467  ,
-4.23889464698731  , 45.4769776482135  ,
-4.23897301778197  , 45.4771284386515  ,
-4.23903923481702  , 45.4772783908993  ,
-4.23906966112554  , 45.4773534927517  ,
-4.23909908160567  , 45.4774263314902  ,
-4.23916395753622  , 45.4775726795196  ,
-4.23923939466476  , 45.4777203686535  ,
-4.23927912488579  , 45.4777980688959  ,
-4.23932019621133  , 45.4778730031102  ,
-4.23934995196759  , 45.4779427405446  ,
-4.23936621285974  , 45.4780125617980  ,
-4.23940803855657  , 45.4781527910381  ,
-4.23946092836558  , 45.4783152323216  ,
-4.23950099386274  , 45.4784000571817  ,
-4.23955673351883  , 45.4784837923943  ,
-4.23962412402033  , 45.4785599000751  ,
-4.23976594582200  , 45.4787011351436  ,
-4.23982696607708  , 45.4787728004157  ,
-4.23997046425938  , 45.4790186416357  ,
-4.24018210731446  , 45.4793713521212  ,
-4.24039945006370  , 45.4797507170587  ,
-4.24049600958824  , 45.4799633659422  ,
-4.24031428992748  , 45.4800553154200  ,
-4.24009837210178  , 45.4801384638994  ,
-4.23992394469678  , 45.4801211971789  ,
-4.23980358056724  , 45.4800667148083  ,
-4.23964222893118  , 45.4800292477011  ,
-4.23955581150949  , 45.4800115618854  ,
-4.23937417566776  , 45.4799724183976  ,
-4.23885340802371  , 45.4798883479088  ,
-4.23849516548216  , 45.4798263218253  ,
-4.23834999091923  , 45.4798431694507  ,
-4.23811932094395  , 45.4798556584864  ,
-4.23798747360706  , 45.4797941353172  ,
-4.23778161406517  , 45.4796579293906  ,
-4.23718574456870  , 45.4796776268631  ,
-4.23690394498407  , 45.4796787165105  ,
-4.23643950372934  , 45.4797078017145  ,
-4.23632903024554  , 45.4797197040170  ,
-4.23613121733069  , 45.4797487054020  ,
-4.23590683378279  , 45.4797856695950  ,
-4.23579527065157  , 45.4797969013452  ,
-4.23567876219749  , 45.4798135813325  ,
-4.23547650687396  , 45.4798181075602  ,
-4.23535496927797  , 45.4798268247395  ,
-4.23528657294809  , 45.4798308480530  ,
-4.23520996235311  , 45.4798282496631  ,
-4.23514181748032  , 45.4798337817192  ,
-4.23493419773876  , 45.4798769485205  ,
-4.23466790467500  , 45.4799481946974  ,
-4.23399710096418  , 45.4801458399742  ,
-4.23391512595117  , 45.4801636934280  ,
-4.23375603742897  , 45.4802050162106  ,
-4.23356048762798  , 45.4802512843161  ,
-4.23339469358325  , 45.4803073592483  ,
-4.23320274800062  , 45.4803423117846  ,
-4.23303368501365  , 45.4803485143929  ,
-4.23286478966474  , 45.4803433176130  ,
-4.23266597092151  , 45.4803675413131  ,
-4.23221427015960  , 45.4804662801325  ,
-4.23192107118666  , 45.4805368557572  ,
-4.23169584944844  , 45.4806005582213  ,
-4.23141606152057  , 45.4806190822273  ,
-4.23117332160472  , 45.4806388635188  ,
-4.23077384009957  , 45.4806184116750  ,
-4.23032239079475  , 45.4805986303836  ,
-4.23003531061112  , 45.4805785138159  ,
-4.22983992844820  , 45.4805703833699  ,
-4.22979324124753  , 45.4805853869765  ,
-4.22976700589060  , 45.4806207586079  ,
-4.22974680550396  , 45.4807280469685  ,
-4.22966835089027  , 45.4807622451335  ,
-4.22947313636541  , 45.4807574674487  ,
-4.22922385856509  , 45.4807841219007  ,
-4.22896988689899  , 45.4808200802654  ,
-4.22872982919216  , 45.4808373469859  ,
-4.22860175371170  , 45.4808422084897  ,
-4.22846638597548  , 45.4808381013572  ,
-4.22800873406231  , 45.4807920008897  ,
-4.22739936970174  , 45.4806707147508  ,
-4.22676544636487  , 45.4803743306547  ,
-4.22624886967241  , 45.4801035951822  ,
-4.22603169456124  , 45.4800040181726  ,
-4.22579867765307  , 45.4800113942474  ,
-4.22506718896329  , 45.4802787769585  ,
-4.22487985342741  , 45.4803418926894  ,
-4.22416806221008  , 45.4805440641939  ,
-4.22366204671561  , 45.4806688707321  ,
-4.22333381138741  , 45.4807434696704  ,
-4.22299149446189  , 45.4807251971215  ,
-4.22297003678977  , 45.4804782662540  ,
-4.22282134182751  , 45.4802910983562  ,
-4.22269108705222  , 45.4801911022514  ,
-4.22255345620214  , 45.4800668824464  ,
-4.22241188585758  , 45.4799241386353  ,
-4.22215363942086  , 45.4795886948704  ,
-4.22204735688865  , 45.4794006049633  ,
-4.22186597250401  , 45.4790360759943  ,
-4.22169397585093  , 45.4787158872932  ,
-4.22153874300420  , 45.4784537013620  ,
-4.22145173884928  , 45.4783436469733  ,
-4.22118494287133  , 45.4780942015349  ,
-4.22096684575080  , 45.4780324269086  ,
-4.22086441889405  , 45.4780361149460  ,
-4.22063651494681  , 45.4780683852732  ,
-4.22060097567737  , 45.4780253022909  ,
-4.22063986770808  , 45.4779181815683  ,
-4.22065336257219  , 45.4778515454381  ,
-4.22065126709640  , 45.4777777846902  ,
-4.22062788158655  , 45.4775757808238  ,
-4.22059888020157  , 45.4773295205086  ,
-4.22056065872311  , 45.4771969188004  ,
-4.22051958739757  , 45.4770628921687  ,
-4.22049460932612  , 45.4769274406135  ,
-4.22048237174749  , 45.4767894744873  ,
-4.22047122381627  , 45.4766579624265  ,
-4.22047172673046  , 45.4764174018055  ,
-4.22050743363797  , 45.4761870671063  ,
-4.22051883302628  , 45.4760731570422  ,
-4.22050626017153  , 45.4759609233587  ,
-4.22046862542629  , 45.4758478514850  ,
-4.22038304619491  , 45.4756168462336  ,
-4.22036510892212  , 45.4753599409013  ,
-4.22041380777955  , 45.4751110821962  ,
-4.22045596875250  , 45.4749138560146  ,
-4.22044733539223  , 45.4748446214944  ,
-4.22045211307704  , 45.4747784882783  ,
-4.22046686522662  , 45.4747107625007  ,
-4.22046544030308  , 45.4746457189321  ,
-4.22045437619090  , 45.4745810944586  ,
-4.22045848332345  , 45.4745216667652  ,
-4.22048069536685  , 45.4744631610810  ,
-4.22050676308572  , 45.4744030628353  ,
-4.22053744085133  , 45.4743418749421  ,
-4.22056577168405  , 45.4742784239351  ,
-4.22058521769940  , 45.4742105305194  ,
-4.22061095014214  , 45.4740704689174  ,
-4.22065361402928  , 45.4739335086196  ,
-4.22069661319255  , 45.4737957939505  ,
-4.22072787769138  , 45.4737184289842  ,
-4.22077867202460  , 45.4736413154751  ,
-4.22089417465031  , 45.4734890162944  ,
-4.22093080356717  , 45.4734117351472  ,
-4.22094765119254  , 45.4733373038470  ,
-4.22096407972276  , 45.4732716735452  ,
-4.22099132090806  , 45.4732145927846  ,
-4.22102208249270  , 45.4731584340333  ,
-4.22104672528803  , 45.4731052927672  ,
-4.22106499783694  , 45.4730587732046  ,
-4.22107145190238  , 45.4729664046317  ,
-4.22107170335948  , 45.4729147721081  ,
-4.22109978273510  , 45.4728519916534  ,
-4.22122593037784  , 45.4725885484367  ,
-4.22125702723860  , 45.4723675176501  ,
-4.22137160785496  , 45.4721486661583  ,
-4.22146288678050  , 45.4719749093055  ,
-4.22151074744760  , 45.4718391224741  ,
-4.22163010574877  , 45.4717475920915  ,
-4.22184795141220  , 45.4715955443680  ,
-4.22199186868965  , 45.4714735038578  ,
-4.22209027223289  , 45.4712695721536  ,
-4.22214299440383  , 45.4708334617316  ,
-4.22212027944624  , 45.4704981017857  ,
-4.22209354117512  , 45.4701066669076  ,
-4.22217275016009  , 45.4699225164949  ,
-4.22231649979948  , 45.4696712270379  ,
-4.22245019115507  , 45.4694696422666  ,
-4.22249319031834  , 45.4694053530693  ,
-4.22253694385290  , 45.4693454224616  ,
-4.22261749394237  , 45.4692072886973  ,
-4.22271975316107  , 45.4690162651240  ,
-4.22283156774938  , 45.4688064660876  ,
-4.22301555052399  , 45.4684893786907  ,
-4.22306894324719  , 45.4684196412563  ,
-4.22312946058809  , 45.4683514963835  ,
-4.22326591797173  , 45.4682178888469  ,
-4.22339223325252  , 45.4680665116757  ,
-4.22350748442113  , 45.4679114464670  ,
-4.22361611388623  , 45.4677646793425  ,
-4.22370496205985  , 45.4676606599241  ,
-4.22382289543747  , 45.4676075186580  ,
-4.22376162372529  , 45.4673924390226  ,
-4.22378626652061  , 45.4672149103134  ,
-4.22383680939674  , 45.4670978151261  ,
-4.22393462620675  , 45.4668831545859  ,
-4.22401115298271  , 45.4667942225933  ,
-4.22409228980541  , 45.4667057096958  ,
-4.22414895147085  , 45.4666073061525  ,
-4.22418633475899  , 45.4664928931742  ,
-4.22422229312360  , 45.4663639795035  ,
-4.22424567863345  , 45.4662327188998  ,
-4.22425883822143  , 45.4661033023148  ,
-4.22426017932593  , 45.4659833572804  ,
-4.22425263561308  , 45.4658830258995  ,
-4.22424576245248  , 45.4657980334013  ,
-4.22422598116099  , 45.4656684491783  ,
-4.22416688874363  , 45.4651830531656  ,
-4.22415029257535  , 45.4651035927236  ,
-4.22409195452928  , 45.4649158380925  ,
-4.22406521625816  , 45.4647914506494  ,
-4.22403604723513  , 45.4646582622081  ,
-4.22398885712027  , 45.4644063860177  ,
-4.22393705695867  , 45.4642931465059  ,
-4.22388668172061  , 45.4641943238675  ,
-4.22385072335600  , 45.4640994407236  ,
-4.22383848577737  , 45.4640019591897  ,
-4.22384661622345  , 45.4639085009694  ,
-4.22384351491928  , 45.4638150427490  ,
-4.22383664175868  , 45.4637238476425  ,
-4.22382775694131  , 45.4636319819837  ,
-4.22379003837704  , 45.4635452292859  ,
-4.22372692264616  , 45.4634652659296  ,
-4.22367101535201  , 45.4633783455938  ,
-4.22363271005451  , 45.4632784333080  ,
-4.22359800897538  , 45.4631760902702  ,
-4.22352341003715  , 45.4629781935364  ,
-4.22346272505819  , 45.4626877605915  ,
-4.22346381470561  , 45.4623950645327  ,
-4.22348652966320  , 45.4622182063758  ,
-4.22350128181278  , 45.4621298611164  ,
-4.22349549829959  , 45.4619460459798  ,
-4.22347496263682  , 45.4618513304740  ,
-4.22344319522380  , 45.4617545194923  ,
-4.22339575365185  , 45.4616580437868  ,
-4.22334847971796  , 45.4615681059658  ,
-4.22331461682915  , 45.4614888969808  ,
-4.22329617664217  , 45.4613350052386  ,
-4.22339382581412  , 45.4609131440520  ,
-4.22339977696537  , 45.4608273133635  ,
-4.22338393516838  , 45.4607356153428  ,
-4.22325761988759  , 45.4602999240159  ,
-4.22316751442849  , 45.4598533362150  ,
-4.22299828380346  , 45.4594818502664  ,
-4.22278345562517  , 45.4590765852481  ,
-4.22261254861950  , 45.4585997387766  ,
-4.22258924692869  , 45.4584992397576  ,
-4.22255563549697  , 45.4580353852361  ,
-4.22257483005523  , 45.4578717704862  ,
-4.22249997965991  , 45.4577767197042  ,
-4.22200335189700  , 45.4575632326304  ,
-4.22185851261019  , 45.4575235862284  ,
-4.22170805744826  , 45.4575064033269  ,
-4.22140941023826  , 45.4574962612241  ,
-4.22128175385296  , 45.4574779048562  ,
-4.22116474248468  , 45.4574473947286  ,
-4.22105158679187  , 45.4573988635092  ,
-4.22083357349038  , 45.4572557006031  ,
-4.22063961625099  , 45.4570665210485  ,
-4.22047960571944  , 45.4567526187747  ,
-4.22031037509441  , 45.4564715735614  ,
-4.22022320330142  , 45.4563903529196  ,
-4.22012966126203  , 45.4563019238412  ,
-4.21983059495687  , 45.4561585094779  ,
-4.21966572292149  , 45.4561465233564  ,
-4.21969824470579  , 45.4564082901924  ,
-4.21972942538559  , 45.4566407203674  ,
-4.21972582116723  , 45.4567435663193  ,
-4.21970444731414  , 45.4568980447947  ,
-4.21967946924269  , 45.4570412915199  ,
-4.21965256333351  , 45.4571821074932  ,
-4.21962917782366  , 45.4573323111981  ,
-4.21962389722466  , 45.4574423655867  ,
-4.21968349255621  , 45.4576687607914  ,
-4.21975616365671  , 45.4579797293990  ,
-4.21976001933217  , 45.4582659713923  ,
-4.21972800046205  , 45.4584024287760  ,
-4.21967988833785  , 45.4585618525743  ,
-4.21960503794252  , 45.4587054345756  ,
-4.21949481591582  , 45.4587921034544  ,
-4.21934737823903  , 45.4588686302304  ,
-4.21912022866308  , 45.4591205902397  ,
-4.21871538273990  , 45.4593084286898  ,
-4.21827156096696  , 45.4594714567065  ,
-4.21805002726614  , 45.4595288727432  ,
-4.21783369034528  , 45.4595580417662  ,
-4.21761852689087  , 45.4595746379345  ,
-4.21740428544580  , 45.4595752246677  ,
-4.21718861907720  , 45.4595557786524  ,
-4.21697731129825  , 45.4595358297228  ,
-4.21678134240210  , 45.4594986978918  ,
-4.21660347841680  , 45.4594429582357  ,
-4.21644866466522  , 45.4593955166637  ,
-4.21632201410830  , 45.4593421239405  ,
-4.21622252091765  , 45.4592857137322  ,
-4.21608874574303  , 45.4591387789696  ,
-4.21592806465923  , 45.4586425703018  ,
-4.21588892117142  , 45.4585419874638  ,
-4.21555138193070  , 45.4580587707459  ,
-4.21531316824257  , 45.4576505720615  ,
-4.21525742858648  , 45.4572012182325  ,
-4.21508543193340  , 45.4570292215794  ,
-4.21481855213642  , 45.4569162335246  ,
-4.21470212750136  , 45.4568594880402  ,
-4.21456567011773  , 45.4566880781203  ,
-4.21452040784060  , 45.4564532171934  ,
-4.21460975892841  , 45.4559975769370  ,
-4.21467203646898  , 45.4557172860950  ,
-4.21467857435345  , 45.4552088398486  ,
-4.21468704007565  , 45.4547971207648  ,
-4.21458771452307  , 45.4544196836650  ,
-4.21441823244094  , 45.4539603553712  ,
-4.21418328769505  , 45.4533622227609  ,
-4.21392831020057  , 45.4527365975081  ,
-4.21385253779590  , 45.4525657743215  ,
-4.21378347091376  , 45.4524221085011  ,
-4.21372278593480  , 45.4523024149239  ,
-4.21362781897187  , 45.4521196894347  ,
-4.21359043568372  , 45.4520591720938  ,
-4.21349789947271  , 45.4520185198634  ,
-4.21346470713615  , 45.4520234651863  ,
-4.21343838796019  , 45.4520419053733  ,
-4.21340670436620  , 45.4520643688738  ,
-4.21327871270477  , 45.4521157499402  ,
-4.21270798891782  , 45.4523423127830  ,
-4.21203525736927  , 45.4526492580771  ,
-4.21168489381670  , 45.4528955183923  ,
-4.21136830933392  , 45.4531296249479  ,
-4.21092348173260  , 45.4534439463168  ,
-4.21064151450991  , 45.4536104947328  ,
-4.21044101938605  , 45.4537067189812  ,
-4.21024295501410  , 45.4537509754300  ,
-4.21007456257939  , 45.4537146817892  ,
-4.20991572551429  , 45.4536477103829  ,
-4.20949109829962  , 45.4535044636577  ,
-4.20913335867226  , 45.4534729477018  ,
-4.20907082967460  , 45.4534899629652  ,
-4.20901416800916  , 45.4535163659602  ,
-4.20884124934673  , 45.4536389093846  ,
-4.20869247056543  , 45.4537025280296  ,
-4.20851116999983  , 45.4537330381572  ,
-4.20809199102222  , 45.4537109099328  ,
-4.20796626247465  , 45.4537109937518  ,
-4.20794589444994  , 45.4537597764283  ,
-4.20798059552907  , 45.4537939745932  ,
-4.20802560634911  , 45.4538246523588  ,
-4.20807363465428  , 45.4538779612630  ,
-4.20815326273441  , 45.4539896920323  ,
-4.20818058773875  , 45.4541029315441  ,
-4.20811587944626  , 45.4543027561157  ,
-4.20799844898283  , 45.4544532950967  ,
-4.20791278593242  , 45.4545212723314  ,
-4.20781438238918  , 45.4545798618346  ,
-4.20769871212542  , 45.4546332545578  ,
-4.20745689421892  , 45.4547029919922  ,
-4.20721356756985  , 45.4547846317291  ,
-4.20677678659558  , 45.4549509286880  ,
-4.20622425153851  , 45.4551833588629  ,
-4.20607924461364  , 45.4552444629371  ,
-4.20547616668045  , 45.4554919805377  ,
-4.20516335405409  , 45.4555983468890  ,
-4.20500728301703  , 45.4556467942893  ,
-4.20485909096896  , 45.4556924756616  ,
-4.20460553839802  , 45.4557688347995  ,
-4.20440671965479  , 45.4558142647147  ,
-4.20412374660372  , 45.4558549169450  ,
-4.20386960729956  , 45.4558777995407  ,
-4.20377237722277  , 45.4558843374252  ,
-4.20368428342044  , 45.4558886121958  ,
-4.20355134643614  , 45.4558951500803  ,
-4.20355251990258  , 45.4558946471661  ,
-4.20348990708589  , 45.4558917973190  ,
-4.20338479802012  , 45.4559056274592  ,
-4.20306695625185  , 45.4559311084449  ,
-4.20305924490094  , 45.4559140931814  ,
-4.20313250273466  , 45.4559233132749  ,
-4.20357137918472  , 45.4558815713971  ,
-4.20420907437801  , 45.4558311961591  ,
-4.20433019287884  , 45.4558142647147  ,
-4.20445499941706  , 45.4557944834232  ,
-4.20449162833392  , 45.4558048769831  ,
-4.20440512709319  , 45.4558700881898  ,
-4.20427260920405  , 45.4559244867414  ,
-4.20398309826850  , 45.4561411589384  ,
-4.20388561673462  , 45.4562242235988  ,
-4.20384429395198  , 45.4562680609524  ,
-4.20380473136901  , 45.4563196934759  ,
-4.20376935973763  , 45.4563795402646  ,
-4.20374312438070  , 45.4564460925757  ,
-4.20371831394731  , 45.4565952904522  ,
-4.20370607636868  , 45.4567594081163  ,
-4.20356106944382  , 45.4570916667580  ,
-4.20343022793531  , 45.4574085026979  ,
-4.20342335477471  , 45.4574831854552  ,
-4.20341346412897  , 45.4575546830892  ,
-4.20336644165217  , 45.4576840158551  ,
-4.20333266258239  , 45.4577608779072  ,
-4.20333425514400  , 45.4577934835106  ,
-4.20331497676670  , 45.4578073974698  ,
-4.20327994041144  , 45.4578757937997  ,
-4.20326074585318  , 45.4579840041697  ,
-4.20320668257772  , 45.4582747723907  ,
-4.20316468924283  , 45.4583751875907  ,
-4.20316259376704  , 45.4583932086825  ,
-4.20316309668123  , 45.4584276583045  ,
-4.20315731316804  , 45.4584668856114  ,
-4.20309277251362  , 45.4587655328214  ,
-4.20307240448892  , 45.4588781856000  ,
-4.20299277640879  , 45.4590724781155  ,
-4.20291532762348  , 45.4592217598110  ,
-4.20286503620445  , 45.4593151342123  ,
-4.20278456993401  , 45.4594528488814  ,
-4.20275573618710  , 45.4594993684440  ,
-4.20270108617842  , 45.4595899768173  ,
-4.20257653109729  , 45.4597394261509  ,
-4.20241585001349  , 45.4599073156714  ,
-4.20231216587126  , 45.4600199684500  ,
-4.20222222805023  , 45.4601570125669  ,
-4.20213681645691  , 45.4602912068367  ,
-4.20206263661384  , 45.4604140017181  ,
-4.20194570906460  , 45.4605979844927  ,
-4.20174303464591  , 45.4608833044767  ,
-4.20143944211304  , 45.4612749908119  ,
-4.20117901638150  , 45.4616078361868  ,
-4.20093434862792  , 45.4620430245995  ,
-4.20088162645697  , 45.4621832538396  ,
-4.20075614936649  , 45.4624549951404  ,
-4.20067048631608  , 45.4625902790576  ,
-4.20061843469738  , 45.4626538138836  ,
-4.20050385408103  , 45.4627700708806  ,
-4.20023244805634  , 45.4629929456859  ,
-4.20007092878222  , 45.4631068557500  ,
-4.19992642477154  , 45.4632038343697  ,
-4.19987898319959  , 45.4632423073053  ,
-4.19985140673816  , 45.4632792714983  ,
-4.19984696432948  , 45.4633158165961  ,
-4.19988535344600  , 45.4633916728198  ,
-4.19995425269007  , 45.4634984582662  ,
-4.19996950775384  , 45.4635366797447  ,
-4.19998199678957  , 45.4635674413293  ,
-4.20000923797488  , 45.4636498354375  ,
-4.20004754327237  , 45.4637525975704  ,
-4.20005843974649  , 45.4637965187430  ,
-4.20007310807704  , 45.4638947546482  ,
-4.20010713860392  , 45.4640668351203  ,
-4.20012742280960  , 45.4641918931156  ,
-4.20015189796686  , 45.4643108323216  ,
-4.20023630373179  , 45.4644245747476  ,
-4.20029598288238  , 45.4644772130995  ,
-4.20047108083963  , 45.4646332841366  ,
-4.20054417103528  , 45.4647410754114  ,
-4.20057828538119  , 45.4649281594902  ,
-4.20054718852043  , 45.4651972185820  ,
-4.20053369365632  , 45.4652504436671  ,
-4.20048063620924  , 45.4653558041900  ,
-4.20042615383863  , 45.4654682055115  ,
-4.20034786686301  , 45.4656425490975  ,
-4.20027586631476  , 45.4658018052577  ,
-4.20023244805634  , 45.4659024719148  ,
-4.20020336285233  , 45.4660074971616  ,
-4.20020327903330  , 45.4660575371235  ,
-4.20022381469607  , 45.4661531746387  ,
-4.20024527236819  , 45.4662268515676  ,
-4.20028047636151  , 45.4662462137639  ,
-4.20032816939055  , 45.4662501532584  ,
-4.20042984187602  , 45.4661801643669  ,
-4.20050024986267  , 45.4661102592945  ,
-4.20087567530572  , 45.4657541960477  ,
-4.20115328393876  , 45.4655243642628  ,
-4.20126124285161  , 45.4654402099549  ,
-4.20135428197681  , 45.4653900023549  ,
-4.20144178904592  , 45.4653547145426  ,
-4.20153910294175  , 45.4653387051075  ,
-4.20162032358348  , 45.4653672035783  ,
-4.20166977681219  , 45.4654443170875  ,
-4.20165049843490  , 45.4656706284731  ,
-4.20163415372371  , 45.4658086784183  ,
-4.20171814039349  , 45.4662572778761  ,
-4.20190807431936  , 45.4667795542627  ,
-4.20195677317678  , 45.4668701626360  ,
-4.20203447341918  , 45.4669516347348  ,
-4.20214092358946  , 45.4670267365872  ,
-4.20226120389997  , 45.4671023413538  ,
-4.20251333154737  , 45.4672892577946  ,
-4.20278641395270  , 45.4675254598259  ,
-4.20302881859242  , 45.4677423834800  ,
-4.20321254990994  , 45.4679036512970  ,
-4.20330047607421  , 45.4679677728563  ,
-4.20339913107454  , 45.4680303018540  ,
-4.20351002365350  , 45.4680931661278  ,
-4.20374907553195  , 45.4682008735835  ,
-4.20435165055096  , 45.4684012848883  ,
-4.20452398248016  , 45.4684663284569  ,
-4.20487057417631  , 45.4686267580837  ,
-4.20518388971686  , 45.4688387364149  ,
-4.20556333847343  , 45.4692262317985  ,
-4.20568705536425  , 45.4693475179374  ,
-4.20616063289344  , 45.4698053374886  ,
-4.20639096759259  , 45.4700060002505  ,
-4.20663203112781  , 45.4701955150812  ,
-4.20675113797187  , 45.4702971037477  ,
-4.20685985125601  , 45.4704105108976  ,
-4.20695641078054  , 45.4705388378351  ,
-4.20704727061092  , 45.4706763010472  ,
-4.20713771134614  , 45.4708144348114  ,
-4.20722555369138  , 45.4709446895867  ,
-4.20730727724730  , 45.4710627067834  ,
-4.20745748095214  , 45.4712657164782  ,
-4.20759310014545  , 45.4714655410498  ,
-4.20779032632708  , 45.4717905912548  ,
-4.20795159414410  , 45.4719940200448  ,
-4.20810079202055  , 45.4721743986010  ,
-4.20822358690202  , 45.4723569564521  ,
-4.20828938484191  , 45.4725417774170  ,
-4.20830690301954  , 45.4727122653275  ,
-4.20830581337213  , 45.4730011057108  ,
-4.20835090801119  , 45.4731286782771  ,
-4.20839927159249  , 45.4731884412467  ,
-4.20846850611269  , 45.4732403252273  ,
-4.20865173451602  , 45.4733218811452  ,
-4.20885918661952  , 45.4734027665108  ,
-4.20906487852334  , 45.4735162574797  ,
-4.20928196981549  , 45.4736541397869  ,
-4.20952169224619  , 45.4738177545368  ,
-4.20981061644852  , 45.4740041680634  ,
-4.21011068858206  , 45.4741770029067  ,
-4.21036524698138  , 45.4743425454944  ,
-4.21047664247453  , 45.4744449723511  ,
-4.21083513647317  , 45.4749421868473  ,
-4.21104946173727  , 45.4752532392740  ,
-4.21110453084111  , 45.4753668140619  ,
-4.21125607565045  , 45.4757456760853  ,
-4.21139974147081  , 45.4759802855551  ,
-4.21148096211254  , 45.4760868195444  ,
-4.21155421994626  , 45.4761925153434  ,
-4.21161658130586  , 45.4762990493327  ,
-4.21166620217263  , 45.4764054156839  ,
-4.21170157380402  , 45.4765125364065  ,
-4.21172428876161  , 45.4766209982335  ,
-4.21174289658665  , 45.4767325613647  ,
-4.21177206560969  , 45.4768480639904  ,
-4.21182705089449  , 45.4769704397767  ,
-4.21191321685910  , 45.4771002754569  ,
-4.21202000230550  , 45.4772347211837  ,
-4.21236206777393  , 45.4775987472385  ,
-4.21246876940131  , 45.4777132440358  ,
-4.21257538720965  , 45.4778244718909  ,
-4.21268326230347  , 45.4779258929193  ,
-4.21288551762700  , 45.4781126417219  ,
-4.21298157423734  , 45.4781983047723  ,
-4.21307838521897  , 45.4782846383750  ,
-4.21317838132381  , 45.4783697985112  ,
-4.21328466385602  , 45.4784491751343  ,
-4.21340025030076  , 45.4785184934735  ,
-4.21352748759090  , 45.4785869736224  ,
-4.21365346759557  , 45.4786653444170  ,
-4.21385060995817  , 45.4788774065673  ,
-4.21396477147936  , 45.4791286122053  ,
-4.21414959244430  , 45.4793358128517  ,
-4.21440540812909  , 45.4794858489185  ,
-4.21476013027131  , 45.4796425905078  ,
-4.21488560736179  , 45.4797830712050  ,
-4.21491385437548  , 45.4798492044210  ,
-4.21495978720486  , 45.4799546487629  ,
-4.21492684632539  , 45.4800210334360  ,
-4.21483866870403  , 45.4800487775355  ,
-4.21478083357214  , 45.4800487775355  ,
-4.21411388553678  , 45.4800059460103  ,
-4.21384734101593  , 45.4799423273652  ,
-4.21364458277821  , 45.4798060376197  ,
-4.21346613205969  , 45.4796637129038  ,
-4.21324459835886  , 45.4795877728611  ,
-4.21297277323901  , 45.4795701708644  ,
-4.21265023760497  , 45.4796671494841  ,
-4.21244865283370  , 45.4797580093145  ,
-4.21165446750819  , 45.4800041858106  ,
-4.21101191081106  , 45.4801569879055  ,
-4.21039030887186  , 45.4802948702126  ,
-4.20956276357173  , 45.4805008135735  ,
-4.20910812914371  , 45.4806156456470  ,
-4.20890159904956  , 45.4806616622954  ,
-4.20871149748563  , 45.4807047452777  ,
-4.20837270095944  , 45.4807872232049  ,
-4.20822685584425  , 45.4808344971388  ,
-4.20809433795511  , 45.4808875545859  ,
-4.20797615312039  , 45.4809500835835  ,
-4.20776283368468  , 45.4810867086052  ,
-4.20755638740956  , 45.4812110960483  ,
-4.20719504356384  , 45.4814127646386  ,
-4.20697510242462  , 45.4816167801618  ,
-4.20681827701628  , 45.4818080551922  ,
-4.20647294260561  , 45.4821616876870  ,
-4.20654745772480  , 45.4821181017905  ,
-4.20664410106837  , 45.4820657987147  ,
-4.20675289817154  , 45.4819522239267  ,
-4.20714869163930  , 45.4814902972429  ,
-4.20725421980023  , 45.4813966713845  ,
-4.20778680592775  , 45.4810802545398  ,
-4.20816323719918  , 45.4808589722961  ,
-4.20848116278648  , 45.4807591438293  ,
-4.20913629233837  , 45.4806158132851  ,
-4.20973442494869  , 45.4804750811308  ,
-4.21033523976802  , 45.4803236201405  ,
-4.21082608401775  , 45.4802051000297  ,
-4.21130611561238  , 45.4800870828330  ,
-4.21170006506145  , 45.4799940437078  ,
-4.21233063563704  , 45.4798382241278  ,
-4.21296590007841  , 45.4796451888978  ,
-4.21309674158692  , 45.4796153493225  ,
-4.21335892751812  , 45.4796005133539  ,
-4.21357249841094  , 45.4796591028571  ,
-4.21366612426936  , 45.4797213803976  ,
-4.21374969184398  , 45.4798006732016  ,
-4.21397927217185  , 45.4799275752156  ,
-4.21427506953477  , 45.4799889307469  ,
-4.21486800536513  , 45.4800039343535  ,
-4.21493740752339  , 45.4800002463161  ,
-4.21496213413774  , 45.4800060298293  ,
-4.21502449549734  , 45.4800856579095  ,
-4.21512935310602  , 45.4802385438233  ,
-4.21556630171835  , 45.4805222712457  ,
-4.21604281291365  , 45.4806578904390  ,
-4.21683875843882  , 45.4807703755795  ,
-4.21728668734431  , 45.4808326531201  ,
-4.21770678833127  , 45.4809090960770  ,
-4.21809964813292  , 45.4809718765318  ,
-4.21879635192453  , 45.4810116067528  ,
-4.21920999884605  , 45.4810189828276  ,
-4.21979245729744  , 45.4810295440256  ,
-4.21989496797323  , 45.4810121096670  ,
-4.21986890025436  , 45.4808934219181  ,
-4.21951778233051  , 45.4805589001625  ,
-4.21930672600865  , 45.4802114702761  ,
-4.21915174461901  , 45.4798546526581  ,
-4.21911017037928  , 45.4795428458601  ,
-4.21905962750315  , 45.4793250001966  ,
-4.21904227696359  , 45.4792186338454  ,
-4.21903716400265  , 45.4791159555315  ,
-4.21903842128813  , 45.4790173005312  ,
-4.21904227696359  , 45.4789282009005  ,
-4.21905535273253  , 45.4788451362401  ,
-4.21908795833587  , 45.4787661787122  ,
-4.21915283426642  , 45.4787024762481  ,
-4.21924042515456  , 45.4786505922675  ,
-4.21933447010815  , 45.4786090180277  ,
-4.21942910179495  , 45.4785718861967  ,
-4.21952356584370  , 45.4785321559756  ,
-4.21972188167273  , 45.4784608259797  ,
-4.21983218751847  , 45.4784373566508  ,
-4.21994291245937  , 45.4784241132438  ,
-4.22014181502163  , 45.4783951118588  ,
-4.22023661434650  , 45.4783675353974  ,
-4.22037885524332  , 45.4782654438167  ,
-4.22049972228705  , 45.4781546350568  ,
-4.22061170451343  , 45.4780538845807  ,
-4.22064917162060  , 45.4779812972992  ,
-4.22067725099623  , 45.4778916947543  ,
-4.22067943029105  , 45.4777867533266  ,
-4.22064120881259  , 45.4775492101907  ,
-4.22062008641660  , 45.4774188715964  ,
-4.22059929929673  , 45.4772958252578  ,
-4.22056987881660  , 45.4771865252405  ,
-4.22053283080458  , 45.4770815838128  ,
-4.22050366178154  , 45.4769657459110  ,
-4.22048212029039  , 45.4766978602856  ,
-4.22047122381627  , 45.4765683598816  ,
-4.22047130763530  , 45.4764469899237  ,
-4.22048941254615  , 45.4763329122215  ,
-4.22052528709173  , 45.4761092830449  ,
-4.22052050940692  , 45.4760030005127  ,
-4.22049066983163  , 45.4759092908352  ,
-4.22040718607604  , 45.4757269006222  ,
-4.22038002870976  , 45.4756239708513  ,
-4.22036737203598  , 45.4755156766623  ,
-4.22037608921527  , 45.4752940591424  ,
-4.22039243392646  , 45.4751922190189  ,
-4.22044700011610  , 45.4750058054924  ,
-4.22044406644999  , 45.4748640675097  ,
-4.22043878585100  , 45.4748100042343  ,
-4.22044700011610  , 45.4747576173394  ,
-4.22045571729540  , 45.4747020453214  ,
-4.22045253217220  , 45.4746437072753  ,
-4.22044683247804  , 45.4745867941528  ,
-4.22044926322996  , 45.4745308030396  ,
-4.22046166844666  , 45.4744717944413  ,
-4.22048438340425  , 45.4744106903672  ,
-4.22051480971276  , 45.4743501730263  ,
-4.22056937590241  , 45.4742210078984  ,
-4.22060231678187  , 45.4740922618657  ,
-4.22063626348972  , 45.4739738255739  ,
-4.22068756073713  , 45.4738598316907  ,
-4.22072301618754  , 45.4737277328968  ,
-4.22081991098821  , 45.4735931195318  ,
-4.22091705724596  , 45.4734523873776  ,
-4.22096910886466  , 45.4733158461749  ,
-4.22101940028369  , 45.4732030257582  ,
-4.22103716991841  , 45.4731532372534  ,
-4.22105569392442  , 45.4731014370918  ,
-4.22106625512242  , 45.4730482958257  ,
-4.22106617130339  , 45.4729612916707  ,
-4.22107161954045  , 45.4729144368320  ,
-4.22109718434512  , 45.4728643130511  ,
-4.22121956013143  , 45.4726573638617  ,
-4.22125836834311  , 45.4724458046257  ,
-4.22127337194979  , 45.4724022187292  ,
-4.22133229672908  , 45.4722725506871  ,
-4.22137135639786  , 45.4722151346504  ,
-4.22145475633442  , 45.4720840416848  ,
-4.22146389260888  , 45.4720159806311  ,
-4.22148794867098  , 45.4719540383666  ,
-4.22168735414743  , 45.4718259628862  ,
-4.22196001745760  , 45.4716105479747  ,
-4.22205473296344  , 45.4714364558458  ,
-4.22210519202053  , 45.4712238069623  ,
-4.22213578596711  , 45.4707545880228  ,
-4.22207384370267  , 45.4702790826559  ,
-4.22206655144691  , 45.4701806791126  ,
-4.22230057418346  , 45.4696889128535  ,
-4.22243024222552  , 45.4694580752402  ,
-4.22246762551367  , 45.4693908523768  ,
-4.22256108373403  , 45.4692703206092  ,
-4.22264649532735  , 45.4691237211227  ,
-4.22274917364120  , 45.4689460247755  ,
-4.22285118140280  , 45.4687511455267  ,
-4.22302342951297  , 45.4684649035334  ,
-4.22310230322182  , 45.4683704394847  ,
-4.22319316305220  , 45.4682784061878  ,
-4.22337035648524  , 45.4680952616035  ,
-4.22349725849926  , 45.4679173976182  ,
-4.22354964539408  , 45.4678365122526  ,
-4.22364218160510  , 45.4677028208971  ,
-4.22373312525451  , 45.4676162358373  ,
-4.22397393733263  , 45.4676381126046  ,
-4.22410042025148  , 45.4676748253405  ,
-4.22441507689654  , 45.4677644278854  ,
-4.22479544766247  , 45.4678419604897  ,
-4.22545552253723  , 45.4679805133491  ,
-4.22604016028344  , 45.4681709501892  ,
-4.22638071700930  , 45.4682901408523  ,
-4.22702545300126  , 45.4683912266045  ,
-4.22769927419722  , 45.4684251733124  ,
-4.22825943678617  , 45.4683250933885  ,
-4.22881742008030  , 45.4682042263448  ,
-4.22945645637810  , 45.4680108558386  ,
-4.22955427318811  , 45.4679733887314  ,
-4.22982685267925  , 45.4678477440029  ,
-4.22995819710195  , 45.4677760787308  ,
-4.23007537610828  , 45.4677047487348  ,
-4.23048164695501  , 45.4674759227782  ,
-4.23054283484816  , 45.4674476757645  ,
-4.23070301301777  , 45.4674053471535  ,
-4.23080979846417  , 45.4674041736871  ,
-4.23103225417435  , 45.4674211051315  ,
-4.23124968074262  , 45.4674368631094  ,
-4.23153290525078  , 45.4674770962446  ,
-4.23171227797865  , 45.4675361886620  ,
-4.23187136650085  , 45.4676068481057  ,
-4.23193867318332  , 45.4676466621458  ,
-4.23200254328548  , 45.4676912538707  ,
-4.23220111057162  , 45.4678470734506  ,
-4.23233094625174  , 45.4679417889565  ,
-4.23239741474390  , 45.4679685272276  ,
-4.23245214857161  , 45.4679756518453  ,
-4.23251266591250  , 45.4679705388844  ,
-4.23259145580232  , 45.4679546132683  ,
-4.23263026401400  , 45.4679588042199  ,
-4.23272531479597  , 45.4680364206433  ,
-4.23276898451149  , 45.4681038949638  ,
-4.23312043771147  , 45.4685326293110  ,
-4.23357775434851  , 45.4689485393464  ,
-4.23405082896351  , 45.4693981446325  ,
-4.23423573374748  , 45.4696004837751  ,
-4.23464678227901  , 45.4699863027781  ,
-4.23506755381822  , 45.4703090060502  ,
-4.23548245802521  , 45.4706763848662  ,
-4.23579334281384  , 45.4709135089069  ,
-4.23606843687593  , 45.4709875211119  ,
-4.23636121675372  , 45.4709160234779  ,
-4.23659507185220  , 45.4707455355674  ,
-4.23709178343415  , 45.4703450482338  ,
-4.23769293352961  , 45.4699619952589  ,
-4.23781748861074  , 45.4698552936315  ,
-4.23798747360706  , 45.4696249589323  ,
-4.23817363567650  , 45.4692714940756  ,
-4.23836742527782  , 45.4691050294786  ,
-4.23866271972656  , 45.4690221324563  ,
-4.23883236944675  , 45.4690260719507  ,
-4.23900143243372  , 45.4690832365304  ,
-4.23914903774857  , 45.4691738449037  ,
-4.23927007243037  , 45.4692940413951  ,
-4.23947140574455  , 45.4695800319314  ,
-4.23982805572450  , 45.4700013063848  ,
-4.24010801129043  , 45.4702494107186  ,
-4.24047178588807  , 45.4704587906599  ,
-4.24083908088505  , 45.4706794861704  ,
-4.24114946275949  , 45.4709531553089  ,
-4.24141542054712  , 45.4712533112615  ,
-4.24161247909069  , 45.4715999867767  ,
-4.24178137443959  , 45.4719294793903  ,
-4.24191833473742  , 45.4722717124968  ,
-4.24199377186596  , 45.4726172983646  ,
-4.24198153428733  , 45.4731093998998  ,
-4.24197650514543  , 45.4733926244080  ,
-4.24199771136045  , 45.4736216180026  ,
-4.24207147210836  , 45.4737740848213  ,
-4.24218228086829  , 45.4738456662744  ,
-4.24235478043556  , 45.4737635236233  ,
-4.24244362860918  , 45.4736454226076  ,
-4.24264471046626  , 45.4733438417315  ,
-4.24298660829663  , 45.4727149475365  ,
-4.24323974177241  , 45.4722590558230  ,
-4.24335281364619  , 45.4720556270331  ,
-4.24345482140779  , 45.4718682914972  ,
-4.24353973008692  , 45.4716978035867  ,
-4.24360862933099  , 45.4715402238070  ,
-4.24365364015102  , 45.4713992401957  ,
-4.24362313002347  , 45.4711269959807  ,
-4.24344426020979  , 45.4708823282271  ,
-4.24317226745188  , 45.4706904664635  ,
-4.24286004155874  , 45.4705215711146  ,
-4.24270916730165  , 45.4704318009316  ,
-4.24256491474807  , 45.4703330621123  ,
-4.24243918620049  , 45.4702163022011  ,
-4.24233223311603  , 45.4700884781777  ,
-4.24224196001887  , 45.4699509311467  ,
-4.24216342158615  , 45.4698067624121  ,
-4.24209024757146  , 45.4696576483547  ,
-4.24202470108866  , 45.4695112165063  ,
-4.24195990897715  , 45.4693713225424  ,
-4.24189285375177  , 45.4692257288843  ,
-4.24180509522557  , 45.4690779559314  ,
-4.24168087542057  , 45.4689333681017  ,
-4.24153083935379  , 45.4687864333391  ,
-4.24137610942125  , 45.4686301946640  ,
-4.24122825264930  , 45.4684718605130  ,
-4.24108668230473  , 45.4683300387114  ,
-4.24093807116150  , 45.4682146199047  ,
-4.24079138785600  , 45.4681131988763  ,
-4.24065643921494  , 45.4680318944156  ,
-4.24055962823331  , 45.4679661802947  ,
-4.24051210284233  , 45.4678964428603  ,
-4.24052308313548  , 45.4678288009017  ,
-4.24057865515351  , 45.4677590634673  ,
-4.24066993407905  , 45.4677076824009  ,
-4.24094578251242  , 45.4675828758627  ,
-4.24135699868202  , 45.4675457440316  ,
-4.24187927506864  , 45.4676786810159  ,
-4.24224506132304  , 45.4679802618920  ,
-4.24247925169765  , 45.4681240115314  ,
-4.24266784451901  , 45.4682501591742  ,
-4.24282995052635  , 45.4683681763708  ,
-4.24299993552267  , 45.4684751294553  ,
-4.24319431185722  , 45.4685851838439  ,
-4.24382865428924  , 45.4688386525958  ,
-4.24420014023780  , 45.4688663966953  ,
-4.24448864534497  , 45.4687238205224  ,
-4.24464236944913  , 45.4683349002152  ,
-4.24481922760605  , 45.4681652504950  ,
-4.24506733193993  , 45.4681172221899  ,
-4.24518476240336  , 45.4681294597685  ,
-4.24529992975294  , 45.4681562818586  ,
-4.24553235992789  , 45.4682042263448  ,
-4.24577929079532  , 45.4682134464383  ,
-4.24602136015892  , 45.4681573715060  ,
-4.24613485112786  , 45.4681008774787  ,
-4.24624565988779  , 45.4680313915014  ,
-4.24636216834187  , 45.4679487459361  ,
-4.24662359990179  , 45.4677608236670  ,
-4.24692585133016  , 45.4675304889678  ,
-4.24720572307705  , 45.4672819655388  ,
-4.24744636751711  , 45.4670868348330  ,
-4.24772456288337  , 45.4669470246881  ,
-4.24803997389972  , 45.4668799694627  ,
-4.24835999496281  , 45.4668873455375  ,
-4.24866291694343  , 45.4669571667909  ,
-4.24892837181687  , 45.4670859128236  ,
-4.24935467541217  , 45.4674443230032  ,
-4.24943237565457  , 45.4675387870520  ,
-4.24949959851801  , 45.4677666071802  ,
-4.24953656271100  , 45.4680676851421  ,
-4.24969783052802  , 45.4683686792850  ,
-4.24981475807726  , 45.4684957489371  ,
-4.24990402534604  , 45.4686007741838  ,
-4.24994844943284  , 45.4686984233558  ,
-4.24994048662483  , 45.4687954857945  ,
-4.24979740753769  , 45.4689559154212  ,
-4.24955768510699  , 45.4690586775541  ,
-4.24936942756175  , 45.4692185204476  ,
-4.24935375340282  , 45.4694184288382  ,
-4.24954402260482  , 45.4695583228021  ,
-4.24982909113168  , 45.4695772659033  ,
-4.25010326318442  , 45.4694662056863  ,
-4.25031918101012  , 45.4692941252142  ,
-4.25041423179209  , 45.4692019242793  ,
-4.25054557621479  , 45.4689881019294  ,
-4.25051204860210  , 45.4687441885471  ,
-4.25037525594234  , 45.4684898816049  ,
-4.25026478245854  , 45.4682470578700  ,
-4.25025329925119  , 45.4681209102272  ,
-4.25027115270495  , 45.4679909069091  ,
-4.25031515769660  , 45.4678587242960  ,
-4.25038187764585  , 45.4677268769592  ,
-4.25047500059008  , 45.4675990529358  ,
-4.25059217959642  , 45.4674820415675  ,
-4.25072293728590  , 45.4673756752163  ,
-4.25085755065083  , 45.4672664590179  ,
-4.25098462030291  , 45.4671562369912  ,
-4.25123515538871  , 45.4669515509158  ,
-4.25138141959905  , 45.4668742697685  ,
-4.25154863856732  , 45.4668294265866  ,
-4.25173547118902  , 45.4668126627802  ,
-4.25193227827548  , 45.4668300133198  ,
-4.25212883390486  , 45.4668787959963  ,
-4.25232161767780  , 45.4669509641826  ,
-4.25251792185008  , 45.4670301731675  ,
-4.25272813998162  , 45.4671081248670  ,
-4.25294799730181  , 45.4671889264136  ,
-4.25315544940531  , 45.4672640282660  ,
-4.25333247520029  , 45.4673437401652  ,
-4.25347924232482  , 45.4674377012997  ,
-4.25360388122498  , 45.4675464145839  ,
-4.25371980294585  , 45.4676650185137  ,
-4.25394544377923  , 45.4679166432470  ,
-4.25412875600159  , 45.4681846965104  ,
-4.25418566912412  , 45.4683385044336  ,
-4.25426311790943  , 45.4686795640736  ,
-4.25433369353413  , 45.4690536484122  ,
-4.25440737046301  , 45.4694187641143  ,
-4.25448456779122  , 45.4697671998292  ,
-4.25454466603696  , 45.4699396155774  ,
-4.25470308400690  , 45.4702380951493  ,
-4.25501053221523  , 45.4707227367907  ,
-4.25531647168099  , 45.4711938835680  ,
-4.25560707226395  , 45.4715289082378  ,
-4.25578602589666  , 45.4716907627880  ,
-4.25597629509866  , 45.4718328360468  ,
-4.25654148682951  , 45.4721345845609  ,
-4.25694205798208  , 45.4722807649523  ,
-4.25761981867253  , 45.4724276158958  ,
-4.25815617665648  , 45.4725226666778  ,
-4.25869027152657  , 45.4726158734411  ,
-4.25892747938632  , 45.4726418573409  ,
-4.25915680825710  , 45.4726416058838  ,
-4.25938504748046  , 45.4726141132414  ,
-4.25960674881935  , 45.4725581221282  ,
-4.25980908796191  , 45.4724754765629  ,
-4.25998569466173  , 45.4723645001649  ,
-4.26013824529945  , 45.4722324851900  ,
-4.26026087254285  , 45.4720729775726  ,
-4.26035265438258  , 45.4718884080648  ,
-4.26042775623500  , 45.4716853145509  ,
-4.26060193218290  , 45.4712974838912  ,
-4.26101557910442  , 45.4708529077470  ,
-4.26122244447469  , 45.4707487206906  ,
-4.26145479083061  , 45.4706681706011  ,
-4.26195200532674  , 45.4705852735787  ,
-4.26244930364191  , 45.4706172924488  ,
-4.26291508600115  , 45.4707615450024  ,
-4.26336871460080  , 45.4709953162819  ,
-4.26357893273234  , 45.4711019340902  ,
-4.26377959549427  , 45.4711836576461  ,
-4.26397958770394  , 45.4712387267500  ,
-4.26418511196970  , 45.4712613578885  ,
-4.26439558155834  , 45.4712512157857  ,
-4.26460278220474  , 45.4712080489844  ,
-4.26496672444045  , 45.4710274189710  ,
-4.26512120291590  , 45.4708877764642  ,
-4.26544164307415  , 45.4705539252609  ,
-4.26583609543740  , 45.4702440463006  ,
-4.26606223918497  , 45.4701249394565  ,
-4.26631243899464  , 45.4700277931988  ,
-4.26659977063536  , 45.4699556250125  ,
-4.26722346805036  , 45.4698639269918  ,
-4.26750853657722  , 45.4698299802839  ,
-4.26776292733848  , 45.4698210116475  ,
-4.26800558343529  , 45.4698326624929  ,
-4.26824647933244  , 45.4698754101991  ,
-4.26847882568836  , 45.4699430521577  ,
-4.26870387978851  , 45.4700336605310  ,
-4.26891535520553  , 45.4701463971287  ,
-4.26911484450101  , 45.4702890571206  ,
-4.26930586807429  , 45.4704442899674  ,
-4.26964885555207  , 45.4707464575767  ,
-4.26996024325489  , 45.4710156004875  ,
-4.27040289156138  , 45.4713913612067  ,
-4.27055452018976  , 45.4714988172054  ,
-4.27091804333031  , 45.4716507811099  ,
-4.27113513462245  , 45.4716898407787  ,
-4.27159655839204  , 45.4717312473803  ,
-4.27203811705112  , 45.4717831313610  ,
-4.27223861217498  , 45.4718369431793  ,
-4.27242284640669  , 45.4719167388975  ,
-4.27288167178630  , 45.4722416214644  ,
-4.27302190102636  , 45.4723536875098  ,
-4.27331350743770  , 45.4725623968988  ,
-4.27347946912050  , 45.4726488981395  ,
-4.27366739138960  , 45.4727100022137  ,
-4.27387492731213  , 45.4727420210838  ,
-4.27457238547503  , 45.4726896341890  ,
-4.27524763159453  , 45.4726098384708  ,
-4.27567267790436  , 45.4725223314017  ,
-4.27587786689400  , 45.4724558629095  ,
-4.27647256292402  , 45.4722272884100  ,
-4.27667657844722  , 45.4721649270504  ,
-4.27690003998577  , 45.4721197485923  ,
-4.27760646678507  , 45.4720214288681  ,
-4.27782774902880  , 45.4719968698918  ,
-4.27825137041509  , 45.4719813633710  ,
-4.27864540368318  , 45.4720397014170  ,
-4.27899945527315  , 45.4721655976027  ,
-4.27929793484508  , 45.4723645001649  ,
-4.27951024845242  , 45.4726214893162  ,
-4.27967914380133  , 45.4730702564120  ,
-4.27981635555624  , 45.4733665566891  ,
-4.28003143519163  , 45.4736136551946  ,
-4.28015934303402  , 45.4737084545195  ,
-4.28028800524771  , 45.4737762641161  ,
-4.28051138296723  , 45.4738632682710  ,
-4.28070492111146  , 45.4739050939679  ,
-4.28079460747539  , 45.4739142302423  ,
-4.28114748559892  , 45.4739263001829  ,
-4.28147379308938  , 45.4739319998770  ,
-4.28192457184195  , 45.4739347659051  ,
-4.28246763534843  , 45.4739380348473  ,
-4.28276192396879  , 45.4739387892186  ,
-4.28304933942854  , 45.4739413037896  ,
-4.28332082927227  , 45.4739539604634  ,
-4.28358318284153  , 45.4739850573241  ,
-4.28407821804285  , 45.4741230234503  ,
-4.28452120162546  , 45.4743599798530  ,
-4.28470216691493  , 45.4744930006563  ,
-4.28485128097236  , 45.4746185615658  ,
-4.28498866036534  , 45.4747466370463  ,
-4.28513064980506  , 45.4748834297060  ,
-4.28539627231657  , 45.4751390777528  ,
-4.28564446046948  , 45.4753366392105  ,
-4.28598057478666  , 45.4754797182977  ,
-4.28639807738363  , 45.4755253996700  ,
-4.28719712421298  , 45.4754738509654  ,
-4.28781260736286  , 45.4754178598523  ,
-4.28843496367335  , 45.4753593541681  ,
-4.28872958756983  , 45.4753496311604  ,
-4.28931003436446  , 45.4754058737307  ,
-4.29002249613404  , 45.4755403194576  ,
-4.29022743366658  , 45.4755786247551  ,
-4.29077133536338  , 45.4756888467818  ,
-4.29093645885586  , 45.4757429938763  ,
-4.29127307608723  , 45.4759053513407  ,
-4.29143702611327  , 45.4760132264345  ,
-4.29159343242645  , 45.4761449061334  ,
-4.29190968163311  , 45.4764547012746  ,
-4.29207379929721  , 45.4766230937093  ,
-4.29224219173192  , 45.4767946712672  ,
-4.29241578094661  , 45.4769706912338  ,
-4.29259649477899  , 45.4771514050662  ,
-4.29278307594358  , 45.4773361422121  ,
-4.29297401569783  , 45.4775249026715  ,
-4.29316847585141  , 45.4777183569967  ,
-4.29336545057594  , 45.4779154155403  ,
-4.29356602951884  , 45.4781146533787  ,
-4.29397489875555  , 45.4785196669399  ,
-4.29437303915619  , 45.4789166338741  ,
-4.29455702193081  , 45.4790910612791  ,
-4.29473589174449  , 45.4792448692023  ,
-4.29492674767971  , 45.4793776385486  ,
-4.29514710791409  , 45.4794897045940  ,
-4.29564474150538  , 45.4796805605292  ,
-4.29586820304393  , 45.4797887708991  ,
-4.29606249555945  , 45.4799194447696  ,
-4.29640213027596  , 45.4802139848470  ,
-4.29654344916343  , 45.4803471732884  ,
-4.29666792042553  , 45.4804652743041  ,
-4.29686556570231  , 45.4806529451161  ,
-4.29713009856641  , 45.4808724671602  ,
-4.29743553511798  , 45.4809748101979  ,
-4.29751700721681  , 45.4809930827468  ,
-4.29776326753199  , 45.4810100980103  ,
-4.29813751950860  , 45.4809487424790  ,
-4.29852794855833  , 45.4807961918413  ,
-4.29886221885681  , 45.4806407913565  ,
-4.29942724294960  , 45.4803794436156  ,
-4.29989134892821  , 45.4801615141332  ,
-4.30066977627575  , 45.4798022657632  ,
-4.30122482590377  , 45.4795482102781  ,
-4.30175514891743  , 45.4793051350861  ,
-4.30247314274311  , 45.4789721220731  ,
-4.30268662981688  , 45.4788840282708  ,
-4.30312240496277  , 45.4787775781005  ,
-4.30379874072968  , 45.4787121992558  ,
-4.30449133738875  , 45.4786573816090  ,
-4.30494781583547  , 45.4786246921867  ,
-4.30562331341207  , 45.4785956908017  ,
-4.30585113354027  , 45.4786073416471  ,
-4.30607610382139  , 45.4786264523863  ,
-4.30649737827479  , 45.4786774143576  ,
-4.30702870711684  , 45.4787534382194  ,
-4.30714856833219  , 45.4787669330835  ,
-4.30723926052451  , 45.4787773266434  ,
-4.30724646896123  , 45.4787926655262  ,
-4.30724864825606  , 45.4788147937506  ,
-4.30723867379128  , 45.4788396041840  ,
-4.30723817087709  , 45.4788411967456  ,
-4.30721688084304  , 45.4788769874721  ,
-4.30719475261867  , 45.4789546877145  ,
-4.30720422416925  , 45.4791380837559  ,
-4.30723372846841  , 45.4793003574013  ,
-4.30727295577526  , 45.4795073904097  ,
-4.30731570348143  , 45.4797245655208  ,
-4.30734302848577  , 45.4798303451389  ,
-4.30737043730914  , 45.4799391422420  ,
-4.30739818140864  , 45.4800467658787  ,
-4.30746607482433  , 45.4802580736577  ,
-4.30753044784069  , 45.4804560542106  ,
-4.30755157023668  , 45.4805511049926  ,
-4.30757193826138  , 45.4807332437485  ,
-4.30758493021130  , 45.4808982834219  ,
-4.30764377117156  , 45.4810366686433  ,
-4.30774074979126  , 45.4811504110693  ,
-4.30778685025870  , 45.4812354035675  ,
-4.30776120163500  , 45.4812955856323  ,
-4.30771736428141  , 45.4813618864864  ,
-4.30754989385604  , 45.4815475456416  ,
-4.30737077258527  , 45.4816103260964  ,
-4.30722509510815  , 45.4815956577658  ,
-4.30704211816191  , 45.4815611243247  ,
-4.30684422142803  , 45.4815139342099  ,
-4.30665772408246  , 45.4814600385725  ,
-4.30650274269282  , 45.4814146924763  ,
-4.30638179183006  , 45.4813820030540  ,
-4.30628322064876  , 45.4813644848763  ,
-4.30618179962038  , 45.4813717771321  ,
-4.30607216432690  , 45.4814137704670  ,
-4.30595003999769  , 45.4814783949404  ,
-4.30582456290721  , 45.4815476294606  ,
-4.30571593344211  , 45.4816135950386  ,
-4.30564879439771  , 45.4816938098520  ,
-4.30563395842909  , 45.4817858431488  ,
-4.30565491318702  , 45.4818812292069  ,
-4.30571928620338  , 45.4820529744029  ,
-4.30580067448318  , 45.4821771103888  ,
-4.30582020431756  , 45.4822004958987  ,
-4.30586705915629  , 45.4822728317230  ,
-4.30609420873224  , 45.4826871491968  ,
-4.30609278380870  , 45.4828982893377  ,
-4.30600192397832  , 45.4833783209323  ,
-4.30596780963242  , 45.4835814144462  ,
-4.30595020763576  , 45.4836565162986  ,
-4.30592874996364  , 45.4837194643914  ,
-4.30588650517165  , 45.4838205501437  ,
-4.30594333447515  , 45.4838987533003  ,
-4.30603830143809  , 45.4839966539293  ,
-4.30607669055461  , 45.4841025173664  ,
-4.30608716793358  , 45.4841534793376  ,
-4.30611256510019  , 45.4842072911560  ,
-4.30615749210119  , 45.4842657130211  ,
-4.30631473660469  , 45.4844536352902  ,
-4.30636343546211  , 45.4845941998064  ,
-4.30635999888181  , 45.4846671223640  ,
-4.30634968914091  , 45.4847444873303  ,
-4.30634030140936  , 45.4848292283713  ,
-4.30630903691053  , 45.4849945195019  ,
-4.30624575354158  , 45.4851535242050  ,
-4.30621264502406  , 45.4852361697703  ,
-4.30617903359234  , 45.4853143729269  ,
-4.30614056065678  , 45.4853985272347  ,
-4.30610560812056  , 45.4854710306972  ,
-4.30607954040169  , 45.4855307098478  ,
-4.30606713518500  , 45.4855841863900  ,
-4.30607669055461  , 45.4856249224394  ,
-4.30610795505344  , 45.4856638982892  ,
-4.30611960589885  , 45.4856996890157  ,
-4.30608825758099  , 45.4857456218451  ,
-4.30601122789084  , 45.4858022835105  ,
-4.30589815601706  , 45.4858655668795  ,
-4.30535048246383  , 45.4861660581082  ,
-4.30511922575533  , 45.4863287508487  ,
-4.30480347946286  , 45.4865999892354  ,
-4.30457540787756  , 45.4867129772901  ,
-4.30444775149226  , 45.4867458343505  ,
-4.30416997522115  , 45.4867921024560  ,
-4.30402119643986  , 45.4868004005402  ,
-4.30386822670698  , 45.4867983888834  ,
-4.30354837328195  , 45.4867605026811  ,
-4.30302232503890  , 45.4866209439933  ,
-4.30264027789235  , 45.4864693991839  ,
-4.30248001590371  , 45.4864452593028  ,
-4.30234473198652  , 45.4863984044641  ,
-4.30207760073244  , 45.4862367175519  ,
-4.30198523215949  , 45.4861880186945  ,
-4.30165397934615  , 45.4859998449683  ,
-4.30137611925601  , 45.4859498050063  ,
-4.30106858722865  , 45.4859531577676  ,
-4.30074999108910  , 45.4859926365315  ,
-4.30046685039997  , 45.4859850928187  ,
-4.30028387345373  , 45.4859482124447  ,
-4.30013241246342  , 45.4858617950230  ,
-4.30005161091685  , 45.4858162812888  ,
-4.29995169863104  , 45.4857949074357  ,
-4.29965296760201  , 45.4858997650444  ,
-4.29955858737230  , 45.4863027669489  ,
-4.29950368590652  , 45.4864702373743  ,
-4.29946655407547  , 45.4865441657602  ,
-4.29943344555795  , 45.4866062756627  ,
-4.29940788075327  , 45.4866526275873  ,
-4.29937887936830  , 45.4866901785135  ,
-4.29928751662373  , 45.4867613408714  ,
-4.29923898540437  , 45.4867925215512  ,
-4.29919045418500  , 45.4868239536881  ,
-4.29913689382374  , 45.4868494346737  ,
-4.29907805286347  , 45.4868667013943  ,
-4.29894846864044  , 45.4868960380554  ,
-4.29881972260773  , 45.4869113769382  ,
-4.29872659966349  , 45.4868841357529  ,
-4.29866323247551  , 45.4867370333522  ,
-4.29865133017301  , 45.4866569861769  ,
-4.29867731407284  , 45.4866360314190  ,
-4.29870950058102  , 45.4866154119372  ,
-4.29875543341040  , 45.4865904338657  ,
-4.29899943061172  , 45.4864820558577  ,
-4.29899138398468  , 45.4864479415118 };
-#endif        
 
 //---------------------------------------------
 // Public Functions
 //---------------------------------------------
 extern void GPS_Init();
 extern void GPS_Process();
-extern void GPS_Delay(unsigned long ms);
+extern void GPS_PrintProcessStats();
 
 #endif
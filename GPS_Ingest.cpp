@@ -0,0 +1,595 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file GPS_Ingest.cpp
+ * \brief GPS byte ingest stage
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Bytes coming from the GPS module are stored by the UART interrupt in the
+ * driver rx ring buffer, then drained by a dedicated task pinned on the core
+ * not running loop(). The task runs the parser and publishes a snapshot of the
+ * last fix, so the dashboard loop never handles byte level I/O.
+ *
+ * Parser is TinyGPSPlus (NMEA), or the UBX decoder if GPS_PROTOCOL_UBX is
+ * defined.
+ *
+ * At init the receiver baudrate is detected and switched to GPS_BAUDRATE,
+ * then the navigation rate and output messages are set: only GGA and RMC in
+ * NMEA mode (the only sentences TinyGPSPlus decodes), only NAV-PVT in UBX
+ * mode. Each configuration message is checked against its ACK.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <TinyGPS++.h>
+#include <HardwareSerial.h>
+
+#include "GPS_Ingest.h"
+#include "UBX.h"
+#include "Settings.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   GPS_BAUDRATE              921600
+
+#define   GPS_RX_BUFFER_SIZE        8192      ///< UART driver rx ring buffer, in bytes (~90ms of data @ 921600bds)
+#define   GPS_INGEST_CHUNK_SIZE     256       ///< Bytes copied out of the rx buffer at once by the task
+
+#define   GPS_INGEST_TASK_CORE      0         ///< loop() runs on core 1
+#define   GPS_INGEST_TASK_PRIORITY  10
+#define   GPS_INGEST_TASK_STACK     4096
+#define   GPS_INGEST_POLL_MS        10        ///< Max wait of the task if no rx event is signaled
+
+#define   GPS_CHECK_PERIOD_MS       1000      ///< Period of the bytes per second computation
+
+#define   GPS_UBX_UART_PORT_ID      1         ///< Receiver port wired to the ESP32
+
+#define   GPS_CONFIG_ACK_TIMEOUT_MS 250       ///< Max wait of the ACK of a configuration message
+#define   GPS_CONFIG_BAUD_SWITCH_MS 100       ///< Time let to the receiver to apply a new baudrate
+
+#if (GPS_NAV_RATE_HZ != 1) && (GPS_NAV_RATE_HZ != 5) && (GPS_NAV_RATE_HZ != 10) && (GPS_NAV_RATE_HZ != 20)
+#error "GPS_NAV_RATE_HZ must be 1, 5, 10 or 20"
+#endif
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  GPS_ACK_PENDING,
+  GPS_ACK_ACK,
+  GPS_ACK_NAK
+}e_gpsAckState;
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+HardwareSerial GPS_Serial(1);
+
+static s_ubxParser ubxParser;                 ///< Used for configuration, then by the ingest task in UBX mode
+#ifndef GPS_PROTOCOL_UBX
+TinyGPSPlus gps;                              ///< Only accessed by the ingest task
+#endif
+
+s_gpsIngestStats gpsIngestStats;
+s_gpsConfigReport gpsConfigReport;
+
+// Candidates tried by the baudrate detection, most likely first
+static const uint32_t baudCandidates[] = {GPS_BAUDRATE, 9600, 115200, 38400, 57600, 230400, 460800};
+
+// NMEA output rates (sentences per navigation solution). Class 0xF0, id in first column
+static const uint8_t nmeaRates[][2] = {{0x00, 1},  // GGA: altitude, satellites
+                                       {0x04, 1},  // RMC: location, speed, date
+                                       {0x01, 0},  // GLL
+                                       {0x02, 0},  // GSA
+                                       {0x03, 0},  // GSV
+                                       {0x05, 0},  // VTG
+                                       {0x06, 0},  // GRS
+                                       {0x07, 0},  // GST
+                                       {0x08, 0},  // ZDA
+                                       {0x09, 0},  // GBS
+                                       {0x0A, 0},  // DTM
+                                       {0x0D, 0}}; // GNS
+
+static volatile e_gpsAckState ackState;
+static uint8_t ackClass;
+static uint8_t ackId;
+
+static s_gpsFix sharedFix;                    ///< Last fix published by the ingest task
+static portMUX_TYPE sharedFixMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t sharedFixUpdates;    ///< Nb of fixes published, read without lock by GPS_Ingest_Updates()
+
+static TaskHandle_t ingestTaskHandle = NULL;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void GPS_Ingest_Init();
+void GPS_Ingest_Reset();
+void GPS_Ingest_Feed(const uint8_t *data, size_t len);
+void GPS_Ingest_GetFix(s_gpsFix *fix);
+uint32_t GPS_Ingest_Updates();
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void GPS_Ingest_Task(void *param);
+static void GPS_Ingest_Configure();
+static uint32_t GPS_Ingest_DetectBaud();
+static void GPS_Ingest_SetPort(uint32_t baud);
+static bool GPS_Ingest_SendConfig(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+static void GPS_Ingest_OnConfigFrame(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+static void GPS_Ingest_PrintReport();
+#ifdef GPS_PROTOCOL_UBX
+static void GPS_Ingest_OnUBXFrame(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+#else
+static void GPS_Ingest_Publish();
+static int32_t GPS_Ingest_RawToCoord(const RawDegrees &raw);
+#endif
+static void GPS_Ingest_Commit(const s_gpsFix *fix);
+static void GPS_Ingest_OnReceive();
+static void GPS_Ingest_OnReceiveError(hardwareSerial_error_t error);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn void GPS_Ingest_Init(void)
+///
+/// \brief Open the GPS serial port, configure the receiver and start the
+///        ingest task.
+/// \param None.
+/// \return None.
+void GPS_Ingest_Init()
+{
+  // Must be set before begin(), the driver allocates its ring buffer there
+  GPS_Serial.setRxBufferSize(GPS_RX_BUFFER_SIZE);
+  GPS_Serial.begin(GPS_BAUDRATE, SERIAL_8N1, PIN_GPS_RX, PIN_GPS_TX);
+
+  GPS_Ingest_Configure();
+  GPS_Ingest_PrintReport();
+
+#ifdef GPS_PROTOCOL_UBX
+  UBX_Init(&ubxParser, GPS_Ingest_OnUBXFrame);
+#endif
+
+  GPS_Serial.onReceive(GPS_Ingest_OnReceive);
+  GPS_Serial.onReceiveError(GPS_Ingest_OnReceiveError);
+
+  xTaskCreatePinnedToCore(GPS_Ingest_Task, "gpsIngest", GPS_INGEST_TASK_STACK, NULL,
+                          GPS_INGEST_TASK_PRIORITY, &ingestTaskHandle, GPS_INGEST_TASK_CORE);
+}
+
+
+//---------------------------------------------
+/// \fn void GPS_Ingest_Reset(void)
+///
+/// \brief Reset parser, published fix and statistics, without touching the
+///        serial port. Used to feed recorded data (see GPS_Replay.cpp)
+///        instead of the receiver; the ingest task must not be running.
+/// \param None.
+/// \return None.
+void GPS_Ingest_Reset()
+{
+#ifdef GPS_PROTOCOL_UBX
+  UBX_Init(&ubxParser, GPS_Ingest_OnUBXFrame);
+#else
+  gps = TinyGPSPlus();
+#endif
+
+  memset(&gpsIngestStats, 0, sizeof(gpsIngestStats));
+
+  portENTER_CRITICAL(&sharedFixMux);
+  memset(&sharedFix, 0, sizeof(sharedFix));
+  sharedFixUpdates = 0;
+  portEXIT_CRITICAL(&sharedFixMux);
+}
+
+
+//---------------------------------------------
+/// \fn void GPS_Ingest_Feed(const uint8_t *data, size_t len)
+///
+/// \brief Run the parser on a block of received bytes, and publish the fix
+///        each time a sentence is complete.
+/// \param data Bytes received from the GPS module.
+/// \param len Nb of bytes.
+/// \return None.
+void GPS_Ingest_Feed(const uint8_t *data, size_t len)
+{
+#ifdef GPS_PROTOCOL_UBX
+  for(size_t i = 0; i < len; i++)
+  {
+    UBX_Decode(&ubxParser, data[i]);
+  }
+
+  gpsIngestStats.sentences = ubxParser.frames;
+  gpsIngestStats.checksumErrors = ubxParser.checksumErrors + ubxParser.lengthErrors;
+#else
+  for(size_t i = 0; i < len; i++)
+  {
+    if(gps.encode(data[i]))
+    {
+      GPS_Ingest_Publish();
+    }
+  }
+
+  gpsIngestStats.sentences = gps.passedChecksum();
+  gpsIngestStats.checksumErrors = gps.failedChecksum();
+#endif
+}
+
+
+//---------------------------------------------
+/// \fn void GPS_Ingest_GetFix(s_gpsFix *fix)
+///
+/// \brief Copy the last published fix.
+/// \param fix Destination of the copy.
+/// \return None.
+void GPS_Ingest_GetFix(s_gpsFix *fix)
+{
+  portENTER_CRITICAL(&sharedFixMux);
+  *fix = sharedFix;
+  portEXIT_CRITICAL(&sharedFixMux);
+}
+
+
+//---------------------------------------------
+/// \fn uint32_t GPS_Ingest_Updates(void)
+///
+/// \brief Nb of fixes published so far. Read without lock, cheap enough to
+///        be polled at each loop to know if GPS_Ingest_GetFix() is worth it.
+/// \param None.
+/// \return Publish counter.
+uint32_t GPS_Ingest_Updates()
+{
+  return sharedFixUpdates;
+}
+
+
+static void GPS_Ingest_Task(void *param)
+{
+  uint8_t buff[GPS_INGEST_CHUNK_SIZE];
+  unsigned long checkDataTime = millis();
+  uint32_t checkDataBytes = 0;
+
+  for(;;)
+  {
+    // Woken up by the uart rx event, or by timeout if nothing comes
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(GPS_INGEST_POLL_MS));
+
+    size_t available = GPS_Serial.available();
+
+    if(available > gpsIngestStats.maxBuffered)
+    {
+      gpsIngestStats.maxBuffered = available;
+    }
+
+    while(available > 0)
+    {
+      size_t len = GPS_Serial.read(buff, min(available, sizeof(buff)));
+
+      gpsIngestStats.bytesReceived += len;
+      GPS_Ingest_Feed(buff, len);
+
+      available = GPS_Serial.available();
+    }
+
+    if((millis() - checkDataTime) >= GPS_CHECK_PERIOD_MS)
+    {
+      gpsIngestStats.bytesPerSecond = (gpsIngestStats.bytesReceived - checkDataBytes) * 1000 / (millis() - checkDataTime);
+      checkDataBytes = gpsIngestStats.bytesReceived;
+      checkDataTime = millis();
+    }
+  }
+}
+
+
+static void GPS_Ingest_Configure()
+{
+  const uint16_t measRateMs = 1000 / GPS_NAV_RATE_HZ;
+  const uint8_t cfgRate[6] = {(uint8_t)(measRateMs), (uint8_t)(measRateMs >> 8),
+                              0x01, 0x00,                         // navRate: 1 solution per measurement
+                              0x01, 0x00};                        // timeRef: GPS
+#ifdef GPS_PROTOCOL_UBX
+  const uint8_t cfgMsgNavPvt[3] = {UBX_CLASS_NAV, UBX_NAV_PVT, 1}; // 1 frame per navigation solution
+#endif
+
+  UBX_Init(&ubxParser, GPS_Ingest_OnConfigFrame);
+
+  memset(&gpsConfigReport, 0, sizeof(gpsConfigReport));
+  gpsConfigReport.navRateHz = GPS_NAV_RATE_HZ;
+  gpsConfigReport.detectedBaud = GPS_Ingest_DetectBaud();
+
+  // Report counters only cover the configuration messages, not the detection polls
+  gpsConfigReport.acked = 0;
+  gpsConfigReport.timeouts = 0;
+
+  if(gpsConfigReport.detectedBaud == 0)
+  {
+    // No answer, keep default baudrate and hope the module already talks at it
+    GPS_Serial.updateBaudRate(GPS_BAUDRATE);
+    gpsConfigReport.baud = GPS_BAUDRATE;
+    return;
+  }
+
+  GPS_Ingest_SetPort(gpsConfigReport.detectedBaud);
+
+  GPS_Ingest_SendConfig(UBX_CLASS_CFG, UBX_CFG_RATE, cfgRate, sizeof(cfgRate));
+
+#ifdef GPS_PROTOCOL_UBX
+  GPS_Ingest_SendConfig(UBX_CLASS_CFG, UBX_CFG_MSG, cfgMsgNavPvt, sizeof(cfgMsgNavPvt));
+#else
+  for(size_t i = 0; i < sizeof(nmeaRates) / sizeof(nmeaRates[0]); i++)
+  {
+    const uint8_t cfgMsg[3] = {UBX_CLASS_NMEA, nmeaRates[i][0], nmeaRates[i][1]};
+
+    GPS_Ingest_SendConfig(UBX_CLASS_CFG, UBX_CFG_MSG, cfgMsg, sizeof(cfgMsg));
+  }
+#endif
+}
+
+
+// Polls the port configuration at each candidate baudrate until the receiver acknowledges
+static uint32_t GPS_Ingest_DetectBaud()
+{
+  const uint8_t cfgPrtPoll[1] = {GPS_UBX_UART_PORT_ID};
+
+  for(size_t i = 0; i < sizeof(baudCandidates) / sizeof(baudCandidates[0]); i++)
+  {
+    GPS_Serial.updateBaudRate(baudCandidates[i]);
+
+    if(GPS_Ingest_SendConfig(UBX_CLASS_CFG, UBX_CFG_PRT, cfgPrtPoll, sizeof(cfgPrtPoll)))
+    {
+      return baudCandidates[i];
+    }
+  }
+
+  return 0;
+}
+
+
+// Set protocols and baudrate of the receiver port; baudrate change is verified by a poll at the new rate
+static void GPS_Ingest_SetPort(uint32_t baud)
+{
+#ifdef GPS_PROTOCOL_UBX
+  const uint8_t outProtoMask = 0x01;                              // UBX only
+#else
+  const uint8_t outProtoMask = 0x03;                              // NMEA, and UBX for the ACKs
+#endif
+  const uint8_t cfgPrt[20] = {GPS_UBX_UART_PORT_ID, 0x00,         // portID, reserved
+                              0x00, 0x00,                         // txReady
+                              0xD0, 0x08, 0x00, 0x00,             // mode: 8N1
+                              (uint8_t)(GPS_BAUDRATE), (uint8_t)(GPS_BAUDRATE >> 8),
+                              (uint8_t)(GPS_BAUDRATE >> 16), (uint8_t)(GPS_BAUDRATE >> 24),
+                              0x03, 0x00,                         // inProtoMask: UBX + NMEA
+                              outProtoMask, 0x00,                 // outProtoMask
+                              0x00, 0x00, 0x00, 0x00};            // flags, reserved
+  const uint8_t cfgPrtPoll[1] = {GPS_UBX_UART_PORT_ID};
+
+  if(baud == GPS_BAUDRATE)
+  {
+    GPS_Ingest_SendConfig(UBX_CLASS_CFG, UBX_CFG_PRT, cfgPrt, sizeof(cfgPrt));
+    gpsConfigReport.baud = baud;
+    return;
+  }
+
+  // ACK of a baudrate change is not reliable, it may be sent while the port switches
+  UBX_Send(GPS_Serial, UBX_CLASS_CFG, UBX_CFG_PRT, cfgPrt, sizeof(cfgPrt));
+  GPS_Serial.flush();
+  delay(GPS_CONFIG_BAUD_SWITCH_MS);
+  GPS_Serial.updateBaudRate(GPS_BAUDRATE);
+
+  if(GPS_Ingest_SendConfig(UBX_CLASS_CFG, UBX_CFG_PRT, cfgPrtPoll, sizeof(cfgPrtPoll)))
+  {
+    gpsConfigReport.baud = GPS_BAUDRATE;
+  }
+  else
+  {
+    // Receiver did not follow, stay at the rate it answered at
+    GPS_Serial.updateBaudRate(baud);
+    gpsConfigReport.baud = baud;
+  }
+}
+
+
+// Send a configuration message and wait for its ACK. Runs before the ingest task is started.
+static bool GPS_Ingest_SendConfig(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length)
+{
+  unsigned long start;
+
+  while(GPS_Serial.available())
+  {
+    GPS_Serial.read();
+  }
+
+  ackClass = msgClass;
+  ackId = msgId;
+  ackState = GPS_ACK_PENDING;
+
+  UBX_Send(GPS_Serial, msgClass, msgId, payload, length);
+
+  start = millis();
+
+  while((ackState == GPS_ACK_PENDING) && ((millis() - start) < GPS_CONFIG_ACK_TIMEOUT_MS))
+  {
+    while(GPS_Serial.available())
+    {
+      UBX_Decode(&ubxParser, GPS_Serial.read());
+    }
+    delay(1);
+  }
+
+  if(ackState == GPS_ACK_ACK)
+  {
+    gpsConfigReport.acked++;
+    return true;
+  }
+  else if(ackState == GPS_ACK_NAK)
+  {
+    gpsConfigReport.rejected++;
+  }
+  else
+  {
+    gpsConfigReport.timeouts++;
+  }
+
+  return false;
+}
+
+
+static void GPS_Ingest_OnConfigFrame(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length)
+{
+  // ACK payload: class and id of the acknowledged message
+  if((msgClass != UBX_CLASS_ACK) || (length < 2) || (payload[0] != ackClass) || (payload[1] != ackId))
+  {
+    return;
+  }
+
+  ackState = (msgId == UBX_ACK_ACK) ? GPS_ACK_ACK : GPS_ACK_NAK;
+}
+
+
+static void GPS_Ingest_PrintReport()
+{
+  Serial.println("GPS receiver configuration:");
+
+  if(gpsConfigReport.detectedBaud == 0)
+  {
+    Serial.println("- no answer from receiver, not configured");
+  }
+  else
+  {
+    Serial.printf("- detected at %u bds, now at %u bds\r\n", gpsConfigReport.detectedBaud, gpsConfigReport.baud);
+  }
+
+#ifdef GPS_PROTOCOL_UBX
+  Serial.printf("- protocol UBX (NAV-PVT), %u Hz\r\n", gpsConfigReport.navRateHz);
+#else
+  Serial.printf("- protocol NMEA (GGA, RMC), %u Hz\r\n", gpsConfigReport.navRateHz);
+#endif
+  Serial.printf("- %u acked, %u rejected, %u timeouts\r\n", gpsConfigReport.acked, gpsConfigReport.rejected, gpsConfigReport.timeouts);
+}
+
+
+#ifdef GPS_PROTOCOL_UBX
+static void GPS_Ingest_OnUBXFrame(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length)
+{
+  s_gpsFix fix;
+
+  if((msgClass != UBX_CLASS_NAV) || (msgId != UBX_NAV_PVT))
+  {
+    return;
+  }
+
+  GPS_Ingest_GetFix(&fix);
+
+  if(UBX_ParseNavPvt(payload, length, &fix))
+  {
+    GPS_Ingest_Commit(&fix);
+  }
+}
+
+#else
+
+static void GPS_Ingest_Publish()
+{
+  s_gpsFix fix;
+
+  GPS_Ingest_GetFix(&fix);
+
+  if(gps.location.isUpdated())
+  {
+    fix.lat = GPS_Ingest_RawToCoord(gps.location.rawLat());
+    fix.lng = GPS_Ingest_RawToCoord(gps.location.rawLng());
+    fix.locationCount++;
+  }
+  fix.locationValid = gps.location.isValid();
+
+  if(gps.altitude.isUpdated())
+  {
+    fix.altitude = gps.altitude.value() * 10;                     // cm to mm
+  }
+  fix.altitudeValid = gps.altitude.isValid();
+
+  if(gps.speed.isUpdated())
+  {
+    fix.speed = ((int64_t)gps.speed.value() * 514444) / 100000;   // 1/100 knot to mm/s
+  }
+  fix.speedValid = gps.speed.isValid();
+
+  if(gps.satellites.isUpdated())
+  {
+    fix.satellites = gps.satellites.value();
+  }
+  fix.satellitesValid = gps.satellites.isValid();
+
+  if(gps.date.isUpdated())
+  {
+    fix.year = gps.date.year();
+    fix.month = gps.date.month();
+    fix.day = gps.date.day();
+  }
+  fix.dateValid = gps.date.isValid();
+
+  if(gps.time.isUpdated())
+  {
+    fix.hour = gps.time.hour();
+    fix.minute = gps.time.minute();
+    fix.second = gps.time.second();
+  }
+  fix.timeValid = gps.time.isValid();
+
+  GPS_Ingest_Commit(&fix);
+}
+
+
+// Degrees + billionths to 1e-7 degrees, without going through double
+static int32_t GPS_Ingest_RawToCoord(const RawDegrees &raw)
+{
+  int32_t coord = (int32_t)raw.deg * GPS_COORD_SCALE + (int32_t)(raw.billionths / 100);
+
+  return raw.negative ? -coord : coord;
+}
+#endif
+
+
+static void GPS_Ingest_Commit(const s_gpsFix *fix)
+{
+  portENTER_CRITICAL(&sharedFixMux);
+  sharedFix = *fix;
+  sharedFixUpdates++;
+  portEXIT_CRITICAL(&sharedFixMux);
+}
+
+
+// Called from the uart event task when bytes are available
+static void GPS_Ingest_OnReceive()
+{
+  if(ingestTaskHandle != NULL)
+  {
+    xTaskNotifyGive(ingestTaskHandle);
+  }
+}
+
+
+static void GPS_Ingest_OnReceiveError(hardwareSerial_error_t error)
+{
+  if((error == UART_BUFFER_FULL_ERROR) || (error == UART_FIFO_OVF_ERROR))
+  {
+    gpsIngestStats.overruns++;
+  }
+}
@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file GPS_Ingest.h
+ * \brief GPS byte ingest stage header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _GPS_INGEST_H
+#define _GPS_INGEST_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   GPS_COORD_SCALE           10000000                      ///< Coordinates unit is 1e-7 degree
+#define   GPS_MMS_TO_KMH(mms)       (((mms) * 36 + 5000) / 10000) ///< Speed in mm/s to rounded km/h
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+/// Snapshot of the last data committed by the parser. Written by the ingest
+/// task, copied by the main loop with GPS_Ingest_GetFix().
+/// Values are integers whatever the protocol, as sent in UBX frames.
+typedef struct
+{
+  bool      locationValid;
+  int32_t   lat;                  ///< Latitude, in 1e-7 degrees
+  int32_t   lng;                  ///< Longitude, in 1e-7 degrees
+
+  bool      altitudeValid;
+  int32_t   altitude;             ///< Altitude above mean sea level, in mm
+
+  bool      speedValid;
+  int32_t   speed;                ///< Ground speed, in mm/s
+
+  bool      satellitesValid;
+  uint8_t   satellites;           ///< Nb of satellites used for the fix
+
+  bool      dateValid;
+  bool      timeValid;
+  uint16_t  year;
+  uint8_t   month;
+  uint8_t   day;
+  uint8_t   hour;
+  uint8_t   minute;
+  uint8_t   second;
+
+  uint32_t  locationCount;        ///< Incremented each time a new location is committed
+}s_gpsFix;
+
+
+typedef struct
+{
+  uint32_t  bytesReceived;        ///< Total bytes pulled from the UART
+  uint32_t  bytesPerSecond;       ///< Measured over the last GPS_CHECK_PERIOD_MS
+  uint32_t  maxBuffered;          ///< Highest fill level of the rx buffer seen, in bytes
+  uint32_t  overruns;             ///< UART FIFO or rx buffer overflows (bytes lost)
+  uint32_t  sentences;            ///< Sentences (or UBX frames) with a valid checksum
+  uint32_t  checksumErrors;       ///< Sentences (or UBX frames) rejected by the parser
+}s_gpsIngestStats;
+
+
+typedef struct
+{
+  uint32_t  detectedBaud;         ///< Baudrate the receiver answered at, 0 if it never answered
+  uint32_t  baud;                 ///< Baudrate in use after configuration
+  uint8_t   navRateHz;            ///< Navigation rate requested
+  uint8_t   acked;                ///< Configuration messages acknowledged
+  uint8_t   rejected;             ///< Configuration messages answered with a NAK
+  uint8_t   timeouts;             ///< Configuration messages left without answer
+}s_gpsConfigReport;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+extern s_gpsIngestStats gpsIngestStats;
+extern s_gpsConfigReport gpsConfigReport;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void GPS_Ingest_Init();
+extern void GPS_Ingest_Reset();
+extern void GPS_Ingest_Feed(const uint8_t *data, size_t len);
+extern void GPS_Ingest_GetFix(s_gpsFix *fix);
+extern uint32_t GPS_Ingest_Updates();
+
+#endif
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file GPS_Replay.cpp
+ * \brief Replay of recorded GPS data
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Streams a capture of the receiver output (NMEA or UBX, as configured by
+ * GPS_PROTOCOL_UBX) through GPS_Ingest_Feed() and GPS_Process(), the path
+ * followed by live data, and measures it.
+ * Bytes are fed one by one and GPS_Process() runs after each published fix,
+ * so no location is skipped whatever the replay speed.
+ * Speed 1.0 paces the replay on the capture time (1 s resolution, from the
+ * fix time), 2.0 runs twice faster, GPS_REPLAY_MAX_SPEED does not pace.
+ *
+ * Used on target with GPS_REPLAY_FILE (see Settings.h), and on host by
+ * host/GPS_Replay_Host.cpp.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "GPS_Replay.h"
+#include "GPS.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   GPS_REPLAY_CHUNK_SIZE     256       ///< Bytes read from the capture file at once
+
+#define   SECONDS_PER_DAY           86400L
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+static float replaySpeed;
+static unsigned long replayStartMillis;
+static long replayFirstSecond;              ///< Capture time of the first fix, in s of the day, -1 until known
+static uint32_t replayUpdates;              ///< GPS_Ingest_Updates() value of the last fix processed
+static uint32_t replayBytes;
+static uint32_t replayFixes;
+static uint32_t replayProcessUs;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void GPS_Replay_Begin(float speed);
+void GPS_Replay_Feed(const uint8_t *data, size_t len);
+void GPS_Replay_End(s_gpsReplayReport *report);
+void GPS_Replay_PrintReport(const s_gpsReplayReport *report);
+bool GPS_Replay_File(fs::FS &fs, const char *path, float speed);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void GPS_Replay_Pace();
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn void GPS_Replay_Begin(float speed)
+///
+/// \brief Reset the ingest stage and start a replay.
+/// \param speed Speed factor, 1.0 for real time, GPS_REPLAY_MAX_SPEED for
+///        no pacing.
+/// \return None.
+void GPS_Replay_Begin(float speed)
+{
+  GPS_Ingest_Reset();
+
+  replaySpeed = speed;
+  replayStartMillis = millis();
+  replayFirstSecond = -1;
+  replayUpdates = GPS_Ingest_Updates();
+  replayBytes = 0;
+  replayFixes = 0;
+  replayProcessUs = 0;
+}
+
+
+//---------------------------------------------
+/// \fn void GPS_Replay_Feed(const uint8_t *data, size_t len)
+///
+/// \brief Replay the next block of the capture.
+/// \param data Captured bytes.
+/// \param len Nb of bytes.
+/// \return None.
+void GPS_Replay_Feed(const uint8_t *data, size_t len)
+{
+  uint32_t startUs = micros();
+  uint32_t updates;
+
+  for(size_t i = 0; i < len; i++)
+  {
+    GPS_Ingest_Feed(&data[i], 1);
+
+    updates = GPS_Ingest_Updates();
+    if(updates != replayUpdates)
+    {
+      replayUpdates = updates;
+      replayFixes++;
+      GPS_Process();
+
+      if(replaySpeed > GPS_REPLAY_MAX_SPEED)
+      {
+        replayProcessUs += micros() - startUs;
+        GPS_Replay_Pace();
+        startUs = micros();
+      }
+    }
+  }
+
+  replayProcessUs += micros() - startUs;
+  replayBytes += len;
+}
+
+
+//---------------------------------------------
+/// \fn void GPS_Replay_End(s_gpsReplayReport *report)
+///
+/// \brief End the replay and fill its report.
+/// \param report Report to fill.
+/// \return None.
+void GPS_Replay_End(s_gpsReplayReport *report)
+{
+  report->bytes = replayBytes;
+  report->sentences = gpsIngestStats.sentences;
+  report->checksumErrors = gpsIngestStats.checksumErrors;
+  report->fixes = replayFixes;
+  report->elapsedMs = millis() - replayStartMillis;
+  report->processUs = replayProcessUs;
+  report->tripMeters = trip;
+}
+
+
+//---------------------------------------------
+/// \fn void GPS_Replay_PrintReport(const s_gpsReplayReport *report)
+///
+/// \brief Print a replay report on Serial.
+/// \param report Report to print.
+/// \return None.
+void GPS_Replay_PrintReport(const s_gpsReplayReport *report)
+{
+  uint32_t sentences = max(report->sentences, (uint32_t)1);
+  uint32_t processUs = max(report->processUs, (uint32_t)1);
+
+  Serial.printf("GPS replay: %u bytes, %u sentences (%u rejected), %u fixes, %u ms\r\n",
+                report->bytes, report->sentences, report->checksumErrors, report->fixes, report->elapsedMs);
+  Serial.printf("- processing %u us, %.2f us/sentence, %u sentences/s\r\n",
+                report->processUs, report->processUs / (float)sentences, (uint32_t)(sentences * 1000000ULL / processUs));
+  Serial.printf("- trip %u m\r\n", report->tripMeters);
+}
+
+
+//---------------------------------------------
+/// \fn bool GPS_Replay_File(fs::FS &fs, const char *path, float speed)
+///
+/// \brief Replay a capture file and print the report. Blocks until the end
+///        of the file.
+/// \param fs File system holding the capture.
+/// \param path Capture file.
+/// \param speed Speed factor, see GPS_Replay_Begin().
+/// \return false if the file can't be opened.
+bool GPS_Replay_File(fs::FS &fs, const char *path, float speed)
+{
+  uint8_t buff[GPS_REPLAY_CHUNK_SIZE];
+  s_gpsReplayReport report;
+  size_t len;
+
+  File file = fs.open(path, FILE_READ);
+  if(!file)
+  {
+    Serial.printf("GPS replay: can't open %s\r\n", path);
+    return false;
+  }
+
+  GPS_Replay_Begin(speed);
+
+  while((len = file.read(buff, sizeof(buff))) > 0)
+  {
+    GPS_Replay_Feed(buff, len);
+  }
+  file.close();
+
+  GPS_Replay_End(&report);
+  GPS_Replay_PrintReport(&report);
+
+  return true;
+}
+
+
+// Wait until the replay time catches up with the capture time of the fix
+static void GPS_Replay_Pace()
+{
+  long captureSecond;
+  unsigned long targetMs;
+  unsigned long elapsedMs;
+
+  if(!gpsFix.timeValid)
+  {
+    return;
+  }
+
+  captureSecond = gpsFix.hour * 3600L + gpsFix.minute * 60L + gpsFix.second;
+
+  if(replayFirstSecond < 0)
+  {
+    replayFirstSecond = captureSecond;
+    return;
+  }
+
+  captureSecond -= replayFirstSecond;
+  if(captureSecond < 0)
+  {
+    captureSecond += SECONDS_PER_DAY;     // Capture went through midnight
+  }
+
+  targetMs = (unsigned long)(captureSecond * 1000L / replaySpeed);
+  elapsedMs = millis() - replayStartMillis;
+
+  if(elapsedMs < targetMs)
+  {
+    delay(targetMs - elapsedMs);
+  }
+}
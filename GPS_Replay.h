@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file GPS_Replay.h
+ * \brief Replay of recorded GPS data header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _GPS_REPLAY_H
+#define _GPS_REPLAY_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include "FS.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   GPS_REPLAY_MAX_SPEED      0.0f      ///< Speed factor feeding data as fast as it is processed
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  uint32_t  bytes;                ///< Bytes replayed
+  uint32_t  sentences;            ///< Sentences (or UBX frames) with a valid checksum
+  uint32_t  checksumErrors;       ///< Sentences (or UBX frames) rejected by the parser
+  uint32_t  fixes;                ///< Fixes published, each one followed by a GPS_Process() call
+  uint32_t  elapsedMs;            ///< Replay duration, pacing included
+  uint32_t  processUs;            ///< Time spent in parser and GPS_Process(), pacing excluded
+  uint32_t  tripMeters;           ///< Trip distance at the end of the replay
+}s_gpsReplayReport;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void GPS_Replay_Begin(float speed);
+extern void GPS_Replay_Feed(const uint8_t *data, size_t len);
+extern void GPS_Replay_End(s_gpsReplayReport *report);
+extern void GPS_Replay_PrintReport(const s_gpsReplayReport *report);
+extern bool GPS_Replay_File(fs::FS &fs, const char *path, float speed);
+
+#endif
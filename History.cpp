@@ -0,0 +1,409 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file History.cpp
+ * \brief Bounded location history
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Points of the ride kept for the track and stats screens, in a fixed
+ * storage given by the caller: memory does not grow with ride length.
+ * When the storage is full:
+ * - HISTORY_MODE_RING overwrites the oldest point,
+ * - HISTORY_MODE_DECIMATE halves the resolution in place, keeping every
+ *   second point, and stores one sample out of twice as many from then on.
+ *   Stored point i is always sample i * step, so the history stays evenly
+ *   spaced in time and covers the whole ride.
+ * Points are read in time order, oldest first, with History_Get().
+ *
+ * Charts are drawn from a pyramid of min / max / sum of the altitude and
+ * speed of blocks of 8, 16, 32... stored points, updated at each point
+ * stored. A chart column covering 2^n points is one node, so a chart costs
+ * its width whatever the nb of points. In decimate mode, each level takes
+ * the place of the level below, so nodes still hold the extremes of the
+ * dropped points.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "History.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void History_Init(s_history *history, s_historyPoint *points, s_historyNode *nodes, uint16_t capacity, e_historyMode mode);
+void History_Clear(s_history *history);
+void History_Add(s_history *history, const s_historyPoint *point);
+uint16_t History_Count(const s_history *history);
+const s_historyPoint *History_Get(const s_history *history, uint16_t index);
+const s_historyPoint *History_Last(const s_history *history);
+int History_Value(const s_historyPoint *point, e_historyField field);
+uint16_t History_Span(const s_history *history, uint16_t maxColumns);
+uint16_t History_Columns(const s_history *history, uint16_t span);
+void History_Range(const s_history *history, e_historyField field, uint16_t column, uint16_t span, s_historyRange *range);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void History_Decimate(s_history *history);
+static s_historyNode *History_Node(const s_history *history, uint8_t level, uint32_t index);
+static void History_NodeAdd(s_history *history, const s_historyPoint *point);
+static void History_NodeMerge(s_historyNode *node, const s_historyNode *other);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn void History_Init(s_history *history, s_historyPoint *points, s_historyNode *nodes, uint16_t capacity, e_historyMode mode)
+///
+/// \brief Set up an empty history on a storage.
+/// \param history History to set up.
+/// \param points Storage, capacity points; sizes the memory budget.
+/// \param nodes Pyramid storage, HISTORY_NODES(capacity) nodes.
+/// \param capacity Nb of points of the storage, at least 2.
+/// \param mode Behaviour once full.
+/// \return None.
+void History_Init(s_history *history, s_historyPoint *points, s_historyNode *nodes, uint16_t capacity, e_historyMode mode)
+{
+  uint16_t offset = 0;
+
+  history->points = points;
+  history->nodes = nodes;
+  history->capacity = capacity;
+  history->mode = mode;
+
+  // Levels up to one node covering the whole storage; 2 more nodes than
+  // covered by capacity points, for the partly filled ends
+  history->levels = 0;
+  while((capacity >> (HISTORY_NODE_MIN_LEVEL + history->levels)) > 0)
+  {
+    history->levelOffset[history->levels] = offset;
+    history->levelSize[history->levels] = (capacity >> (HISTORY_NODE_MIN_LEVEL + history->levels)) + 2;
+    offset += history->levelSize[history->levels];
+    history->levels++;
+  }
+
+  History_Clear(history);
+}
+
+
+void History_Clear(s_history *history)
+{
+  history->count = 0;
+  history->first = 0;
+  history->step = 1;
+  history->samples = 0;
+  history->stored = 0;
+  memset(&history->last, 0, sizeof(history->last));
+}
+
+
+//---------------------------------------------
+/// \fn void History_Add(s_history *history, const s_historyPoint *point)
+///
+/// \brief Add a sample. Never writes past the storage: once full, the
+///        oldest point is dropped (ring) or the history decimated.
+/// \param history History to add to.
+/// \param point Sample to add.
+/// \return None.
+void History_Add(s_history *history, const s_historyPoint *point)
+{
+  uint32_t slot;
+
+  history->last = *point;
+
+  // Decimated: only samples falling on the current step are stored
+  if((history->samples++ & (history->step - 1)) != 0)
+  {
+    return;
+  }
+
+  if(history->count < history->capacity)
+  {
+    slot = history->first + history->count;
+    if(slot >= history->capacity)
+    {
+      slot -= history->capacity;
+    }
+    history->points[slot] = *point;
+    history->count++;
+  }
+  else if(history->mode == HISTORY_MODE_RING)
+  {
+    history->points[history->first] = *point;
+    history->first = (history->first + 1 < history->capacity) ? history->first + 1 : 0;
+  }
+  else
+  {
+    History_Decimate(history);
+
+    // Sample index is count * old step: stored only if it is on the new step
+    if(((history->samples - 1) & (history->step - 1)) != 0)
+    {
+      return;
+    }
+    history->points[history->count++] = *point;
+  }
+
+  History_NodeAdd(history, point);
+  history->stored++;
+}
+
+
+uint16_t History_Count(const s_history *history)
+{
+  return history->count;
+}
+
+
+//---------------------------------------------
+/// \fn const s_historyPoint *History_Get(const s_history *history, uint16_t index)
+///
+/// \brief Read a stored point, in time order.
+/// \param history History to read.
+/// \param index 0 for the oldest point, up to History_Count() - 1.
+/// \return Point.
+const s_historyPoint *History_Get(const s_history *history, uint16_t index)
+{
+  uint32_t slot = history->first + index;
+
+  if(slot >= history->capacity)
+  {
+    slot -= history->capacity;
+  }
+
+  return &history->points[slot];
+}
+
+
+//---------------------------------------------
+/// \fn const s_historyPoint *History_Last(const s_history *history)
+///
+/// \brief Last sample added, even when decimation did not store it: the
+///        current position.
+/// \param history History to read.
+/// \return Point.
+const s_historyPoint *History_Last(const s_history *history)
+{
+  return &history->last;
+}
+
+
+int History_Value(const s_historyPoint *point, e_historyField field)
+{
+  return (field == HISTORY_FIELD_ALT) ? point->alt : point->spd;
+}
+
+
+//---------------------------------------------
+/// \fn uint16_t History_Span(const s_history *history, uint16_t maxColumns)
+///
+/// \brief Points per chart column, so the history fits in a chart.
+/// \param history History to chart.
+/// \param maxColumns Chart width, at least 2.
+/// \return Points per column, a power of 2.
+uint16_t History_Span(const s_history *history, uint16_t maxColumns)
+{
+  uint16_t span = 1;
+
+  while(History_Columns(history, span) > maxColumns)
+  {
+    span *= 2;
+  }
+
+  return span;
+}
+
+
+//---------------------------------------------
+/// \fn uint16_t History_Columns(const s_history *history, uint16_t span)
+///
+/// \brief Nb of columns of a chart of the history. Columns are aligned on
+///        multiples of span stored points, so they match pyramid nodes.
+/// \param history History to chart.
+/// \param span Points per column, from History_Span().
+/// \return Nb of columns.
+uint16_t History_Columns(const s_history *history, uint16_t span)
+{
+  uint32_t base = (history->stored - history->count) & ~(uint32_t)(span - 1);
+
+  return (history->stored - base + span - 1) / span;
+}
+
+
+//---------------------------------------------
+/// \fn void History_Range(const s_history *history, e_historyField field, uint16_t column, uint16_t span, s_historyRange *range)
+///
+/// \brief Min, max and mean of a field over a chart column. One pyramid node
+///        read, or at most 2^HISTORY_NODE_MIN_LEVEL points for small spans.
+/// \param history History to chart.
+/// \param field Field to chart.
+/// \param column Column, 0 to History_Columns() - 1.
+/// \param span Points per column, from History_Span().
+/// \param range Values of the column.
+/// \return None.
+void History_Range(const s_history *history, e_historyField field, uint16_t column, uint16_t span, s_historyRange *range)
+{
+  uint32_t oldest = history->stored - history->count;
+  uint32_t start = (oldest & ~(uint32_t)(span - 1)) + (uint32_t)column * span;
+  uint32_t end = min(start + span, history->stored);
+  uint8_t level = 0;
+  const s_historyNode *node;
+  int32_t sum = 0;
+  int value;
+
+  while((1U << (HISTORY_NODE_MIN_LEVEL + level)) < span)
+  {
+    level++;
+  }
+
+  if((span >= (1U << HISTORY_NODE_MIN_LEVEL)) && (level < history->levels))
+  {
+    node = History_Node(history, level, start >> (HISTORY_NODE_MIN_LEVEL + level));
+    range->min = node->min[field];
+    range->max = node->max[field];
+    range->mean = (node->n > 0) ? node->sum[field] / node->n : 0;
+    return;
+  }
+
+  start = max(start, oldest);
+  range->min = INT16_MAX;
+  range->max = INT16_MIN;
+  for(uint32_t i = start; i < end; i++)
+  {
+    value = History_Value(History_Get(history, i - oldest), field);
+    range->min = min(range->min, (int16_t)value);
+    range->max = max(range->max, (int16_t)value);
+    sum += value;
+  }
+  range->mean = (end > start) ? sum / (int32_t)(end - start) : 0;
+}
+
+
+// Keep every second point, in place, and double the step. Each pyramid level
+// takes the place of the one below, the top one is built again
+static void History_Decimate(s_history *history)
+{
+  uint16_t count = (history->count + 1) / 2;
+  uint32_t nodes;
+  s_historyNode *node;
+
+  for(uint16_t i = 1; i < count; i++)
+  {
+    history->points[i] = history->points[2 * i];
+  }
+
+  for(uint8_t level = 0; level + 1 < history->levels; level++)
+  {
+    nodes = (history->stored + (1U << (HISTORY_NODE_MIN_LEVEL + level + 1)) - 1) >> (HISTORY_NODE_MIN_LEVEL + level + 1);
+    for(uint32_t i = 0; i < nodes; i++)
+    {
+      *History_Node(history, level, i) = *History_Node(history, level + 1, i);
+    }
+  }
+
+  history->count = count;
+  history->stored = count;
+  history->step *= 2;
+
+  if(history->levels > 0)
+  {
+    // Top level: a single node, covering the whole storage
+    node = History_Node(history, history->levels - 1, 0);
+    if(history->levels > 1)
+    {
+      *node = *History_Node(history, history->levels - 2, 0);
+      if(count > (1U << (HISTORY_NODE_MIN_LEVEL + history->levels - 2)))
+      {
+        History_NodeMerge(node, History_Node(history, history->levels - 2, 1));
+      }
+    }
+    else
+    {
+      history->stored = 0;
+      for(uint16_t i = 0; i < count; i++)
+      {
+        History_NodeAdd(history, &history->points[i]);
+        history->stored++;
+      }
+    }
+  }
+}
+
+
+// Node of a level (0 is HISTORY_NODE_MIN_LEVEL) covering a block of stored points
+static s_historyNode *History_Node(const s_history *history, uint8_t level, uint32_t index)
+{
+  return &history->nodes[history->levelOffset[level] + index % history->levelSize[level]];
+}
+
+
+// Add the point about to be stored to the node of each level
+static void History_NodeAdd(s_history *history, const s_historyPoint *point)
+{
+  s_historyNode *node;
+  uint8_t shift;
+  int value;
+
+  for(uint8_t level = 0; level < history->levels; level++)
+  {
+    shift = HISTORY_NODE_MIN_LEVEL + level;
+    node = History_Node(history, level, history->stored >> shift);
+
+    if((history->stored & ((1U << shift) - 1)) == 0)
+    {
+      node->n = 0;
+    }
+
+    for(int field = 0; field < HISTORY_FIELDS; field++)
+    {
+      value = History_Value(point, (e_historyField)field);
+      if(node->n == 0)
+      {
+        node->min[field] = value;
+        node->max[field] = value;
+        node->sum[field] = 0;
+      }
+      node->min[field] = min(node->min[field], (int16_t)value);
+      node->max[field] = max(node->max[field], (int16_t)value);
+      node->sum[field] += value;
+    }
+    node->n++;
+  }
+}
+
+
+static void History_NodeMerge(s_historyNode *node, const s_historyNode *other)
+{
+  for(int field = 0; field < HISTORY_FIELDS; field++)
+  {
+    node->min[field] = min(node->min[field], other->min[field]);
+    node->max[field] = max(node->max[field], other->max[field]);
+    node->sum[field] += other->sum[field];
+  }
+  node->n += other->n;
+}
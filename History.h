@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file History.h
+ * \brief Bounded location history header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _HISTORY_H
+#define _HISTORY_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   HISTORY_FIELDS            2         ///< Charted fields, e_historyField
+#define   HISTORY_NODE_MIN_LEVEL    3         ///< Smallest pyramid node: 8 points; below, points are read
+#define   HISTORY_LEVEL_MAX         16
+#define   HISTORY_NODES(capacity)   ((capacity) / 4 + 2 * HISTORY_LEVEL_MAX)  ///< Pyramid nodes needed for a capacity
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  HISTORY_MODE_RING = 0,          ///< When full, the oldest point is overwritten: last part of the ride
+  HISTORY_MODE_DECIMATE           ///< When full, every second point is dropped: whole ride, coarser
+}e_historyMode;
+
+
+typedef enum
+{
+  HISTORY_FIELD_ALT = 0,
+  HISTORY_FIELD_SPD
+}e_historyField;
+
+
+/// Min, max and sum of the points of a block of 2^level stored points
+typedef struct
+{
+  int16_t   min[HISTORY_FIELDS];
+  int16_t   max[HISTORY_FIELDS];
+  int32_t   sum[HISTORY_FIELDS];
+  uint16_t  n;                    ///< Points summed
+}s_historyNode;
+
+
+typedef struct
+{
+  int16_t   min;
+  int16_t   max;
+  int16_t   mean;
+}s_historyRange;
+
+
+typedef struct
+{
+  int32_t   lat;                  ///< Latitude, in 1e-7 degrees
+  int32_t   lng;                  ///< Longitude, in 1e-7 degrees
+  int16_t   alt;                  ///< Altitude, in meters
+  uint16_t  spd;                  ///< Speed, in km/h
+}s_historyPoint;
+
+
+typedef struct
+{
+  s_historyPoint  *points;        ///< Storage, capacity points
+  uint16_t  capacity;
+  uint16_t  count;                ///< Points stored
+  uint16_t  first;                ///< Slot of the oldest point (ring mode)
+  e_historyMode mode;
+
+  uint32_t  step;                 ///< Samples per stored point (decimate mode), power of 2
+  uint32_t  samples;              ///< Samples added since the history was cleared
+  uint32_t  stored;               ///< Points stored since the history was cleared, decimation applied
+  s_historyPoint last;            ///< Last sample added, stored or not
+
+  s_historyNode *nodes;           ///< Pyramid, HISTORY_NODES(capacity) nodes
+  uint8_t   levels;               ///< Pyramid levels, from HISTORY_NODE_MIN_LEVEL
+  uint16_t  levelOffset[HISTORY_LEVEL_MAX]; ///< First node of each level in nodes
+  uint16_t  levelSize[HISTORY_LEVEL_MAX];   ///< Nodes of each level, used as a ring
+}s_history;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void History_Init(s_history *history, s_historyPoint *points, s_historyNode *nodes, uint16_t capacity, e_historyMode mode);
+extern void History_Clear(s_history *history);
+extern void History_Add(s_history *history, const s_historyPoint *point);
+extern uint16_t History_Count(const s_history *history);
+extern const s_historyPoint *History_Get(const s_history *history, uint16_t index);
+extern const s_historyPoint *History_Last(const s_history *history);
+extern int History_Value(const s_historyPoint *point, e_historyField field);
+extern uint16_t History_Span(const s_history *history, uint16_t maxColumns);
+extern uint16_t History_Columns(const s_history *history, uint16_t span);
+extern void History_Range(const s_history *history, e_historyField field, uint16_t column, uint16_t span, s_historyRange *range);
+
+#endif
@@ -17,6 +17,7 @@
 //---------------------------------------------
 #include "Leds.h"
 #include "GPS.h" 
+#include "RPM.h"
 #include "Settings.h" 
 #include <FastLED.h>
 
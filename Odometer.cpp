@@ -0,0 +1,216 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Odometer.cpp
+ * \brief Trip distance accumulation
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Each step is measured on a local equirectangular projection: a latitude
+ * unit has a constant length, a longitude unit is scaled by cos(lat). cos(lat)
+ * is only evaluated again when latitude drifted more than
+ * ODO_COS_REFRESH_DELTA from the latitude it was computed at.
+ * Steps are a few meters long while the trip reaches hundreds of km, so the
+ * sum is compensated (Kahan) to keep float precision.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Odometer.h"
+#include "GPS_Ingest.h"
+#include "Settings.h"
+
+#ifdef BENCH_ODOMETER
+#include <TinyGPS++.h>
+#include "SimuTrack.h"
+#endif
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   ODO_METERS_PER_LAT        ((float)(ODO_EARTH_RADIUS_M * DEG_TO_RAD / GPS_COORD_SCALE)) ///< Length of a latitude unit, in m
+
+#define   BENCH_TRACK_LENGTH_M      200000.0  ///< Distance covered by the benchmark, track is run back and forth
+#define   BENCH_MAX_ERROR           0.001     ///< Max relative error accepted against haversine
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void ODO_Reset(s_odometer *odo);
+float ODO_Add(s_odometer *odo, int32_t lat, int32_t lng);
+void ODO_Benchmark();
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void ODO_RefreshCos(s_odometer *odo, int32_t lat);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+void ODO_Reset(s_odometer *odo)
+{
+  memset(odo, 0, sizeof(s_odometer));
+}
+
+
+//---------------------------------------------
+/// \fn float ODO_Add(s_odometer *odo, int32_t lat, int32_t lng)
+///
+/// \brief Add the distance from the last location to this one. First call
+///        after ODO_Reset() only records the location.
+/// \param odo Odometer.
+/// \param lat Latitude, in 1e-7 degrees.
+/// \param lng Longitude, in 1e-7 degrees.
+/// \return Step length, in m.
+float ODO_Add(s_odometer *odo, int32_t lat, int32_t lng)
+{
+  float dy, dx, step, y, t;
+
+  if(!odo->started)
+  {
+    odo->started = true;
+    odo->lastLat = lat;
+    odo->lastLng = lng;
+    ODO_RefreshCos(odo, lat);
+    return 0.0f;
+  }
+
+  if(abs(lat - odo->cosLat) > ODO_COS_REFRESH_DELTA)
+  {
+    ODO_RefreshCos(odo, lat);
+  }
+
+  // Deltas are exact in int32, only their length goes through float
+  dy = (float)(lat - odo->lastLat) * ODO_METERS_PER_LAT;
+  dx = (float)(lng - odo->lastLng) * odo->metersPerLng;
+  step = sqrtf(dx * dx + dy * dy);
+
+  y = step - odo->compensation;
+  t = odo->meters + y;
+  odo->compensation = (t - odo->meters) - y;
+  odo->meters = t;
+
+  odo->lastLat = lat;
+  odo->lastLng = lng;
+  odo->steps++;
+
+  return step;
+}
+
+
+static void ODO_RefreshCos(s_odometer *odo, int32_t lat)
+{
+  odo->cosLat = lat;
+  odo->metersPerLng = ODO_METERS_PER_LAT * cosf((lat / (float)GPS_COORD_SCALE) * (float)DEG_TO_RAD);
+  odo->cosRefreshes++;
+}
+
+
+//---------------------------------------------
+/// \fn void ODO_Benchmark()
+///
+/// \brief Run the SIMU_TEST_GPS track back and forth up to
+///        BENCH_TRACK_LENGTH_M, with the odometer and with
+///        TinyGPSPlus::distanceBetween(), and print time and error on Serial.
+/// \param None.
+/// \return None.
+void ODO_Benchmark()
+{
+#if defined(BENCH_ODOMETER) && defined(SIMU_TEST_GPS)
+  s_simuTrack track;
+  s_simuPoint point;
+  int32_t *lat;
+  int32_t *lng;
+  int nbPoints = 0;
+  s_odometer odo;
+  double haversine = 0.0;
+  uint32_t haversineUs = 0;
+  uint32_t odometerUs = 0;
+  uint32_t steps = 0;
+  uint32_t start;
+  int i, prev, dir = 1;
+  double error;
+
+  if(!SIMU_Open(&track))
+  {
+    Serial.println("ODO bench: no valid track");
+    return;
+  }
+
+  lat = (int32_t*)malloc(track.count * sizeof(int32_t));
+  lng = (int32_t*)malloc(track.count * sizeof(int32_t));
+
+  if((lat == NULL) || (lng == NULL) || (track.count < 2))
+  {
+    Serial.println("ODO bench: out of memory");
+    SIMU_Close(&track);
+    free(lat);
+    free(lng);
+    return;
+  }
+
+  while(SIMU_Next(&track, &point))
+  {
+    lat[nbPoints] = point.lat;
+    lng[nbPoints] = point.lng;
+    nbPoints++;
+  }
+  SIMU_Close(&track);
+
+  ODO_Reset(&odo);
+  ODO_Add(&odo, lat[0], lng[0]);
+  prev = 0;
+  i = 1;
+
+  while(haversine < BENCH_TRACK_LENGTH_M)
+  {
+    start = micros();
+    haversine += TinyGPSPlus::distanceBetween(lat[prev] / (double)GPS_COORD_SCALE, lng[prev] / (double)GPS_COORD_SCALE,
+                                              lat[i] / (double)GPS_COORD_SCALE, lng[i] / (double)GPS_COORD_SCALE);
+    haversineUs += micros() - start;
+
+    start = micros();
+    ODO_Add(&odo, lat[i], lng[i]);
+    odometerUs += micros() - start;
+
+    steps++;
+    prev = i;
+    if((i + dir < 0) || (i + dir >= nbPoints))
+    {
+      dir = -dir;
+    }
+    i += dir;
+  }
+
+  error = (odo.meters - haversine) / haversine;
+
+  Serial.printf("ODO bench: %u steps, %u cos refreshes\n", steps, odo.cosRefreshes);
+  Serial.printf("  haversine: %.1f m, %u us (%.2f us/step)\n", haversine, haversineUs, haversineUs / (float)steps);
+  Serial.printf("  odometer : %.1f m, %u us (%.2f us/step)\n", odo.meters, odometerUs, odometerUs / (float)steps);
+  Serial.printf("  error    : %.4f %% %s\n", error * 100.0, (fabs(error) <= BENCH_MAX_ERROR) ? "OK" : "FAIL");
+
+  free(lat);
+  free(lng);
+#endif
+}
@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Odometer.h
+ * \brief Trip distance accumulation header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _ODOMETER_H
+#define _ODOMETER_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   ODO_EARTH_RADIUS_M        6372795.0 ///< Same radius as TinyGPSPlus::distanceBetween()
+#define   ODO_COS_REFRESH_DELTA     100000    ///< Latitude drift refreshing cos(lat), in 1e-7 degrees (0.01 deg, ~1.1 km)
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  bool      started;              ///< A first location has been given
+  int32_t   lastLat;              ///< Last location added, in 1e-7 degrees
+  int32_t   lastLng;
+
+  int32_t   cosLat;               ///< Latitude the longitude scale was computed at
+  float     metersPerLng;         ///< Length of a longitude unit at cosLat, in m
+
+  float     meters;               ///< Distance accumulated
+  float     compensation;         ///< Low order bits lost by the last addition (Kahan)
+
+  uint32_t  steps;                ///< Nb of locations added
+  uint32_t  cosRefreshes;         ///< Nb of cos(lat) evaluations
+}s_odometer;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void ODO_Reset(s_odometer *odo);
+extern float ODO_Add(s_odometer *odo, int32_t lat, int32_t lng);
+extern void ODO_Benchmark();
+
+#endif
@@ -0,0 +1,330 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file RPM.cpp
+ * \brief Engine speed measurement
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Ignition pulses on PIN_RPM_INPUT are counted by the PCNT peripheral, with
+ * its glitch filter enabled. A task wakes up every RPM_GATE_MS and works out
+ * rpm in one of two modes:
+ *  - period: the counter raises an interrupt at each pulse, which only
+ *    pushes its timestamp in a single producer / single consumer ring,
+ *    without lock. The task takes the median of the last RPM_MEDIAN_SIZE
+ *    periods, so a missed or a spurious pulse does not show.
+ *  - count: no interrupt, pulses counted during the gate are read from the
+ *    counter.
+ * Mode switches to count above RPM_COUNT_MODE_HZ pulses per second and back
+ * to period below RPM_PERIOD_MODE_HZ. Interrupt rate is then bounded by
+ * RPM_COUNT_MODE_HZ whatever the engine speed.
+ * rpm is then smoothed by a first order filter of time constant
+ * RPM_FILTER_TAU_MS, its coefficient computed from the real time elapsed
+ * since the previous gate.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <driver/pcnt.h>
+#include <esp_timer.h>
+
+#include "RPM.h"
+#include "Settings.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   RPM_PCNT_UNIT             PCNT_UNIT_0
+#define   RPM_PCNT_CHANNEL          PCNT_CHANNEL_0
+#define   RPM_PCNT_FILTER           1023      ///< Glitch filter, in APB clock cycles (12.8us, max value)
+#define   RPM_PCNT_COUNT_LIMIT      32767     ///< Counter wraps to 0 when reaching it, in count mode
+
+#define   RPM_GATE_MS               100       ///< rpm computation period
+#define   RPM_STALL_US              500000    ///< rpm set to 0 without pulse for this time
+
+#define   RPM_EDGE_RING_SIZE        256       ///< Power of 2, > RPM_COUNT_MODE_HZ * RPM_GATE_MS / 1000
+#define   RPM_MEDIAN_SIZE           5         ///< Periods the median is taken from
+#define   RPM_FILTER_TAU_MS         150       ///< Time constant of the rpm smoothing
+
+#define   RPM_COUNT_MODE_HZ         1000      ///< Pulse rate above which period mode switches to count mode
+#define   RPM_PERIOD_MODE_HZ        400       ///< Pulse rate below which count mode switches to period mode
+
+#define   RPM_TASK_CORE             1         ///< GPS ingest task runs on core 0
+#define   RPM_TASK_PRIORITY         5
+#define   RPM_TASK_STACK            2048
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+float rpm = 0;
+s_rpmStats rpmStats;
+
+// Edge timestamps ring. Head only written by the ISR, tail only by the task
+static volatile uint32_t edgeRing[RPM_EDGE_RING_SIZE];   ///< Edge times, in us (32 bits, differences wrap fine)
+static volatile uint32_t edgeHead;
+static volatile uint32_t edgeTail;
+
+static uint32_t lastEdgeUs;                 ///< Last edge taken out of the ring
+static bool lastEdgeValid;
+static uint32_t periods[RPM_MEDIAN_SIZE];   ///< Last periods between edges, in us
+static uint8_t periodsCount;
+static uint8_t periodsIndex;                ///< Next slot, 0 with periodsCount: the median reads periods[0..periodsCount-1]
+
+static int16_t lastCount;                   ///< Counter value at the previous gate, count mode
+static int64_t lastGateUs;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void RPM_Init();
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void RPM_Task(void *param);
+static void RPM_GatePeriod(int64_t nowUs);
+static void RPM_GateCount(int64_t nowUs);
+static void RPM_SetMode(e_rpmMode mode);
+static uint32_t RPM_MedianPeriod();
+static void RPM_Filter(float rawRpm, int64_t dtUs);
+static void IRAM_ATTR RPM_PulseISR(void *arg);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn void RPM_Init(void)
+///
+/// \brief Configure the pulse counter on PIN_RPM_INPUT (falling edges) and
+///        start the rpm task.
+/// \param None.
+/// \return None.
+void RPM_Init()
+{
+  pcnt_config_t config;
+
+  memset(&config, 0, sizeof(config));
+  config.pulse_gpio_num = PIN_RPM_INPUT;
+  config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  config.channel = RPM_PCNT_CHANNEL;
+  config.unit = RPM_PCNT_UNIT;
+  config.pos_mode = PCNT_COUNT_DIS;
+  config.neg_mode = PCNT_COUNT_INC;
+  config.lctrl_mode = PCNT_MODE_KEEP;
+  config.hctrl_mode = PCNT_MODE_KEEP;
+  config.counter_h_lim = 1;
+  config.counter_l_lim = 0;
+
+  pcnt_unit_config(&config);
+  gpio_pullup_en((gpio_num_t)PIN_RPM_INPUT);
+
+  pcnt_set_filter_value(RPM_PCNT_UNIT, RPM_PCNT_FILTER);
+  pcnt_filter_enable(RPM_PCNT_UNIT);
+
+  pcnt_isr_service_install(0);
+  pcnt_isr_handler_add(RPM_PCNT_UNIT, RPM_PulseISR, NULL);
+
+  rpmStats.mode = RPM_MODE_COUNT;   // Forces the configuration
+  RPM_SetMode(RPM_MODE_PERIOD);
+  rpmStats.modeSwitches = 0;
+
+  lastGateUs = esp_timer_get_time();
+
+  xTaskCreatePinnedToCore(RPM_Task, "rpm", RPM_TASK_STACK, NULL, RPM_TASK_PRIORITY, NULL, RPM_TASK_CORE);
+}
+
+
+static void RPM_Task(void *param)
+{
+  TickType_t wakeTime = xTaskGetTickCount();
+  int64_t nowUs;
+
+  for(;;)
+  {
+    vTaskDelayUntil(&wakeTime, pdMS_TO_TICKS(RPM_GATE_MS));
+
+    nowUs = esp_timer_get_time();
+
+    if(rpmStats.mode == RPM_MODE_PERIOD)
+    {
+      RPM_GatePeriod(nowUs);
+    }
+    else
+    {
+      RPM_GateCount(nowUs);
+    }
+
+    RPM_Filter(rpmStats.rawRpm, nowUs - lastGateUs);
+    lastGateUs = nowUs;
+
+    if((rpmStats.mode == RPM_MODE_PERIOD) && (rpmStats.pulseRate > RPM_COUNT_MODE_HZ))
+    {
+      RPM_SetMode(RPM_MODE_COUNT);
+    }
+    else if((rpmStats.mode == RPM_MODE_COUNT) && (rpmStats.pulseRate < RPM_PERIOD_MODE_HZ))
+    {
+      RPM_SetMode(RPM_MODE_PERIOD);
+    }
+  }
+}
+
+
+static void RPM_GatePeriod(int64_t nowUs)
+{
+  uint32_t head = __atomic_load_n(&edgeHead, __ATOMIC_ACQUIRE);
+  uint32_t tail = edgeTail;
+  uint32_t edges = 0;
+  uint32_t edgeUs;
+
+  while(tail != head)
+  {
+    edgeUs = edgeRing[tail];
+    tail = (tail + 1) & (RPM_EDGE_RING_SIZE - 1);
+    edges++;
+
+    if(lastEdgeValid)
+    {
+      periods[periodsIndex] = edgeUs - lastEdgeUs;
+      periodsIndex = (periodsIndex + 1) % RPM_MEDIAN_SIZE;
+      periodsCount = min(periodsCount + 1, RPM_MEDIAN_SIZE);
+    }
+    lastEdgeUs = edgeUs;
+    lastEdgeValid = true;
+  }
+
+  // Slots released only once read
+  __atomic_store_n(&edgeTail, tail, __ATOMIC_RELEASE);
+
+  rpmStats.interrupts += edges;
+  rpmStats.pulseRate = (uint32_t)(edges * 1000000LL / max(nowUs - lastGateUs, (int64_t)1));
+
+  if((edges == 0) && lastEdgeValid && ((uint32_t)nowUs - lastEdgeUs > RPM_STALL_US))
+  {
+    lastEdgeValid = false;
+    periodsCount = 0;
+    periodsIndex = 0;
+    rpmStats.rawRpm = 0;
+  }
+  else if(periodsCount > 0)
+  {
+    rpmStats.rawRpm = 60000000.0f / ((float)RPM_MedianPeriod() * settings.rpmPulsesPerRev);
+  }
+}
+
+
+static void RPM_GateCount(int64_t nowUs)
+{
+  int16_t count;
+  uint32_t pulses;
+
+  pcnt_get_counter_value(RPM_PCNT_UNIT, &count);
+  pulses = (count - lastCount + RPM_PCNT_COUNT_LIMIT) % RPM_PCNT_COUNT_LIMIT;
+  lastCount = count;
+
+  rpmStats.pulseRate = (uint32_t)(pulses * 1000000LL / max(nowUs - lastGateUs, (int64_t)1));
+  rpmStats.rawRpm = (rpmStats.pulseRate * 60.0f) / settings.rpmPulsesPerRev;
+}
+
+
+static uint32_t RPM_MedianPeriod()
+{
+  uint32_t sorted[RPM_MEDIAN_SIZE];
+  uint32_t value;
+  int i, j;
+
+  // Insertion sort, RPM_MEDIAN_SIZE is small
+  for(i = 0; i < periodsCount; i++)
+  {
+    value = periods[i];
+    for(j = i; (j > 0) && (sorted[j-1] > value); j--)
+    {
+      sorted[j] = sorted[j-1];
+    }
+    sorted[j] = value;
+  }
+
+  return max(sorted[periodsCount / 2], (uint32_t)1);
+}
+
+
+// First order low pass, same response whatever the time between two calls
+static void RPM_Filter(float rawRpm, int64_t dtUs)
+{
+  float alpha = 1.0f - expf(-(float)dtUs / (RPM_FILTER_TAU_MS * 1000.0f));
+
+  rpm += alpha * (rawRpm - rpm);
+}
+
+
+// Period mode: limit 1, every pulse raises the interrupt. Count mode: counter runs up to RPM_PCNT_COUNT_LIMIT, no interrupt
+static void RPM_SetMode(e_rpmMode mode)
+{
+  if(mode == rpmStats.mode)
+  {
+    return;
+  }
+
+  pcnt_counter_pause(RPM_PCNT_UNIT);
+
+  if(mode == RPM_MODE_PERIOD)
+  {
+    // Edges pushed after the last period gate, before count mode, are dropped:
+    // they are older than the count mode time. The interrupt is still off and
+    // the counter paused, so head does not move; this task, the consumer, may
+    // take tail to it. Periods start again from the first new edge
+    __atomic_store_n(&edgeTail, __atomic_load_n(&edgeHead, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    lastEdgeValid = false;
+    periodsCount = 0;
+    periodsIndex = 0;
+
+    pcnt_set_event_value(RPM_PCNT_UNIT, PCNT_EVT_H_LIM, 1);
+    pcnt_event_enable(RPM_PCNT_UNIT, PCNT_EVT_H_LIM);
+    pcnt_intr_enable(RPM_PCNT_UNIT);
+  }
+  else
+  {
+    pcnt_intr_disable(RPM_PCNT_UNIT);
+    pcnt_event_disable(RPM_PCNT_UNIT, PCNT_EVT_H_LIM);
+    pcnt_set_event_value(RPM_PCNT_UNIT, PCNT_EVT_H_LIM, RPM_PCNT_COUNT_LIMIT);
+    lastCount = 0;
+  }
+
+  pcnt_counter_clear(RPM_PCNT_UNIT);
+  pcnt_counter_resume(RPM_PCNT_UNIT);
+
+  rpmStats.mode = mode;
+  rpmStats.modeSwitches++;
+}
+
+
+// Only producer of the ring. A full ring drops the edge
+static void IRAM_ATTR RPM_PulseISR(void *arg)
+{
+  uint32_t head = edgeHead;
+  uint32_t next = (head + 1) & (RPM_EDGE_RING_SIZE - 1);
+
+  if(next == __atomic_load_n(&edgeTail, __ATOMIC_ACQUIRE))
+  {
+    rpmStats.overruns++;
+    return;
+  }
+
+  edgeRing[head] = (uint32_t)esp_timer_get_time();
+  __atomic_store_n(&edgeHead, next, __ATOMIC_RELEASE);
+}
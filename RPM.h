@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file RPM.h
+ * \brief Engine speed measurement header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _RPM_H
+#define _RPM_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  RPM_MODE_PERIOD = 0,            ///< Low engine speed: time between pulses, one interrupt per pulse
+  RPM_MODE_COUNT                  ///< High engine speed: pulses counted over the gate, no interrupt
+}e_rpmMode;
+
+
+typedef struct
+{
+  e_rpmMode mode;
+  uint32_t  pulseRate;            ///< Pulses per second measured over the last gate
+  float     rawRpm;               ///< rpm of the last gate, before smoothing
+  uint32_t  interrupts;           ///< Pulse counter interrupts served (period mode only)
+  uint32_t  overruns;             ///< Edges dropped, ring full
+  uint32_t  modeSwitches;
+}s_rpmStats;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+extern float rpm;                 ///< Smoothed engine speed
+extern s_rpmStats rpmStats;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void RPM_Init();
+
+#endif
@@ -56,6 +56,10 @@ int Settings_MaxRpm();
 void Settings_MaxRpm_Dec();
 void Settings_MaxRpm_Inc();
 
+int Settings_RpmPulsesPerRev();
+void Settings_RpmPulsesPerRev_Dec();
+void Settings_RpmPulsesPerRev_Inc();
+
 int Settings_LedBrightness();
 void Settings_LedBrightness_Dec();
 void Settings_LedBrightness_Inc();
@@ -89,6 +93,7 @@ void Settings_Init()
   settings.webServerEnable = false;
   settings.brandLogo = 0;
   settings.mainDisplayStyle = 0;
+  settings.rpmPulsesPerRev = 1;
    
   Settings_Load();
 
@@ -110,7 +115,8 @@ void Settings_Load()
   char buffer[dataLen];
   prefs.getBytes("saveData", buffer, dataLen);
   
-  if(dataLen != sizeof(s_settings))
+  // Saves from before rpmPulsesPerRev end at it: fields appended since keep their default
+  if((dataLen < offsetof(s_settings, rpmPulsesPerRev)) || (dataLen > sizeof(s_settings)))
   {
     Serial.print("Data is not correct size (expected ");
     Serial.print(sizeof(s_settings));
@@ -118,7 +124,9 @@ void Settings_Load()
     Settings_Save();
     return;
   }
-  s_settings *temp = (s_settings *) buffer;
+  s_settings defaults = settings;
+  s_settings *temp = &defaults;
+  memcpy(temp, buffer, dataLen);
 
   settings.maxRPM = temp->maxRPM; 
   settings.ledEnabled = temp->ledEnabled;
@@ -126,6 +134,13 @@ void Settings_Load()
   settings.webServerEnable = temp->webServerEnable;
   settings.mainDisplayStyle = temp->mainDisplayStyle;
   settings.brandLogo = temp->brandLogo;
+  settings.rpmPulsesPerRev = constrain(temp->rpmPulsesPerRev, RPM_PULSES_PER_REV_MIN, RPM_PULSES_PER_REV_MAX);
+
+  // Older save: written again with the new fields
+  if(dataLen != sizeof(s_settings))
+  {
+    Settings_Save();
+  }
 }
 
 
@@ -189,6 +204,30 @@ void Settings_MaxRpm_Inc()
 }
 
 
+int Settings_RpmPulsesPerRev()
+{
+  return settings.rpmPulsesPerRev;
+}
+
+
+void Settings_RpmPulsesPerRev_Dec()
+{
+  if(settings.rpmPulsesPerRev > RPM_PULSES_PER_REV_MIN)
+  {
+    settings.rpmPulsesPerRev--;
+  }
+}
+
+
+void Settings_RpmPulsesPerRev_Inc()
+{
+  if(settings.rpmPulsesPerRev < RPM_PULSES_PER_REV_MAX)
+  {
+    settings.rpmPulsesPerRev++;
+  }
+}
+
+
 int Settings_LedBrightness()
 {
   return settings.ledBrightness;
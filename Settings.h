@@ -19,7 +19,34 @@
 //---------------------------------------------
 // Defines
 //---------------------------------------------
-//#define   SIMU_TEST_GPS
+//#define   SIMU_TEST_GPS               ///< History filled with a recorded track (/simu_track.bin, or the one embedded from simu_track.h)
+//#define   GPS_PROTOCOL_UBX            ///< GPS module configured to send UBX NAV-PVT frames instead of NMEA sentences
+#define   GPS_NAV_RATE_HZ   10        ///< GPS navigation rate: 1, 5, 10 or 20 Hz
+
+#define   HISTORY_BUDGET_BYTES  24576     ///< RAM of the ride history (stats screen), 17 bytes per point with the chart pyramid
+#define   HISTORY_MODE      HISTORY_MODE_DECIMATE ///< History full: HISTORY_MODE_DECIMATE keeps the whole ride, HISTORY_MODE_RING the last part
+
+//#define   GPS_REPLAY_FILE   "/replay.nmea"  ///< At boot, replay this capture instead of reading the receiver, and print a report
+#define   GPS_REPLAY_SPEED  1.0f      ///< Replay speed factor, 0 to replay as fast as possible
+
+//#define   BENCH_ODOMETER              ///< At boot, compare trip odometer with haversine on SIMU_TEST_GPS track (needs SIMU_TEST_GPS)
+//#define   BENCH_TRIPLOG               ///< At boot, compare buffered trip log with per record append on the file system
+//#define   BENCH_FORMAT                ///< At boot, compare sprintf() and Format cycles per main screen frame
+//#define   BENCH_FILE                  ///< At boot, compare append, listing and download throughput of each file system backend
+//#define   BENCH_OLED                  ///< At boot, compare bit-banged and DMA OLED frame flush times
+
+#define   FILE_BACKEND      FILE_BACKEND_SD       ///< File system used: FILE_BACKEND_SD, FILE_BACKEND_LITTLEFS or FILE_BACKEND_SPIFFS
+#define   FILE_INTERNAL_FS  FILE_BACKEND_SPIFFS   ///< Flash file system used without SD card; changing it formats the partition
+
+#define   OLED_SPI_CLOCK_HZ 10000000  ///< OLED SPI clock, hardware transport (SSD1309 serial interface: 10 MHz max)
+//#define   OLED_SW_SPI                 ///< OLED driven by bit-banged pins (u8g2 software SPI) instead of VSPI with DMA
+
+#define   RENDER_FPS_MAIN   30        ///< Render task frame rates: main screens (speed, track, stats)
+#define   RENDER_FPS_MENU   5         ///< Menus and settings
+#define   RENDER_FPS_MEMORY 1         ///< Memory page
+#define   RENDER_FPS_LEDS   50        ///< Leds (fast blink is 50 ms)
+#define   RENDER_FPS_TRANSITION 60    ///< Screen change animations
+#define   TRANSITION_DURATION_MS 250  ///< Duration of a screen change animation
 
 #define   SPLASH_LOGO_DURATION_MS    3000      ///< Duration of the brand logo displayed at boot, in ms
 
@@ -34,13 +61,26 @@
 
 #define   PIN_LEDS          0
 
-#define   PIN_RPM_INPUT     21        ///< Pin used for external RPM calculation
+#define   PIN_RPM_INPUT     21        ///< Pin used for external RPM calculation, counted by PCNT (see RPM.cpp)
+
+#define   PIN_GPS_RX        16
+#define   PIN_GPS_TX        17
+
+#define   PIN_SD_CLOCK      14        ///< SD card on HSPI (VSPI is the OLED one)
+#define   PIN_SD_MOSI       13
+#define   PIN_SD_MISO       27
+#define   PIN_SD_CS         15
 
 
 
 #define MAXRPM_MIN          1000
 #define MAXRPM_MAX          15000
 
+// At 1 pulse per revolution, MAXRPM_MAX is 250 pulses/s: RPM.cpp stays in
+// period mode, its count mode only starts above 1000 pulses/s
+#define RPM_PULSES_PER_REV_MIN  1
+#define RPM_PULSES_PER_REV_MAX  8
+
 #define LEDBRIGHTNESS_MIN   3
 #define LEDBRIGHTNESS_MAX   50
 
@@ -59,6 +99,8 @@ typedef struct
   int mainDisplayStyle;
   int brandLogo;
   char* softVersion;
+  int rpmPulsesPerRev;      ///< Ignition pulses per engine revolution, on PIN_RPM_INPUT
+  // New fields at the end only: Settings_Load() reads older, shorter saves
 }s_settings;
 
 
@@ -89,6 +131,10 @@ extern int Settings_MaxRpm();
 extern void Settings_MaxRpm_Dec();
 extern void Settings_MaxRpm_Inc();
 
+extern int Settings_RpmPulsesPerRev();
+extern void Settings_RpmPulsesPerRev_Dec();
+extern void Settings_RpmPulsesPerRev_Inc();
+
 extern int Settings_LedBrightness();
 extern void Settings_LedBrightness_Dec();
 extern void Settings_LedBrightness_Inc();
@@ -0,0 +1,253 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file SimuTrack.cpp
+ * \brief Simulated track (SIMU_TEST_GPS)
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Track format, written by tools/simu_track.py:
+ *  - "STRK", version (1 byte), reserved (1 byte), nb of points (2 bytes LE)
+ *  - per point, difference with the previous point (0 before the first one)
+ *    of latitude, longitude (1e-7 degrees) and altitude (m), each as a
+ *    zigzag varint.
+ * The track is read from SIMU_TRACK_FILE when the file system has it, from
+ * the blob embedded in the firmware (simu_track.h) otherwise.
+ * Nothing is built without SIMU_TEST_GPS.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "SimuTrack.h"
+#include "File.h"
+#include "Settings.h"
+
+#ifdef SIMU_TEST_GPS
+#include "simu_track.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   SIMU_TRACK_MAGIC          "STRK"
+#define   SIMU_TRACK_VERSION        1
+#define   SIMU_TRACK_HEADER_SIZE    8
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+static bool historyLoaded = false;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+bool SIMU_Open(s_simuTrack *track);
+bool SIMU_Next(s_simuTrack *track, s_simuPoint *point);
+void SIMU_Close(s_simuTrack *track);
+void SIMU_LoadHistory(s_history *history, s_track *displayTrack);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static int SIMU_ReadByte(s_simuTrack *track);
+static bool SIMU_ReadVarint(s_simuTrack *track, int32_t *value);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn bool SIMU_Open(s_simuTrack *track)
+///
+/// \brief Open the track and read its header.
+/// \param track Reader to initialize.
+/// \return false if the track is not valid.
+bool SIMU_Open(s_simuTrack *track)
+{
+  uint8_t header[SIMU_TRACK_HEADER_SIZE];
+
+  track->fromFile = false;
+  track->blobPos = 0;
+  track->buffLength = 0;
+  track->buffPos = 0;
+  track->index = 0;
+  memset(&track->point, 0, sizeof(s_simuPoint));
+
+  if(fileSystem.exists(SIMU_TRACK_FILE))
+  {
+    track->file = fileSystem.open(SIMU_TRACK_FILE, FILE_READ);
+    track->fromFile = (bool)track->file;
+  }
+
+  for(int i = 0; i < SIMU_TRACK_HEADER_SIZE; i++)
+  {
+    int c = SIMU_ReadByte(track);
+    if(c < 0)
+    {
+      SIMU_Close(track);
+      return false;
+    }
+    header[i] = c;
+  }
+
+  if((memcmp(header, SIMU_TRACK_MAGIC, 4) != 0) || (header[4] != SIMU_TRACK_VERSION))
+  {
+    SIMU_Close(track);
+    return false;
+  }
+
+  track->count = header[6] | (header[7] << 8);
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn bool SIMU_Next(s_simuTrack *track, s_simuPoint *point)
+///
+/// \brief Read the next point of the track.
+/// \param track Opened reader.
+/// \param point Destination of the point.
+/// \return false at end of track, or if the track is truncated.
+bool SIMU_Next(s_simuTrack *track, s_simuPoint *point)
+{
+  int32_t dLat, dLng, dAlt;
+
+  if(track->index >= track->count)
+  {
+    return false;
+  }
+
+  if(!SIMU_ReadVarint(track, &dLat) || !SIMU_ReadVarint(track, &dLng) || !SIMU_ReadVarint(track, &dAlt))
+  {
+    return false;
+  }
+
+  track->point.lat += dLat;
+  track->point.lng += dLng;
+  track->point.alt += dAlt;
+  track->index++;
+
+  *point = track->point;
+
+  return true;
+}
+
+
+void SIMU_Close(s_simuTrack *track)
+{
+  if(track->fromFile)
+  {
+    track->file.close();
+    track->fromFile = false;
+  }
+}
+
+
+//---------------------------------------------
+/// \fn void SIMU_LoadHistory(s_history *history, s_track *displayTrack)
+///
+/// \brief Fill the history and the display track with the track, on first
+///        call only. Called by the screens using them, so the track is not
+///        read unless displayed.
+/// \param history History to fill.
+/// \param displayTrack Display track to fill.
+/// \return None.
+void SIMU_LoadHistory(s_history *history, s_track *displayTrack)
+{
+  s_simuTrack track;
+  s_simuPoint point;
+  s_historyPoint historyPoint;
+
+  if(historyLoaded)
+  {
+    return;
+  }
+  historyLoaded = true;
+
+  if(!SIMU_Open(&track))
+  {
+    Serial.println("SIMU: no valid track");
+    return;
+  }
+
+  while(SIMU_Next(&track, &point))
+  {
+    historyPoint.lat = point.lat;
+    historyPoint.lng = point.lng;
+    historyPoint.alt = point.alt;
+    historyPoint.spd = point.alt;
+    History_Add(history, &historyPoint);
+    Track_Add(displayTrack, point.lat, point.lng);
+  }
+
+  SIMU_Close(&track);
+}
+
+
+static int SIMU_ReadByte(s_simuTrack *track)
+{
+  size_t len;
+
+  if(track->buffPos >= track->buffLength)
+  {
+    if(track->fromFile)
+    {
+      len = track->file.read(track->buff, SIMU_TRACK_BUFFER_SIZE);
+    }
+    else
+    {
+      len = min((size_t)SIMU_TRACK_BUFFER_SIZE, sizeof(simu_track_bin) - track->blobPos);
+      memcpy(track->buff, &simu_track_bin[track->blobPos], len);
+      track->blobPos += len;
+    }
+
+    if(len == 0)
+    {
+      return -1;
+    }
+    track->buffLength = len;
+    track->buffPos = 0;
+  }
+
+  return track->buff[track->buffPos++];
+}
+
+
+static bool SIMU_ReadVarint(s_simuTrack *track, int32_t *value)
+{
+  uint32_t zigzag = 0;
+  int shift = 0;
+  int c;
+
+  do
+  {
+    c = SIMU_ReadByte(track);
+    if((c < 0) || (shift > 28))
+    {
+      return false;
+    }
+    zigzag |= (uint32_t)(c & 0x7F) << shift;
+    shift += 7;
+  }while(c & 0x80);
+
+  *value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+
+  return true;
+}
+
+#endif
@@ -0,0 +1,77 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file SimuTrack.h
+ * \brief Simulated track (SIMU_TEST_GPS) header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _SIMU_TRACK_H_
+#define _SIMU_TRACK_H_
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include "FS.h"
+#include "GPS.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   SIMU_TRACK_FILE           "/simu_track.bin"   ///< Used instead of the embedded track when present
+#define   SIMU_TRACK_BUFFER_SIZE    64
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  int32_t   lat;                  ///< Latitude, in 1e-7 degrees
+  int32_t   lng;                  ///< Longitude, in 1e-7 degrees
+  int32_t   alt;                  ///< Altitude, in meters
+}s_simuPoint;
+
+
+/// Track reader, streaming points out of the file or of the embedded blob
+typedef struct
+{
+  fs::File  file;
+  bool      fromFile;
+  size_t    blobPos;              ///< Next byte of the embedded blob to buffer
+
+  uint8_t   buff[SIMU_TRACK_BUFFER_SIZE];
+  uint8_t   buffLength;
+  uint8_t   buffPos;
+
+  uint16_t  count;                ///< Nb of points in the track
+  uint16_t  index;                ///< Nb of points read
+  s_simuPoint point;              ///< Last point read, deltas are applied to it
+}s_simuTrack;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern bool SIMU_Open(s_simuTrack *track);
+extern bool SIMU_Next(s_simuTrack *track, s_simuPoint *point);
+extern void SIMU_Close(s_simuTrack *track);
+extern void SIMU_LoadHistory(s_history *history, s_track *displayTrack);
+
+#endif
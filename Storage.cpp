@@ -0,0 +1,402 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Storage.cpp
+ * \brief Storage task
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Trip records are not written by loop(): they are put in a single producer
+ * / single consumer queue, without lock, and the storage task encodes and
+ * writes them through the trip log. loop() never waits for the file system,
+ * whatever SPIFFS garbage collection takes.
+ * The task wakes up every STORAGE_BATCH_MS, or as soon as STORAGE_BATCH_SIZE
+ * items or a trip open / close / sync are waiting, and handles all of them.
+ * A full queue refuses items: the push functions return false and the drop
+ * is counted (back-pressure is on the producer, which never blocks).
+ * Only loop() may push items.
+ * The trip log is only used by the storage task. On software restart
+ * (firmware update, requested from loop()), the shutdown handler queues the
+ * trip close and waits for the task to have done it, STORAGE_SHUTDOWN_MS
+ * at most for each.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <esp_system.h>
+
+#include "Storage.h"
+#include "TripLog.h"
+#include "File.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   STORAGE_BATCH_SIZE        16        ///< Queued records waking the task up
+#define   STORAGE_BATCH_MS          1000      ///< Longest time records wait in the queue
+#define   STORAGE_SHUTDOWN_MS       2000      ///< Longest wait to queue, then to handle, the trip close on restart
+
+#define   STORAGE_TASK_CORE         0         ///< Away from loop(), below GPS ingest priority
+#define   STORAGE_TASK_PRIORITY     2
+#define   STORAGE_TASK_STACK        4096
+
+//#define DEBUG_STORAGE
+#define   STORAGE_STATS_PERIOD_MS   10000     ///< Period of the statistics print, with DEBUG_STORAGE
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  STORAGE_ITEM_RECORD = 0,
+  STORAGE_ITEM_OPEN,
+  STORAGE_ITEM_CLOSE,
+  STORAGE_ITEM_SYNC
+}e_storageItem;
+
+
+typedef struct
+{
+  e_storageItem type;
+  union
+  {
+    s_tripRecord record;                    ///< STORAGE_ITEM_RECORD
+    struct
+    {
+      char      path[STORAGE_PATH_SIZE];
+      uint32_t  startTime;
+      int32_t   timeZone;
+    }open;                                  ///< STORAGE_ITEM_OPEN
+  };
+}s_storageItem;
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+s_storageStats storageStats;
+
+// Item queue. Head only written by loop(), tail only by the storage task
+static s_storageItem queue[STORAGE_QUEUE_SIZE];
+static volatile uint32_t queueHead;
+static volatile uint32_t queueTail;
+
+static TaskHandle_t storageTaskHandle = NULL;
+static SemaphoreHandle_t syncSemaphore = NULL;
+
+static s_tripFileEncoder encoder;           ///< Used by the storage task only
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void Storage_Init();
+bool Storage_OpenTrip(const char *path, uint32_t startTime, int32_t timeZone);
+bool Storage_Record(const s_tripRecord *record);
+bool Storage_CloseTrip();
+bool Storage_Sync(uint32_t timeoutMs);
+void Storage_PrintStats();
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void Storage_Task(void *param);
+static void Storage_Handle(const s_storageItem *item);
+static s_storageItem *Storage_Reserve();
+static void Storage_Commit(bool wake);
+static void Storage_Shutdown();
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn void Storage_Init(void)
+///
+/// \brief Start the storage task, and close the trip file through it on
+///        software restart. The file system must be mounted.
+/// \param None.
+/// \return None.
+void Storage_Init()
+{
+  syncSemaphore = xSemaphoreCreateBinary();
+
+  xTaskCreatePinnedToCore(Storage_Task, "storage", STORAGE_TASK_STACK, NULL,
+                          STORAGE_TASK_PRIORITY, &storageTaskHandle, STORAGE_TASK_CORE);
+
+  esp_register_shutdown_handler(Storage_Shutdown);
+}
+
+
+//---------------------------------------------
+/// \fn bool Storage_OpenTrip(const char *path, uint32_t startTime, int32_t timeZone)
+///
+/// \brief Queue the creation of a trip file. Following records go to it.
+/// \param path Trip file, STORAGE_PATH_SIZE characters at most.
+/// \param startTime UTC time of the trip start, in s since 01/01/1970.
+/// \param timeZone Local time offset, in s.
+/// \return false if the queue is full.
+bool Storage_OpenTrip(const char *path, uint32_t startTime, int32_t timeZone)
+{
+  s_storageItem *item = Storage_Reserve();
+
+  if(item == NULL)
+  {
+    return false;
+  }
+
+  item->type = STORAGE_ITEM_OPEN;
+  snprintf(item->open.path, STORAGE_PATH_SIZE, "%s", path);
+  item->open.startTime = startTime;
+  item->open.timeZone = timeZone;
+  Storage_Commit(true);
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn bool Storage_Record(const s_tripRecord *record)
+///
+/// \brief Queue a record for the trip file. Never blocks.
+/// \param record Record to write.
+/// \return false if the queue is full, the record is dropped.
+bool Storage_Record(const s_tripRecord *record)
+{
+  s_storageItem *item = Storage_Reserve();
+
+  if(item == NULL)
+  {
+    return false;
+  }
+
+  item->type = STORAGE_ITEM_RECORD;
+  item->record = *record;
+  Storage_Commit(false);
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn bool Storage_CloseTrip(void)
+///
+/// \brief Queue the end of the trip: records are written and the file
+///        closed.
+/// \param None.
+/// \return false if the queue is full.
+bool Storage_CloseTrip()
+{
+  s_storageItem *item = Storage_Reserve();
+
+  if(item == NULL)
+  {
+    return false;
+  }
+
+  item->type = STORAGE_ITEM_CLOSE;
+  Storage_Commit(true);
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn bool Storage_Sync(uint32_t timeoutMs)
+///
+/// \brief Write all queued records to the trip file and wait for it, so the
+///        file can be read. Blocks: not for the real time path.
+/// \param timeoutMs Longest wait, in ms.
+/// \return false if records could not be written in time.
+bool Storage_Sync(uint32_t timeoutMs)
+{
+  s_storageItem *item;
+
+  if(storageTaskHandle == NULL)
+  {
+    return false;
+  }
+
+  item = Storage_Reserve();
+  if(item == NULL)
+  {
+    return false;
+  }
+
+  xSemaphoreTake(syncSemaphore, 0);     // Left by a sync that timed out
+  item->type = STORAGE_ITEM_SYNC;
+  Storage_Commit(true);
+
+  return xSemaphoreTake(syncSemaphore, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+
+
+//---------------------------------------------
+/// \fn void Storage_PrintStats(void)
+///
+/// \brief Print queue and trip log counters on Serial.
+/// \param None.
+/// \return None.
+void Storage_PrintStats()
+{
+  Serial.printf("Storage: %u queued, %u dropped, max depth %u/%u, %u records in %u batches, longest %u us\r\n",
+                storageStats.pushed, storageStats.drops, storageStats.maxDepth, STORAGE_QUEUE_SIZE - 1,
+                storageStats.records, storageStats.batches, storageStats.maxBatchUs);
+  Serial.printf("- %u records lost, %u trip files not created\r\n",
+                storageStats.writeErrors, storageStats.openErrors);
+  Serial.printf("- trip log: %u bytes, %u flushes, %u errors, longest write %u us\r\n",
+                tripLogStats.bytes, tripLogStats.flushes, tripLogStats.errors, tripLogStats.maxStallUs);
+}
+
+
+static void Storage_Task(void *param)
+{
+  uint32_t head, tail;
+  uint32_t startUs, batchUs;
+
+  for(;;)
+  {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(STORAGE_BATCH_MS));
+
+    head = __atomic_load_n(&queueHead, __ATOMIC_ACQUIRE);
+    tail = queueTail;
+    if(tail == head)
+    {
+      continue;
+    }
+
+    startUs = micros();
+
+    while(tail != head)
+    {
+      Storage_Handle(&queue[tail]);
+      tail = (tail + 1) & (STORAGE_QUEUE_SIZE - 1);
+
+      // Slot released only once handled
+      __atomic_store_n(&queueTail, tail, __ATOMIC_RELEASE);
+    }
+
+    batchUs = micros() - startUs;
+    storageStats.batches++;
+    if(batchUs > storageStats.maxBatchUs)
+    {
+      storageStats.maxBatchUs = batchUs;
+    }
+
+#ifdef DEBUG_STORAGE
+    static unsigned long statsMillis = 0;
+    if(millis() - statsMillis >= STORAGE_STATS_PERIOD_MS)
+    {
+      statsMillis = millis();
+      Storage_PrintStats();
+    }
+#endif
+  }
+}
+
+
+static void Storage_Handle(const s_storageItem *item)
+{
+  uint8_t buff[TRIPFILE_RECORD_MAX_SIZE];
+
+  switch(item->type)
+  {
+    case STORAGE_ITEM_RECORD:
+      if(TripLog_Write(buff, TripFile_EncodeRecord(&encoder, buff, &item->record)))
+      {
+        storageStats.records++;
+      }
+      else
+      {
+        storageStats.writeErrors++;
+      }
+      break;
+
+    case STORAGE_ITEM_OPEN:
+      // SD card pulled out or file system full: the records of this trip are counted as lost
+      if(!TripLog_Open(fileSystem, item->open.path)
+      || !TripLog_Write(buff, TripFile_EncodeHeader(&encoder, buff, item->open.startTime, item->open.timeZone)))
+      {
+        TripLog_Close();
+        storageStats.openErrors++;
+        Serial.printf("Trip file %s not created, records lost\r\n", item->open.path);
+      }
+      break;
+
+    case STORAGE_ITEM_CLOSE:
+      TripLog_Close();
+      break;
+
+    case STORAGE_ITEM_SYNC:
+      TripLog_Flush();
+      xSemaphoreGive(syncSemaphore);
+      break;
+  }
+}
+
+
+// Free slot at queue head, NULL if the queue is full
+static s_storageItem *Storage_Reserve()
+{
+  uint32_t head = queueHead;
+  uint32_t next = (head + 1) & (STORAGE_QUEUE_SIZE - 1);
+
+  if(next == __atomic_load_n(&queueTail, __ATOMIC_ACQUIRE))
+  {
+    storageStats.drops++;
+    return NULL;
+  }
+
+  return &queue[head];
+}
+
+
+// Publish the reserved slot to the storage task
+static void Storage_Commit(bool wake)
+{
+  uint32_t head = (queueHead + 1) & (STORAGE_QUEUE_SIZE - 1);
+  uint32_t depth;
+
+  __atomic_store_n(&queueHead, head, __ATOMIC_RELEASE);
+  storageStats.pushed++;
+
+  depth = (head - queueTail) & (STORAGE_QUEUE_SIZE - 1);
+  if(depth > storageStats.maxDepth)
+  {
+    storageStats.maxDepth = depth;
+  }
+
+  if((wake || (depth >= STORAGE_BATCH_SIZE)) && (storageTaskHandle != NULL))
+  {
+    xTaskNotifyGive(storageTaskHandle);
+  }
+}
+
+
+// Restart handler, run by the task calling esp_restart(): loop(), the queue
+// producer. The storage task closes the trip, restart waits for it
+static void Storage_Shutdown()
+{
+  uint32_t startMillis = millis();
+
+  // Queue full: the task frees slots within a batch
+  while(!Storage_CloseTrip())
+  {
+    if(millis() - startMillis >= STORAGE_SHUTDOWN_MS)
+    {
+      return;
+    }
+    vTaskDelay(1);
+  }
+
+  Storage_Sync(STORAGE_SHUTDOWN_MS);
+}
@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Storage.h
+ * \brief Storage task header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _STORAGE_H
+#define _STORAGE_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include "TripFile.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   STORAGE_QUEUE_SIZE        64        ///< Power of 2; one slot stays empty
+#define   STORAGE_PATH_SIZE         32
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  uint32_t  pushed;               ///< Items queued
+  uint32_t  drops;                ///< Items refused, queue full
+  uint32_t  records;              ///< Records taken by the trip log
+  uint32_t  writeErrors;          ///< Records refused by the trip log (no file open), lost
+  uint32_t  openErrors;           ///< Trip files not created: records are lost until the next open
+  uint32_t  batches;              ///< Task wake-ups with items to handle
+  uint32_t  maxDepth;             ///< Most items waiting in the queue
+  uint32_t  maxBatchUs;           ///< Longest batch, file system time included
+}s_storageStats;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+extern s_storageStats storageStats;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void Storage_Init();
+extern bool Storage_OpenTrip(const char *path, uint32_t startTime, int32_t timeZone);
+extern bool Storage_Record(const s_tripRecord *record);
+extern bool Storage_CloseTrip();
+extern bool Storage_Sync(uint32_t timeoutMs);
+extern void Storage_PrintStats();
+
+#endif
@@ -0,0 +1,329 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Track.cpp
+ * \brief Simplified display track
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Track of the ride as drawn on the 128x64 screen: only the vertices needed
+ * to stay within TRACK_TOLERANCE_PX of every location, at the current screen
+ * scale. Locations are simplified as they arrive (opening window): points
+ * since the last vertex wait in a window; when a new location makes one of
+ * them deviate more than the tolerance from the segment last vertex - new
+ * location, the previous location becomes a vertex.
+ * Straight lines and stops cost no vertex, so memory and drawing time follow
+ * the shape of the track, not the ride length. If TRACK_SIZE vertices are
+ * reached, the track is simplified again with a doubled tolerance.
+ * The full resolution ride stays in the trip file and in the history.
+ *
+ * The screen view is a bitmap the vertices are drawn in once, as they are
+ * added. The view scale only changes when the track leaves it, and then
+ * leaves a margin around the track, so redrawing all the vertices is rare;
+ * a frame copies the bitmap and draws from the last vertex to the current
+ * position.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Track.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void Track_Clear(s_track *track);
+void Track_Add(s_track *track, int32_t lat, int32_t lng);
+const s_trackPoint *Track_Current(const s_track *track);
+const uint8_t *Track_Render(s_track *track);
+void Track_Project(const s_track *track, const s_trackPoint *point, int *x, int *y);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void Track_Rescale(s_track *track);
+static void Track_DrawLine(s_track *track, int x0, int y0, int x1, int y1);
+static void Track_AddVertex(s_track *track, const s_trackPoint *point);
+static void Track_Compact(s_track *track);
+static float Track_Deviation(const s_track *track, const s_trackPoint *point, const s_trackPoint *start, const s_trackPoint *end);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+void Track_Clear(s_track *track)
+{
+  track->count = 0;
+  track->windowCount = 0;
+  track->minLat = INT32_MAX;
+  track->maxLat = INT32_MIN;
+  track->minLng = INT32_MAX;
+  track->maxLng = INT32_MIN;
+  track->tolerance = TRACK_TOLERANCE_PX;
+  track->added = 0;
+  track->compactions = 0;
+  track->rendered = 0;
+  track->rescales = 0;
+  track->viewMinLat = 0;
+  track->viewMaxLat = -1;           // Empty view, rescaled by the first render
+  track->viewMinLng = 0;
+  track->viewMaxLng = -1;
+}
+
+
+//---------------------------------------------
+/// \fn void Track_Add(s_track *track, int32_t lat, int32_t lng)
+///
+/// \brief Add a location; at most TRACK_WINDOW_SIZE distance computations.
+/// \param track Track to add to.
+/// \param lat Latitude, in 1e-7 degrees.
+/// \param lng Longitude, in 1e-7 degrees.
+/// \return None.
+void Track_Add(s_track *track, int32_t lat, int32_t lng)
+{
+  s_trackPoint point = { lat, lng };
+  const s_trackPoint *anchor;
+
+  track->added++;
+  track->minLat = min(track->minLat, lat);
+  track->maxLat = max(track->maxLat, lat);
+  track->minLng = min(track->minLng, lng);
+  track->maxLng = max(track->maxLng, lng);
+
+  if(track->count == 0)
+  {
+    Track_AddVertex(track, &point);
+    return;
+  }
+
+  anchor = &track->vertices[track->count - 1];
+
+  for(int i = 0; i < track->windowCount; i++)
+  {
+    if(Track_Deviation(track, &track->window[i], anchor, &point) > track->tolerance)
+    {
+      Track_AddVertex(track, &track->window[track->windowCount - 1]);
+      break;
+    }
+  }
+
+  // Long straight line: keep every second point to test, the window never ends a segment
+  if(track->windowCount == TRACK_WINDOW_SIZE)
+  {
+    for(int i = 0; i < TRACK_WINDOW_SIZE / 2; i++)
+    {
+      track->window[i] = track->window[2 * i + 1];
+    }
+    track->windowCount = TRACK_WINDOW_SIZE / 2;
+  }
+
+  track->window[track->windowCount++] = point;
+}
+
+
+//---------------------------------------------
+/// \fn const s_trackPoint *Track_Current(const s_track *track)
+///
+/// \brief Last location added, end of the track after the last vertex.
+/// \param track Track to read.
+/// \return Location, NULL if the track is empty.
+const s_trackPoint *Track_Current(const s_track *track)
+{
+  if(track->windowCount > 0)
+  {
+    return &track->window[track->windowCount - 1];
+  }
+
+  return (track->count > 0) ? &track->vertices[track->count - 1] : NULL;
+}
+
+
+//---------------------------------------------
+/// \fn const uint8_t *Track_Render(s_track *track)
+///
+/// \brief Bring the view bitmap up to date: draws the vertices added since
+///        the last call, or all of them if the track left the view scale or
+///        was compacted.
+/// \param track Track to draw.
+/// \return XBM bitmap, TRACK_VIEW_WIDTH x TRACK_VIEW_HEIGHT.
+const uint8_t *Track_Render(s_track *track)
+{
+  int x0, y0, x1, y1;
+
+  if((track->count > 0) &&
+     ((track->minLat < track->viewMinLat) || (track->maxLat > track->viewMaxLat) ||
+      (track->minLng < track->viewMinLng) || (track->maxLng > track->viewMaxLng)))
+  {
+    Track_Rescale(track);
+  }
+
+  if(track->rendered == 0)
+  {
+    memset(track->bitmap, 0, TRACK_VIEW_BYTES);
+  }
+
+  for(uint16_t i = (track->rendered > 0) ? track->rendered : 1; i < track->count; i++)
+  {
+    Track_Project(track, &track->vertices[i - 1], &x0, &y0);
+    Track_Project(track, &track->vertices[i], &x1, &y1);
+    Track_DrawLine(track, x0, y0, x1, y1);
+  }
+  track->rendered = track->count;
+
+  return track->bitmap;
+}
+
+
+//---------------------------------------------
+/// \fn void Track_Project(const s_track *track, const s_trackPoint *point, int *x, int *y)
+///
+/// \brief Pixel of a location in the view bitmap, at the view scale.
+/// \param track Track of the view.
+/// \param point Location.
+/// \param x Column, 0 to TRACK_VIEW_WIDTH - 1.
+/// \param y Line, 0 (north) to TRACK_VIEW_HEIGHT - 1.
+/// \return None.
+void Track_Project(const s_track *track, const s_trackPoint *point, int *x, int *y)
+{
+  *x = (int64_t)(point->lng - track->viewMinLng) * (TRACK_VIEW_WIDTH - 1) / max(track->viewMaxLng - track->viewMinLng, (int32_t)1);
+  *y = TRACK_VIEW_HEIGHT - 1 - (int64_t)(point->lat - track->viewMinLat) * (TRACK_VIEW_HEIGHT - 1) / max(track->viewMaxLat - track->viewMinLat, (int32_t)1);
+}
+
+
+// Append a vertex, the window restarts after it
+static void Track_AddVertex(s_track *track, const s_trackPoint *point)
+{
+  if(track->count == TRACK_SIZE)
+  {
+    Track_Compact(track);
+  }
+
+  track->vertices[track->count++] = *point;
+  track->windowCount = 0;
+}
+
+
+// New view scale around the track bounding box, bitmap to draw again
+static void Track_Rescale(s_track *track)
+{
+  int32_t latMargin = max((track->maxLat - track->minLat) / TRACK_VIEW_MARGIN, (int32_t)TRACK_VIEW_MIN_SPAN / 2);
+  int32_t lngMargin = max((track->maxLng - track->minLng) / TRACK_VIEW_MARGIN, (int32_t)TRACK_VIEW_MIN_SPAN / 2);
+
+  track->viewMinLat = track->minLat - latMargin;
+  track->viewMaxLat = track->maxLat + latMargin;
+  track->viewMinLng = track->minLng - lngMargin;
+  track->viewMaxLng = track->maxLng + lngMargin;
+
+  track->rendered = 0;
+  track->rescales++;
+}
+
+
+// Bresenham line in the view bitmap
+static void Track_DrawLine(s_track *track, int x0, int y0, int x1, int y1)
+{
+  int dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+  int dy = -abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+  int err = dx + dy, e2;
+
+  for(;;)
+  {
+    track->bitmap[y0 * ((TRACK_VIEW_WIDTH + 7) / 8) + x0 / 8] |= 1 << (x0 % 8);
+
+    if((x0 == x1) && (y0 == y1))
+    {
+      break;
+    }
+
+    e2 = 2 * err;
+    if(e2 >= dy)
+    {
+      err += dy;
+      x0 += sx;
+    }
+    if(e2 <= dx)
+    {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+
+// Simplify the vertices again, doubling the tolerance until a quarter is freed
+static void Track_Compact(s_track *track)
+{
+  uint16_t anchor, kept;
+
+  do
+  {
+    track->tolerance *= 2;
+    track->compactions++;
+
+    anchor = 0;
+    kept = 1;
+    for(uint16_t i = 2; i < track->count; i++)
+    {
+      for(uint16_t j = anchor + 1; j < i; j++)
+      {
+        if((i - anchor > TRACK_WINDOW_SIZE) ||
+           (Track_Deviation(track, &track->vertices[j], &track->vertices[anchor], &track->vertices[i]) > track->tolerance))
+        {
+          anchor = i - 1;
+          track->vertices[kept++] = track->vertices[anchor];
+          break;
+        }
+      }
+    }
+    track->vertices[kept++] = track->vertices[track->count - 1];
+    track->count = kept;
+  }while(track->count > TRACK_SIZE * 3 / 4);
+
+  track->rendered = 0;
+}
+
+
+// Distance of a point to the segment start - end, in pixels at the current scale
+static float Track_Deviation(const s_track *track, const s_trackPoint *point, const s_trackPoint *start, const s_trackPoint *end)
+{
+  float xScale = (float)TRACK_VIEW_WIDTH / max(track->maxLng - track->minLng, (int32_t)1);
+  float yScale = (float)TRACK_VIEW_HEIGHT / max(track->maxLat - track->minLat, (int32_t)1);
+  float dx = (end->lng - start->lng) * xScale;
+  float dy = (end->lat - start->lat) * yScale;
+  float px = (point->lng - start->lng) * xScale;
+  float py = (point->lat - start->lat) * yScale;
+  float length2 = dx * dx + dy * dy;
+  float t = 0;
+
+  if(length2 > 0)
+  {
+    t = constrain((px * dx + py * dy) / length2, 0.0f, 1.0f);
+  }
+
+  px -= t * dx;
+  py -= t * dy;
+
+  return sqrtf(px * px + py * py);
+}
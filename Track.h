@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Track.h
+ * \brief Simplified display track header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _TRACK_H
+#define _TRACK_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   TRACK_SIZE                512       ///< Most vertices kept
+#define   TRACK_WINDOW_SIZE         32        ///< Most points waiting for a decision
+#define   TRACK_TOLERANCE_PX        0.5f      ///< Largest deviation dropped, in screen pixels
+
+#define   TRACK_VIEW_WIDTH          120       ///< Pixels the track is scaled to (track screen without margins)
+#define   TRACK_VIEW_HEIGHT         56
+#define   TRACK_VIEW_BYTES          ((TRACK_VIEW_WIDTH + 7) / 8 * TRACK_VIEW_HEIGHT)
+#define   TRACK_VIEW_MARGIN         8         ///< A new view scale leaves 1/TRACK_VIEW_MARGIN of the span free on each side
+#define   TRACK_VIEW_MIN_SPAN       20000     ///< Smallest view span, in 1e-7 degrees (~220 m of latitude), no zoom on a standing fix
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  int32_t   lat;                  ///< Latitude, in 1e-7 degrees
+  int32_t   lng;                  ///< Longitude, in 1e-7 degrees
+}s_trackPoint;
+
+
+typedef struct
+{
+  s_trackPoint  vertices[TRACK_SIZE];       ///< Simplified track, oldest first
+  uint16_t      count;
+
+  s_trackPoint  window[TRACK_WINDOW_SIZE];  ///< Points since the last vertex, the last one is the current position
+  uint8_t       windowCount;
+
+  int32_t   minLat, maxLat;       ///< Bounding box of all points added
+  int32_t   minLng, maxLng;
+
+  float     tolerance;            ///< Current tolerance, in pixels; grows when vertices are compacted
+  uint32_t  added;                ///< Points added
+  uint32_t  compactions;          ///< Full track simplified again with a larger tolerance
+
+  // Screen view: vertices drawn once in a bitmap, at a scale kept while the track fits
+  int32_t   viewMinLat, viewMaxLat; ///< Bounding box of the view scale
+  int32_t   viewMinLng, viewMaxLng;
+  uint16_t  rendered;             ///< Vertices drawn in the bitmap, 0 to draw it again
+  uint8_t   bitmap[TRACK_VIEW_BYTES]; ///< XBM, TRACK_VIEW_WIDTH x TRACK_VIEW_HEIGHT
+  uint32_t  rescales;             ///< Bitmap drawn again at a new scale
+}s_track;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void Track_Clear(s_track *track);
+extern void Track_Add(s_track *track, int32_t lat, int32_t lng);
+extern const s_trackPoint *Track_Current(const s_track *track);
+extern const uint8_t *Track_Render(s_track *track);
+extern void Track_Project(const s_track *track, const s_trackPoint *point, int *x, int *y);
+
+#endif
@@ -0,0 +1,461 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file TripFile.cpp
+ * \brief Binary trip file format
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Trip file format (.trk):
+ *  - "TRIP", version (1 byte), reserved (1 byte), local time offset in
+ *    minutes (2 bytes LE, signed), start time (4 bytes LE, UTC, s since
+ *    01/01/1970)
+ *  - per record, difference with the previous record (start time and 0
+ *    before the first one) of time (s), latitude, longitude (1e-7 degrees),
+ *    altitude (m), speed (km/h), rpm (TRIPFILE_RPM_STEP) and satellites.
+ *    A tag byte holds time difference (low nibble) and zigzag satellites
+ *    difference (high nibble), each followed by a zigzag varint when it
+ *    does not fit (nibble at TRIPFILE_TAG_ESCAPE). Other differences are
+ *    zigzag varints.
+ * A record at 1 Hz takes about 8 bytes. A file cut by a power loss reads up
+ * to its last complete record.
+ * Records are converted to CSV or GPX text line by line, for download.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <TimeLib.h>
+
+#include "TripFile.h"
+#include "GPS_Ingest.h"
+#include "Format.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   TRIPFILE_MAGIC            "TRIP"
+#define   TRIPFILE_VERSION          1
+#define   TRIPFILE_RPM_STEP         10        ///< rpm resolution in the file
+#define   TRIPFILE_TAG_ESCAPE       15        ///< Tag nibble value: difference follows as a varint
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+size_t TripFile_EncodeHeader(s_tripFileEncoder *encoder, uint8_t *buff, uint32_t startTime, int32_t timeZone);
+size_t TripFile_EncodeRecord(s_tripFileEncoder *encoder, uint8_t *buff, const s_tripRecord *record);
+
+bool TripFile_Open(s_tripFileReader *reader, fs::FS &fs, const char *path);
+bool TripFile_Next(s_tripFileReader *reader, s_tripRecord *record);
+void TripFile_Close(s_tripFileReader *reader);
+
+const char *TripFile_FormatExt(e_tripFileFormat format);
+const char *TripFile_FormatMimeType(e_tripFileFormat format);
+size_t TripFile_FormatHeader(char *buff, e_tripFileFormat format, const s_tripFileReader *reader);
+size_t TripFile_FormatRecord(char *buff, e_tripFileFormat format, const s_tripFileReader *reader, const s_tripRecord *record);
+size_t TripFile_FormatFooter(char *buff, e_tripFileFormat format);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static uint32_t TripFile_Zigzag(int32_t value);
+static uint8_t *TripFile_WriteVarint(uint8_t *buff, int32_t value);
+static int TripFile_ReadByte(s_tripFileReader *reader);
+static bool TripFile_ReadVarint(s_tripFileReader *reader, int32_t *value);
+static char *TripFile_FormatCoord(char *buff, int32_t coord);
+static char *TripFile_FormatTime(char *buff, uint32_t time, char separator);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn size_t TripFile_EncodeHeader(s_tripFileEncoder *encoder, uint8_t *buff, uint32_t startTime, int32_t timeZone)
+///
+/// \brief Start a trip file.
+/// \param encoder Writer state, initialized.
+/// \param buff Destination, TRIPFILE_HEADER_SIZE bytes.
+/// \param startTime UTC time of the trip start, in s since 01/01/1970.
+/// \param timeZone Local time offset, in s.
+/// \return Nb of bytes written to buff.
+size_t TripFile_EncodeHeader(s_tripFileEncoder *encoder, uint8_t *buff, uint32_t startTime, int32_t timeZone)
+{
+  int16_t timeZoneMin = timeZone / 60;
+
+  memcpy(buff, TRIPFILE_MAGIC, 4);
+  buff[4] = TRIPFILE_VERSION;
+  buff[5] = 0;
+  buff[6] = timeZoneMin & 0xFF;
+  buff[7] = (timeZoneMin >> 8) & 0xFF;
+  buff[8] = startTime & 0xFF;
+  buff[9] = (startTime >> 8) & 0xFF;
+  buff[10] = (startTime >> 16) & 0xFF;
+  buff[11] = (startTime >> 24) & 0xFF;
+
+  memset(&encoder->last, 0, sizeof(s_tripRecord));
+  encoder->last.time = startTime;
+
+  return TRIPFILE_HEADER_SIZE;
+}
+
+
+//---------------------------------------------
+/// \fn size_t TripFile_EncodeRecord(s_tripFileEncoder *encoder, uint8_t *buff, const s_tripRecord *record)
+///
+/// \brief Encode a record as differences with the previous one.
+/// \param encoder Writer state.
+/// \param buff Destination, TRIPFILE_RECORD_MAX_SIZE bytes.
+/// \param record Record to encode.
+/// \return Nb of bytes written to buff.
+size_t TripFile_EncodeRecord(s_tripFileEncoder *encoder, uint8_t *buff, const s_tripRecord *record)
+{
+  s_tripRecord *last = &encoder->last;
+  uint8_t *ptr = buff;
+  int32_t dTime = record->time - last->time;
+  int32_t dSats = (int32_t)record->satellites - last->satellites;
+  uint32_t timeNibble = ((dTime >= 0) && (dTime < TRIPFILE_TAG_ESCAPE)) ? dTime : TRIPFILE_TAG_ESCAPE;
+  uint32_t satsNibble = min(TripFile_Zigzag(dSats), (uint32_t)TRIPFILE_TAG_ESCAPE);
+
+  *ptr++ = timeNibble | (satsNibble << 4);
+  if(timeNibble == TRIPFILE_TAG_ESCAPE)
+  {
+    ptr = TripFile_WriteVarint(ptr, dTime);
+  }
+  if(satsNibble == TRIPFILE_TAG_ESCAPE)
+  {
+    ptr = TripFile_WriteVarint(ptr, dSats);
+  }
+
+  ptr = TripFile_WriteVarint(ptr, record->lat - last->lat);
+  ptr = TripFile_WriteVarint(ptr, record->lng - last->lng);
+  ptr = TripFile_WriteVarint(ptr, record->alt - last->alt);
+  ptr = TripFile_WriteVarint(ptr, (int32_t)record->speed - last->speed);
+  ptr = TripFile_WriteVarint(ptr, (int32_t)(record->rpm / TRIPFILE_RPM_STEP) - last->rpm / TRIPFILE_RPM_STEP);
+
+  *last = *record;
+
+  return ptr - buff;
+}
+
+
+//---------------------------------------------
+/// \fn bool TripFile_Open(s_tripFileReader *reader, fs::FS &fs, const char *path)
+///
+/// \brief Open a trip file and read its header.
+/// \param reader Reader to initialize.
+/// \param fs File system holding the trip.
+/// \param path Trip file.
+/// \return false if the file can't be opened or is not a trip file.
+bool TripFile_Open(s_tripFileReader *reader, fs::FS &fs, const char *path)
+{
+  uint8_t header[TRIPFILE_HEADER_SIZE];
+
+  reader->buffLength = 0;
+  reader->buffPos = 0;
+  memset(&reader->record, 0, sizeof(s_tripRecord));
+
+  reader->file = fs.open(path, FILE_READ);
+  if(!reader->file)
+  {
+    return false;
+  }
+
+  for(int i = 0; i < TRIPFILE_HEADER_SIZE; i++)
+  {
+    int c = TripFile_ReadByte(reader);
+    if(c < 0)
+    {
+      TripFile_Close(reader);
+      return false;
+    }
+    header[i] = c;
+  }
+
+  if((memcmp(header, TRIPFILE_MAGIC, 4) != 0) || (header[4] != TRIPFILE_VERSION))
+  {
+    TripFile_Close(reader);
+    return false;
+  }
+
+  reader->timeZone = (int16_t)(header[6] | (header[7] << 8)) * 60;
+  reader->startTime = header[8] | (header[9] << 8) | (header[10] << 16) | ((uint32_t)header[11] << 24);
+  reader->record.time = reader->startTime;
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn bool TripFile_Next(s_tripFileReader *reader, s_tripRecord *record)
+///
+/// \brief Read the next record of the trip.
+/// \param reader Opened reader.
+/// \param record Destination of the record.
+/// \return false at end of file, or if the last record is truncated.
+bool TripFile_Next(s_tripFileReader *reader, s_tripRecord *record)
+{
+  int32_t dTime, dSats;
+  int32_t delta[5];
+  int tag;
+
+  tag = TripFile_ReadByte(reader);
+  if(tag < 0)
+  {
+    return false;
+  }
+
+  dTime = tag & 0x0F;
+  if((dTime == TRIPFILE_TAG_ESCAPE) && !TripFile_ReadVarint(reader, &dTime))
+  {
+    return false;
+  }
+
+  dSats = tag >> 4;
+  if(dSats == TRIPFILE_TAG_ESCAPE)
+  {
+    if(!TripFile_ReadVarint(reader, &dSats))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    dSats = (dSats >> 1) ^ -(dSats & 1);
+  }
+
+  for(int i = 0; i < 5; i++)
+  {
+    if(!TripFile_ReadVarint(reader, &delta[i]))
+    {
+      return false;
+    }
+  }
+
+  reader->record.time += dTime;
+  reader->record.lat += delta[0];
+  reader->record.lng += delta[1];
+  reader->record.alt += delta[2];
+  reader->record.speed += delta[3];
+  reader->record.rpm += delta[4] * TRIPFILE_RPM_STEP;
+  reader->record.satellites += dSats;
+
+  *record = reader->record;
+
+  return true;
+}
+
+
+void TripFile_Close(s_tripFileReader *reader)
+{
+  reader->file.close();
+}
+
+
+const char *TripFile_FormatExt(e_tripFileFormat format)
+{
+  return (format == TRIPFILE_FORMAT_GPX) ? ".gpx" : ".csv";
+}
+
+
+const char *TripFile_FormatMimeType(e_tripFileFormat format)
+{
+  return (format == TRIPFILE_FORMAT_GPX) ? "application/gpx+xml" : "text/csv";
+}
+
+
+//---------------------------------------------
+/// \fn size_t TripFile_FormatHeader(char *buff, e_tripFileFormat format, const s_tripFileReader *reader)
+///
+/// \brief Text preceding the records.
+/// \param buff Destination, TRIPFILE_LINE_SIZE bytes.
+/// \param format CSV or GPX.
+/// \param reader Opened reader.
+/// \return Nb of characters written to buff.
+size_t TripFile_FormatHeader(char *buff, e_tripFileFormat format, const s_tripFileReader *reader)
+{
+  char *ptr;
+
+  if(format == TRIPFILE_FORMAT_GPX)
+  {
+    ptr = Format_Str(buff, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                           "<gpx version=\"1.1\" creator=\"ATV Dashboard\" xmlns=\"http://www.topografix.com/GPX/1/1\">\n"
+                           "<trk><name>");
+    ptr = TripFile_FormatTime(ptr, reader->startTime + reader->timeZone, ' ');
+    ptr = Format_Str(ptr, "</name><trkseg>\n");
+  }
+  else
+  {
+    ptr = Format_Str(buff, "sep=,\nTime, Latitude, Longitude, Altitude, Speed, Rpm, Satellites\n");
+  }
+
+  return ptr - buff;
+}
+
+
+//---------------------------------------------
+/// \fn size_t TripFile_FormatRecord(char *buff, e_tripFileFormat format, const s_tripFileReader *reader, const s_tripRecord *record)
+///
+/// \brief Text of a record: a CSV line in local time, or a GPX track point.
+/// \param buff Destination, TRIPFILE_LINE_SIZE bytes.
+/// \param format CSV or GPX.
+/// \param reader Reader the record comes from.
+/// \param record Record to format.
+/// \return Nb of characters written to buff.
+size_t TripFile_FormatRecord(char *buff, e_tripFileFormat format, const s_tripFileReader *reader, const s_tripRecord *record)
+{
+  char *ptr;
+
+  if(format == TRIPFILE_FORMAT_GPX)
+  {
+    ptr = Format_Str(buff, "<trkpt lat=\"");
+    ptr = TripFile_FormatCoord(ptr, record->lat);
+    ptr = Format_Str(ptr, "\" lon=\"");
+    ptr = TripFile_FormatCoord(ptr, record->lng);
+    ptr = Format_Str(ptr, "\"><ele>");
+    ptr = Format_Int(ptr, record->alt);
+    ptr = Format_Str(ptr, "</ele><time>");
+    ptr = TripFile_FormatTime(ptr, record->time, 'T');
+    ptr = Format_Str(ptr, "Z</time><sat>");
+    ptr = Format_Int(ptr, record->satellites);
+    ptr = Format_Str(ptr, "</sat></trkpt>\n");
+  }
+  else
+  {
+    ptr = TripFile_FormatTime(buff, record->time + reader->timeZone, ' ');
+    ptr = Format_Str(ptr, ", ");
+    ptr = TripFile_FormatCoord(ptr, record->lat);
+    ptr = Format_Str(ptr, ", ");
+    ptr = TripFile_FormatCoord(ptr, record->lng);
+    ptr = Format_Str(ptr, ", ");
+    ptr = Format_Int(ptr, record->alt);
+    ptr = Format_Str(ptr, ", ");
+    ptr = Format_Int(ptr, record->speed);
+    ptr = Format_Str(ptr, ", ");
+    ptr = Format_Int(ptr, record->rpm);
+    ptr = Format_Str(ptr, ", ");
+    ptr = Format_Int(ptr, record->satellites);
+    ptr = Format_Str(ptr, "\n");
+  }
+
+  return ptr - buff;
+}
+
+
+size_t TripFile_FormatFooter(char *buff, e_tripFileFormat format)
+{
+  if(format == TRIPFILE_FORMAT_GPX)
+  {
+    return Format_Str(buff, "</trkseg></trk>\n</gpx>\n") - buff;
+  }
+
+  buff[0] = '\0';
+  return 0;
+}
+
+
+static uint32_t TripFile_Zigzag(int32_t value)
+{
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+
+static uint8_t *TripFile_WriteVarint(uint8_t *buff, int32_t value)
+{
+  uint32_t zigzag = TripFile_Zigzag(value);
+
+  while(zigzag >= 0x80)
+  {
+    *buff++ = (zigzag & 0x7F) | 0x80;
+    zigzag >>= 7;
+  }
+  *buff++ = zigzag;
+
+  return buff;
+}
+
+
+static int TripFile_ReadByte(s_tripFileReader *reader)
+{
+  size_t len;
+
+  if(reader->buffPos >= reader->buffLength)
+  {
+    len = reader->file.read(reader->buff, TRIPFILE_READ_BUFFER_SIZE);
+    if(len == 0)
+    {
+      return -1;
+    }
+    reader->buffLength = len;
+    reader->buffPos = 0;
+  }
+
+  return reader->buff[reader->buffPos++];
+}
+
+
+static bool TripFile_ReadVarint(s_tripFileReader *reader, int32_t *value)
+{
+  uint32_t zigzag = 0;
+  int shift = 0;
+  int c;
+
+  do
+  {
+    c = TripFile_ReadByte(reader);
+    if((c < 0) || (shift > 28))
+    {
+      return false;
+    }
+    zigzag |= (uint32_t)(c & 0x7F) << shift;
+    shift += 7;
+  }while(c & 0x80);
+
+  *value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+
+  return true;
+}
+
+
+// Writes a coordinate in 1e-7 degrees as a decimal number of degrees, returns the end of the text
+static char *TripFile_FormatCoord(char *buff, int32_t coord)
+{
+  return Format_Fixed(buff, coord, 7);    // GPS_COORD_SCALE
+}
+
+
+// Writes a time as YYYY-MM-DD<separator>hh:mm:ss, returns the end of the text
+static char *TripFile_FormatTime(char *buff, uint32_t time, char separator)
+{
+  tmElements_t tm;
+
+  breakTime(time, tm);
+  buff = Format_UintPad(buff, tmYearToCalendar(tm.Year), 4, '0');
+  *buff++ = '-';
+  buff = Format_Uint2(buff, tm.Month);
+  *buff++ = '-';
+  buff = Format_Uint2(buff, tm.Day);
+  *buff++ = separator;
+  buff = Format_Uint2(buff, tm.Hour);
+  *buff++ = ':';
+  buff = Format_Uint2(buff, tm.Minute);
+  *buff++ = ':';
+  return Format_Uint2(buff, tm.Second);
+}
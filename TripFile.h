@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file TripFile.h
+ * \brief Binary trip file format header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _TRIPFILE_H
+#define _TRIPFILE_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include "FS.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   TRIPFILE_EXT              ".trk"
+#define   TRIPFILE_HEADER_SIZE      12
+#define   TRIPFILE_RECORD_MAX_SIZE  36        ///< Tag and 7 varints of 5 bytes at most
+#define   TRIPFILE_LINE_SIZE        256       ///< Buffer size for TripFile_Format...() functions
+#define   TRIPFILE_READ_BUFFER_SIZE 64
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  TRIPFILE_FORMAT_CSV = 0,
+  TRIPFILE_FORMAT_GPX
+}e_tripFileFormat;
+
+
+typedef struct
+{
+  uint32_t  time;                 ///< UTC, in s since 01/01/1970
+  int32_t   lat;                  ///< Latitude, in 1e-7 degrees
+  int32_t   lng;                  ///< Longitude, in 1e-7 degrees
+  int32_t   alt;                  ///< Altitude, in meters
+  uint16_t  speed;                ///< Speed, in km/h
+  uint16_t  rpm;                  ///< Engine speed, stored by TRIPFILE_RPM_STEP
+  uint8_t   satellites;
+}s_tripRecord;
+
+
+/// Writer state: records are stored as differences with the previous one
+typedef struct
+{
+  s_tripRecord last;
+}s_tripFileEncoder;
+
+
+/// Trip file reader, streaming records out of the file
+typedef struct
+{
+  fs::File  file;
+  uint8_t   buff[TRIPFILE_READ_BUFFER_SIZE];
+  uint8_t   buffLength;
+  uint8_t   buffPos;
+
+  uint32_t  startTime;            ///< UTC time of the trip start, in s since 01/01/1970
+  int32_t   timeZone;             ///< Local time offset, in s
+  s_tripRecord record;            ///< Last record read, deltas are applied to it
+}s_tripFileReader;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern size_t TripFile_EncodeHeader(s_tripFileEncoder *encoder, uint8_t *buff, uint32_t startTime, int32_t timeZone);
+extern size_t TripFile_EncodeRecord(s_tripFileEncoder *encoder, uint8_t *buff, const s_tripRecord *record);
+
+extern bool TripFile_Open(s_tripFileReader *reader, fs::FS &fs, const char *path);
+extern bool TripFile_Next(s_tripFileReader *reader, s_tripRecord *record);
+extern void TripFile_Close(s_tripFileReader *reader);
+
+extern const char *TripFile_FormatExt(e_tripFileFormat format);
+extern const char *TripFile_FormatMimeType(e_tripFileFormat format);
+extern size_t TripFile_FormatHeader(char *buff, e_tripFileFormat format, const s_tripFileReader *reader);
+extern size_t TripFile_FormatRecord(char *buff, e_tripFileFormat format, const s_tripFileReader *reader, const s_tripRecord *record);
+extern size_t TripFile_FormatFooter(char *buff, e_tripFileFormat format);
+
+#endif
@@ -0,0 +1,328 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file TripLog.cpp
+ * \brief Buffered trip log
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * The trip file stays open while recording, records are gathered in RAM.
+ * The buffer is written when it holds TRIPLOG_FLUSH_SIZE bytes, up to a
+ * write block boundary of the file only (SPIFFS page, SD sector, see
+ * File_Info()), so the file system never rewrites a partly filled block. Everything is written, and the file flushed, when records
+ * are older than TRIPLOG_FLUSH_MS, on TripLog_Flush() and on TripLog_Close().
+ * Nothing is locked: only the storage task may call these functions. It
+ * also closes the file on software restart (firmware update), see
+ * Storage.cpp.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "TripLog.h"
+#include "TripFile.h"
+#include "File.h"
+#include "Settings.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   TRIPLOG_BENCH_FILE        "/bench_triplog" TRIPFILE_EXT
+#define   TRIPLOG_BENCH_RECORDS     1000
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+s_tripLogStats tripLogStats;
+
+static File logFile;
+static char logPath[FILE_NAME_SIZE];        ///< For the file size index
+static bool logOpen = false;
+static uint32_t fileOffset;                 ///< Bytes written to the file
+static unsigned long lastFlushMillis;
+
+static char buffer[TRIPLOG_BUFFER_SIZE];
+static size_t bufferLength;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+bool TripLog_Open(fs::FS &fs, const char *path);
+bool TripLog_IsOpen();
+bool TripLog_Write(const void *data, size_t len);
+void TripLog_Flush();
+void TripLog_Close();
+void TripLog_Benchmark();
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static void TripLog_WriteBuffer(bool all);
+#ifdef BENCH_TRIPLOG
+static void TripLog_BenchPoint(s_tripRecord *point, int index);
+#endif
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+//---------------------------------------------
+/// \fn bool TripLog_Open(fs::FS &fs, const char *path)
+///
+/// \brief Create the trip file and keep it open. A trip already open is
+///        closed first.
+/// \param fs File system to write to.
+/// \param path Trip file, overwritten if it exists.
+/// \return false if the file can't be created.
+bool TripLog_Open(fs::FS &fs, const char *path)
+{
+  TripLog_Close();
+
+  memset(&tripLogStats, 0, sizeof(tripLogStats));
+  fileOffset = 0;
+  bufferLength = 0;
+  lastFlushMillis = millis();
+
+  logFile = fs.open(path, FILE_WRITE);
+  if(!logFile)
+  {
+    tripLogStats.errors++;
+    return false;
+  }
+  logOpen = true;
+  snprintf(logPath, FILE_NAME_SIZE, "%s", path);
+  File_IndexUpdate(logPath, 0);
+
+  return true;
+}
+
+
+bool TripLog_IsOpen()
+{
+  return logOpen;
+}
+
+
+//---------------------------------------------
+/// \fn bool TripLog_Write(const void *data, size_t len)
+///
+/// \brief Add a record to the trip file. Only copied to RAM, unless a flush
+///        threshold is reached.
+/// \param data Record to append.
+/// \param len Nb of bytes.
+/// \return false if no trip is open or the record is too long.
+bool TripLog_Write(const void *data, size_t len)
+{
+  uint32_t startUs = micros();
+  uint32_t stallUs;
+
+  if(!logOpen)
+  {
+    return false;
+  }
+
+  if(len > TRIPLOG_BUFFER_SIZE - bufferLength)
+  {
+    TripLog_WriteBuffer(true);
+
+    if(len > TRIPLOG_BUFFER_SIZE)
+    {
+      tripLogStats.errors++;
+      return false;
+    }
+  }
+
+  memcpy(&buffer[bufferLength], data, len);
+  bufferLength += len;
+  tripLogStats.records++;
+
+  if(millis() - lastFlushMillis >= TRIPLOG_FLUSH_MS)
+  {
+    TripLog_WriteBuffer(true);
+  }
+  else if(bufferLength >= TRIPLOG_FLUSH_SIZE)
+  {
+    TripLog_WriteBuffer(false);
+  }
+
+  stallUs = micros() - startUs;
+  if(stallUs > tripLogStats.maxStallUs)
+  {
+    tripLogStats.maxStallUs = stallUs;
+  }
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn void TripLog_Flush(void)
+///
+/// \brief Write all buffered records, so the file can be read as is.
+/// \param None.
+/// \return None.
+void TripLog_Flush()
+{
+  if(logOpen)
+  {
+    TripLog_WriteBuffer(true);
+  }
+}
+
+
+//---------------------------------------------
+/// \fn void TripLog_Close(void)
+///
+/// \brief Write all buffered records and close the trip file. To be called
+///        at trip end, and when power is about to be lost.
+/// \param None.
+/// \return None.
+void TripLog_Close()
+{
+  if(!logOpen)
+  {
+    return;
+  }
+
+  TripLog_WriteBuffer(true);
+  logFile.close();
+  logOpen = false;
+}
+
+
+//---------------------------------------------
+/// \fn void TripLog_Benchmark(void)
+///
+/// \brief Write TRIPLOG_BENCH_RECORDS records through the trip log, then
+///        with one open / append / close per record as File_Append() does,
+///        and print throughput and longest stall of both. Records are trip
+///        file records of a straight ride at 1 Hz.
+///        Built with BENCH_TRIPLOG only.
+/// \param None.
+/// \return None.
+void TripLog_Benchmark()
+{
+#ifdef BENCH_TRIPLOG
+  uint8_t header[TRIPFILE_HEADER_SIZE];
+  uint8_t record[TRIPFILE_RECORD_MAX_SIZE];
+  s_tripFileEncoder encoder;
+  s_tripRecord point;
+  size_t len;
+  uint32_t startUs, callUs, totalUs, maxUs;
+  File file;
+
+  Serial.printf("Trip log benchmark, %d records\r\n", TRIPLOG_BENCH_RECORDS);
+
+  // Buffered
+  TripLog_Open(fileSystem, TRIPLOG_BENCH_FILE);
+  startUs = micros();
+  TripLog_Write(header, TripFile_EncodeHeader(&encoder, header, 0, 0));
+  for(int i = 0; i < TRIPLOG_BENCH_RECORDS; i++)
+  {
+    TripLog_BenchPoint(&point, i);
+    TripLog_Write(record, TripFile_EncodeRecord(&encoder, record, &point));
+  }
+  callUs = micros();
+  TripLog_Close();
+  totalUs = micros() - startUs;
+  callUs = micros() - callUs;
+
+  Serial.printf("- trip log: %u records/s, longest write %u us, close %u us, %u flushes, %u errors\r\n",
+                (uint32_t)(TRIPLOG_BENCH_RECORDS * 1000000ULL / max(totalUs, (uint32_t)1)),
+                tripLogStats.maxStallUs, callUs, tripLogStats.flushes, tripLogStats.errors);
+  File_Delete(fileSystem, TRIPLOG_BENCH_FILE);
+
+  // Open / append / close, without File_Append() debug prints
+  maxUs = 0;
+  startUs = micros();
+  TripFile_EncodeHeader(&encoder, header, 0, 0);
+  for(int i = 0; i < TRIPLOG_BENCH_RECORDS; i++)
+  {
+    TripLog_BenchPoint(&point, i);
+    len = TripFile_EncodeRecord(&encoder, record, &point);
+
+    callUs = micros();
+    file = fileSystem.open(TRIPLOG_BENCH_FILE, FILE_APPEND);
+    file.write(record, len);
+    file.close();
+    callUs = micros() - callUs;
+
+    if(callUs > maxUs)
+    {
+      maxUs = callUs;
+    }
+  }
+  totalUs = micros() - startUs;
+
+  Serial.printf("- append: %u records/s, longest write %u us\r\n",
+                (uint32_t)(TRIPLOG_BENCH_RECORDS * 1000000ULL / max(totalUs, (uint32_t)1)), maxUs);
+  File_Delete(fileSystem, TRIPLOG_BENCH_FILE);
+#endif
+}
+
+
+// Write the buffer, all of it or up to the last page boundary of the file
+static void TripLog_WriteBuffer(bool all)
+{
+  size_t len = bufferLength;
+  size_t written;
+  uint32_t pageEnd;
+
+  if(!all)
+  {
+    pageEnd = (fileOffset + bufferLength) & ~(uint32_t)(File_Info(fileBackend)->writeBlock - 1);
+    len = (pageEnd > fileOffset) ? pageEnd - fileOffset : 0;
+  }
+
+  if(len > 0)
+  {
+    written = logFile.write((const uint8_t *)buffer, len);
+    if(written != len)
+    {
+      tripLogStats.errors++;
+    }
+
+    // Records not written are lost, the buffer must not fill up
+    fileOffset += written;
+    tripLogStats.bytes += written;
+    tripLogStats.flushes++;
+    File_IndexUpdate(logPath, fileOffset);
+
+    bufferLength -= len;
+    memmove(buffer, &buffer[len], bufferLength);
+  }
+
+  if(all)
+  {
+    logFile.flush();
+    lastFlushMillis = millis();
+  }
+}
+
+
+#ifdef BENCH_TRIPLOG
+static void TripLog_BenchPoint(s_tripRecord *point, int index)
+{
+  point->time = index;
+  point->lat = 451234567 + index * 1250;
+  point->lng = 51234567 - index * 870;
+  point->alt = 250 + (index / 10) % 50;
+  point->speed = 45 + index % 7;
+  point->rpm = 4000 + (index % 20) * 50;
+  point->satellites = 9;
+}
+#endif
@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file TripLog.h
+ * \brief Buffered trip log header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _TRIPLOG_H
+#define _TRIPLOG_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include "FS.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   TRIPLOG_BUFFER_SIZE       2048      ///< RAM buffer holding records not written yet
+#define   TRIPLOG_FLUSH_SIZE        1024      ///< Buffered bytes triggering a write, at least a backend write block
+#define   TRIPLOG_FLUSH_MS          10000     ///< Longest time records stay in RAM only
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  uint32_t  records;              ///< Records written to the buffer
+  uint32_t  bytes;                ///< Bytes written to the file
+  uint32_t  flushes;              ///< Buffer writes to the file
+  uint32_t  errors;               ///< Records or writes lost
+  uint32_t  maxStallUs;           ///< Longest TripLog_Write() call, in us
+}s_tripLogStats;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+extern s_tripLogStats tripLogStats;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern bool TripLog_Open(fs::FS &fs, const char *path);
+extern bool TripLog_IsOpen();
+extern bool TripLog_Write(const void *data, size_t len);
+extern void TripLog_Flush();
+extern void TripLog_Close();
+extern void TripLog_Benchmark();
+
+#endif
@@ -0,0 +1,325 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file UBX.cpp
+ * \brief u-blox UBX binary protocol
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Frame: 0xB5 0x62 class id length(2, little endian) payload checksum(2).
+ * The checksum is a 8 bits Fletcher computed from class to end of payload.
+ * When a frame is rejected (bad checksum or length), decoding resumes from
+ * the byte following its first sync char, so a frame starting inside the
+ * rejected bytes is not lost.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "UBX.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   UBX_U2(p, i)    ((uint16_t)((p)[i] | ((p)[(i)+1] << 8)))
+#define   UBX_I4(p, i)    ((int32_t)((uint32_t)(p)[i] | ((uint32_t)(p)[(i)+1] << 8) | ((uint32_t)(p)[(i)+2] << 16) | ((uint32_t)(p)[(i)+3] << 24)))
+
+// NAV-PVT payload fields
+#define   PVT_YEAR        4
+#define   PVT_MONTH       6
+#define   PVT_DAY         7
+#define   PVT_HOUR        8
+#define   PVT_MIN         9
+#define   PVT_SEC         10
+#define   PVT_VALID       11
+#define   PVT_FIX_TYPE    20
+#define   PVT_FLAGS       21
+#define   PVT_NUM_SV      23
+#define   PVT_LON         24
+#define   PVT_LAT         28
+#define   PVT_HMSL        36
+#define   PVT_GSPEED      60
+
+#define   PVT_VALID_DATE        0x01
+#define   PVT_VALID_TIME        0x02
+#define   PVT_FLAGS_FIX_OK      0x01
+
+#define   PVT_FIX_TYPE_2D       2
+#define   PVT_FIX_TYPE_3D       3
+#define   PVT_FIX_TYPE_GNSS_DR  4
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+void UBX_Init(s_ubxParser *parser, ubxFrameHandler onFrame);
+void UBX_Decode(s_ubxParser *parser, uint8_t c);
+bool UBX_ParseNavPvt(const uint8_t *payload, uint16_t length, s_gpsFix *fix);
+void UBX_Send(Print &port, uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+
+
+//---------------------------------------------
+// Private Functions
+//---------------------------------------------
+static bool UBX_Step(s_ubxParser *parser, uint8_t c);
+static void UBX_Checksum(uint8_t *checksumA, uint8_t *checksumB, const uint8_t *data, uint16_t length);
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+void UBX_Init(s_ubxParser *parser, ubxFrameHandler onFrame)
+{
+  memset(parser, 0, sizeof(s_ubxParser));
+  parser->state = UBX_STATE_SYNC_1;
+  parser->onFrame = onFrame;
+}
+
+
+//---------------------------------------------
+/// \fn void UBX_Decode(s_ubxParser *parser, uint8_t c)
+///
+/// \brief Feed one byte to the decoder. parser->onFrame is called for each
+///        valid frame.
+/// \param parser Decoder state.
+/// \param c Received byte.
+/// \return None.
+void UBX_Decode(s_ubxParser *parser, uint8_t c)
+{
+  uint8_t pending[UBX_MAX_FRAME];
+  uint16_t pendingLength;
+  uint16_t i = 0;
+
+  if(UBX_Step(parser, c))
+  {
+    return;
+  }
+
+  // Frame rejected: replay its bytes, skipping the first sync char
+  pendingLength = parser->rawLength - 1;
+  memcpy(pending, &parser->raw[1], pendingLength);
+  parser->state = UBX_STATE_SYNC_1;
+  parser->rawLength = 0;
+
+  while(i < pendingLength)
+  {
+    if(!UBX_Step(parser, pending[i++]))
+    {
+      // Rejected frame is the tail of pending[] ending at i; resume after its first byte
+      i = i - parser->rawLength + 1;
+      parser->state = UBX_STATE_SYNC_1;
+      parser->rawLength = 0;
+    }
+  }
+}
+
+
+// Returns false when the current frame is rejected. Its bytes are then in raw[].
+static bool UBX_Step(s_ubxParser *parser, uint8_t c)
+{
+  switch(parser->state)
+  {
+    case UBX_STATE_SYNC_1:
+      if(c == UBX_SYNC_CHAR_1)
+      {
+        parser->raw[0] = c;
+        parser->rawLength = 1;
+        parser->state = UBX_STATE_SYNC_2;
+      }
+      return true;
+
+    case UBX_STATE_SYNC_2:
+      if(c == UBX_SYNC_CHAR_2)
+      {
+        parser->raw[1] = c;
+        parser->rawLength = 2;
+        parser->checksumA = 0;
+        parser->checksumB = 0;
+        parser->state = UBX_STATE_CLASS;
+      }
+      else if(c != UBX_SYNC_CHAR_1)
+      {
+        parser->state = UBX_STATE_SYNC_1;
+      }
+      return true;
+
+    default:
+      break;
+  }
+
+  parser->raw[parser->rawLength++] = c;
+
+  switch(parser->state)
+  {
+    case UBX_STATE_CLASS:
+      parser->state = UBX_STATE_ID;
+      break;
+
+    case UBX_STATE_ID:
+      parser->state = UBX_STATE_LENGTH_1;
+      break;
+
+    case UBX_STATE_LENGTH_1:
+      parser->length = c;
+      parser->state = UBX_STATE_LENGTH_2;
+      break;
+
+    case UBX_STATE_LENGTH_2:
+      parser->length |= (uint16_t)c << 8;
+
+      if(parser->length > UBX_MAX_PAYLOAD)
+      {
+        parser->lengthErrors++;
+        return false;
+      }
+      parser->state = (parser->length > 0) ? UBX_STATE_PAYLOAD : UBX_STATE_CHECKSUM_A;
+      break;
+
+    case UBX_STATE_PAYLOAD:
+      if(parser->rawLength == (UBX_HEADER_SIZE + parser->length))
+      {
+        parser->state = UBX_STATE_CHECKSUM_A;
+      }
+      break;
+
+    case UBX_STATE_CHECKSUM_A:
+      // Checksum computed once on the whole frame, cheaper than byte per byte in the switch
+      UBX_Checksum(&parser->checksumA, &parser->checksumB, &parser->raw[2], UBX_HEADER_SIZE - 2 + parser->length);
+
+      if(c != parser->checksumA)
+      {
+        parser->checksumErrors++;
+        return false;
+      }
+      parser->state = UBX_STATE_CHECKSUM_B;
+      break;
+
+    case UBX_STATE_CHECKSUM_B:
+      if(c != parser->checksumB)
+      {
+        parser->checksumErrors++;
+        return false;
+      }
+
+      parser->frames++;
+      parser->state = UBX_STATE_SYNC_1;
+
+      if(parser->onFrame != NULL)
+      {
+        parser->onFrame(parser->raw[2], parser->raw[3], &parser->raw[UBX_HEADER_SIZE], parser->length);
+      }
+      break;
+
+    default:
+      parser->state = UBX_STATE_SYNC_1;
+      break;
+  }
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn bool UBX_ParseNavPvt(const uint8_t *payload, uint16_t length, s_gpsFix *fix)
+///
+/// \brief Decode a NAV-PVT payload into the fix. Position, altitude and
+///        speed are kept as integers, as sent by the receiver.
+/// \param payload NAV-PVT payload.
+/// \param length Payload length.
+/// \param fix Fix to update.
+/// \return true if payload was decoded.
+bool UBX_ParseNavPvt(const uint8_t *payload, uint16_t length, s_gpsFix *fix)
+{
+  uint8_t fixType;
+  bool fixOk;
+
+  if(length < UBX_NAV_PVT_MIN_LENGTH)
+  {
+    return false;
+  }
+
+  fixType = payload[PVT_FIX_TYPE];
+  fixOk = (payload[PVT_FLAGS] & PVT_FLAGS_FIX_OK) != 0;
+
+  fix->locationValid = fixOk && ((fixType == PVT_FIX_TYPE_2D) || (fixType == PVT_FIX_TYPE_3D) || (fixType == PVT_FIX_TYPE_GNSS_DR));
+  fix->altitudeValid = fixOk && ((fixType == PVT_FIX_TYPE_3D) || (fixType == PVT_FIX_TYPE_GNSS_DR));
+  fix->speedValid = fix->locationValid;
+  fix->satellitesValid = true;
+
+  if(fix->locationValid)
+  {
+    fix->lng = UBX_I4(payload, PVT_LON);
+    fix->lat = UBX_I4(payload, PVT_LAT);
+    fix->speed = UBX_I4(payload, PVT_GSPEED);
+    fix->locationCount++;
+  }
+
+  if(fix->altitudeValid)
+  {
+    fix->altitude = UBX_I4(payload, PVT_HMSL);
+  }
+
+  fix->satellites = payload[PVT_NUM_SV];
+
+  fix->dateValid = (payload[PVT_VALID] & PVT_VALID_DATE) != 0;
+  fix->timeValid = (payload[PVT_VALID] & PVT_VALID_TIME) != 0;
+  fix->year = UBX_U2(payload, PVT_YEAR);
+  fix->month = payload[PVT_MONTH];
+  fix->day = payload[PVT_DAY];
+  fix->hour = payload[PVT_HOUR];
+  fix->minute = payload[PVT_MIN];
+  fix->second = payload[PVT_SEC];
+
+  return true;
+}
+
+
+//---------------------------------------------
+/// \fn void UBX_Send(Print &port, uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length)
+///
+/// \brief Build a frame around the payload and write it to the port.
+/// \return None.
+void UBX_Send(Print &port, uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length)
+{
+  uint8_t header[UBX_HEADER_SIZE] = {UBX_SYNC_CHAR_1, UBX_SYNC_CHAR_2, msgClass, msgId, (uint8_t)(length & 0xFF), (uint8_t)(length >> 8)};
+  uint8_t checksum[UBX_CHECKSUM_SIZE] = {0, 0};
+
+  UBX_Checksum(&checksum[0], &checksum[1], &header[2], UBX_HEADER_SIZE - 2);
+  UBX_Checksum(&checksum[0], &checksum[1], payload, length);
+
+  port.write(header, UBX_HEADER_SIZE);
+  port.write(payload, length);
+  port.write(checksum, UBX_CHECKSUM_SIZE);
+}
+
+
+static void UBX_Checksum(uint8_t *checksumA, uint8_t *checksumB, const uint8_t *data, uint16_t length)
+{
+  uint8_t a = *checksumA;
+  uint8_t b = *checksumB;
+
+  for(uint16_t i = 0; i < length; i++)
+  {
+    a += data[i];
+    b += a;
+  }
+
+  *checksumA = a;
+  *checksumB = b;
+}
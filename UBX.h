@@ -0,0 +1,103 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file UBX.h
+ * \brief u-blox UBX binary protocol header file
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _UBX_H
+#define _UBX_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include "GPS_Ingest.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   UBX_SYNC_CHAR_1           0xB5
+#define   UBX_SYNC_CHAR_2           0x62
+
+#define   UBX_HEADER_SIZE           6         ///< Sync chars, class, id, length
+#define   UBX_CHECKSUM_SIZE         2
+#define   UBX_MAX_PAYLOAD           256       ///< Longer frames are rejected
+#define   UBX_MAX_FRAME             (UBX_HEADER_SIZE + UBX_MAX_PAYLOAD + UBX_CHECKSUM_SIZE)
+
+#define   UBX_CLASS_NAV             0x01
+#define   UBX_CLASS_ACK             0x05
+#define   UBX_CLASS_CFG             0x06
+#define   UBX_CLASS_NMEA            0xF0      ///< Standard NMEA sentences, for CFG-MSG
+
+#define   UBX_NAV_PVT               0x07
+#define   UBX_ACK_NAK               0x00
+#define   UBX_ACK_ACK               0x01
+#define   UBX_CFG_PRT               0x00
+#define   UBX_CFG_MSG               0x01
+#define   UBX_CFG_RATE              0x08
+
+#define   UBX_NAV_PVT_MIN_LENGTH    84        ///< u-blox 7 length; u-blox 8 and later append fields (92 bytes)
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  UBX_STATE_SYNC_1 = 0,
+  UBX_STATE_SYNC_2,
+  UBX_STATE_CLASS,
+  UBX_STATE_ID,
+  UBX_STATE_LENGTH_1,
+  UBX_STATE_LENGTH_2,
+  UBX_STATE_PAYLOAD,
+  UBX_STATE_CHECKSUM_A,
+  UBX_STATE_CHECKSUM_B
+}e_ubxState;
+
+
+typedef void (*ubxFrameHandler)(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+
+typedef struct
+{
+  e_ubxState      state;
+  uint16_t        length;                 ///< Payload length announced by the frame header
+  uint16_t        rawLength;              ///< Nb of bytes of the current frame stored in raw[]
+  uint8_t         checksumA;
+  uint8_t         checksumB;
+  uint8_t         raw[UBX_MAX_FRAME];     ///< Current frame, kept to resume sync from it if rejected
+
+  ubxFrameHandler onFrame;                ///< Called for each frame with a valid checksum
+
+  uint32_t        frames;                 ///< Valid frames decoded
+  uint32_t        checksumErrors;
+  uint32_t        lengthErrors;           ///< Frames announcing a payload longer than UBX_MAX_PAYLOAD
+}s_ubxParser;
+
+
+//---------------------------------------------
+// Type
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void UBX_Init(s_ubxParser *parser, ubxFrameHandler onFrame);
+extern void UBX_Decode(s_ubxParser *parser, uint8_t c);
+extern bool UBX_ParseNavPvt(const uint8_t *payload, uint16_t length, s_gpsFix *fix);
+extern void UBX_Send(Print &port, uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+
+#endif
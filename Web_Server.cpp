@@ -24,6 +24,8 @@
 #include "Settings.h"
 #include "Web_Server.h"
 #include "File.h"
+#include "Storage.h"
+#include "TripFile.h"
 
 
 //---------------------------------------------
@@ -32,6 +34,8 @@
 #define DEBUG_WEBSERVER
 
 #define   SERVER_VERSION      "1.0"
+#define   HTML_CHUNK_SIZE     1000          ///< htmlContent is sent once it exceeds this size
+#define   HTML_SYNC_MS        2000          ///< Longest wait for queued trip records before a download
 #define   SERVER_NAME         "dashboard"   ///< Set your server's logical name here e.g. if myserver then address is http://myserver.local/
                                             ///< if you have 'Bonjour' running or your system supports multicast dns
                                             
@@ -81,11 +85,13 @@ static void HTML_Page_InfoMessage(String message, String target);
 // Page Content Functions
 static void HTML_Append_Header();
 static void HTML_Append_Footer();
-static void HTML_Append_FileDirectory(fs::FS &fs, const char * dirname, uint8_t levels);
+static void HTML_Append_FileDirectory();
+static void HTML_Append_FileRow(const char *path, uint32_t size);
 
 // Upload/download functions
 static void HTML_Handle_Firmware_Upload();
-static void HTML_Handle_Download(fs::FS &fs, String filename);
+static void HTML_Handle_Download(fs::FS &fs, String filename, String format);
+static void HTML_Handle_Convert(fs::FS &fs, String filename, e_tripFileFormat format);
 static void HTML_Handle_Upload(fs::FS &fs);
 
 // Communication to client functions
@@ -188,10 +194,10 @@ static void HTML_Request_File_Download()
   {
     if (server.hasArg("download")) 
     {
-      HTML_Handle_Download(fileSystem, server.arg(0));
+      HTML_Handle_Download(fileSystem, server.arg("download"), server.arg("format"));
       
 #ifdef DEBUG_WEBSERVER
-      Serial.println(server.arg(0));
+      Serial.println(server.arg("download"));
 #endif
     }
   }
@@ -365,55 +371,14 @@ static void HTML_Page_Files_Directory(fs::FS &fs)
 {
   if (SD_present) 
   { 
-    File root = fs.open("/");
-    
-    if(!root.isDirectory())
-    {
-#ifdef DEBUG_WEBSERVER
-        Serial.println(" - not a directory");
-#endif
-        
-        return;
-    }
-
-    
     HTML_Send_Header();
       
-    if(!root)
+    if(File_IndexCount() == 0)
     {
-#ifdef DEBUG_WEBSERVER
-        Serial.println("- failed to open directory");
-#endif
-
-        htmlContent += "    <h3>No Files Found</h3>\n";
-        return;
+      htmlContent += "    <h3>No Files Found</h3>\n";
     }
     else 
     {
-      /*
-      File file = root.openNextFile();
-      
-      while(file)
-      {
-          if(file.isDirectory())
-          {
-              Serial.print("  DIR : ");
-              Serial.println(file.name());
-              
-          } 
-          else 
-          {
-              Serial.print("  FILE: ");
-              Serial.print(file.name());
-              Serial.print("\tSIZE: ");
-              Serial.println(file.size());
-          }
-          
-          file = root.openNextFile();
-      }*/
-      
-      root.rewindDirectory();
-      
       htmlContent += "    <h3>SD Card Contents</h3><br>\n";
       htmlContent += "    <table align='center'>\n";
       htmlContent += "      <tr>\n";
@@ -424,13 +389,11 @@ static void HTML_Page_Files_Directory(fs::FS &fs)
       htmlContent += "        <th>Delete</th>\n";
       htmlContent += "      </tr>\n";
       
-      HTML_Append_FileDirectory(fileSystem, "/",0);
+      HTML_Append_FileDirectory();
       
       htmlContent += "    </table>\n";
       htmlContent += "    <br>\n";
       HTML_Send_Content();
-      
-      root.close();
     }
     
     HTML_Append_Footer();
@@ -460,6 +423,7 @@ static void HTML_Page_File_Delete(fs::FS &fs, String filename)
     {
       if (fs.remove("/"+filename)) 
       {
+        File_IndexRemove(("/"+filename).c_str());
 #ifdef DEBUG_WEBSERVER
         Serial.println("File deleted successfully");
 #endif
@@ -526,10 +490,23 @@ static void HTML_Page_InfoMessage(String message, String target)
 }
 
 
-static void HTML_Handle_Download(fs::FS &fs, String filename)
+static void HTML_Handle_Download(fs::FS &fs, String filename, String format)
 {
   if (SD_present) 
   { 
+    Storage_Sync(HTML_SYNC_MS);   // Trip being recorded may be the one downloaded
+
+    if(format == "csv")
+    {
+      HTML_Handle_Convert(fs, filename, TRIPFILE_FORMAT_CSV);
+      return;
+    }
+    if(format == "gpx")
+    {
+      HTML_Handle_Convert(fs, filename, TRIPFILE_FORMAT_GPX);
+      return;
+    }
+
     File download = fs.open("/"+filename);
   
     if (download) 
@@ -552,6 +529,48 @@ static void HTML_Handle_Download(fs::FS &fs, String filename)
 }
 
 
+// Trip file sent as CSV or GPX, converted record by record while sending
+static void HTML_Handle_Convert(fs::FS &fs, String filename, e_tripFileFormat format)
+{
+  s_tripFileReader reader;
+  s_tripRecord record;
+  char line[TRIPFILE_LINE_SIZE];
+  String name = filename.substring(0, filename.lastIndexOf('.')) + TripFile_FormatExt(format);
+
+  if(!TripFile_Open(&reader, fs, ("/"+filename).c_str()))
+  {
+    HTML_Page_InfoMessage("Not a trip file", "dir");
+    return;
+  }
+
+  server.sendHeader("Content-Disposition", "attachment; filename="+name);
+  server.sendHeader("Connection", "close");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, TripFile_FormatMimeType(format), "");
+
+  TripFile_FormatHeader(line, format, &reader);
+  htmlContent += line;
+
+  while(TripFile_Next(&reader, &record))
+  {
+    TripFile_FormatRecord(line, format, &reader, &record);
+    htmlContent += line;
+
+    if(htmlContent.length() > HTML_CHUNK_SIZE)
+    {
+      HTML_Send_Content();
+    }
+  }
+  TripFile_Close(&reader);
+
+  TripFile_FormatFooter(line, format);
+  htmlContent += line;
+
+  HTML_Send_Content();
+  HTML_Send_Stop();
+}
+
+
 static void HTML_Handle_Upload(fs::FS &fs)
 {
 #ifdef DEBUG_WEBSERVER
@@ -578,6 +597,7 @@ static void HTML_Handle_Upload(fs::FS &fs)
 #endif
     
     fs.remove(filename);                         // Remove a previous version, otherwise data is appended the file again
+    File_IndexRemove(filename.c_str());
     UploadFile = fs.open(filename, FILE_WRITE);  // Open the file for writing in SPIFFS (create it, if doesn't exist)
     filename = String();
   }
@@ -596,6 +616,7 @@ static void HTML_Handle_Upload(fs::FS &fs)
   {
     if(UploadFile)          // If the file was successfully created
     {                                    
+      File_IndexUpdate(UploadFile.path(), UploadFile.size());
       UploadFile.close();   // Close the file again
       
 #ifdef DEBUG_WEBSERVER
@@ -733,84 +754,78 @@ static void HTML_Append_Footer()
 }
 
 
-static void HTML_Append_FileDirectory(fs::FS &fs, const char * dirname, uint8_t levels)
+// Rows of the files of the size index, the directory is only read when
+// the index does not hold all the files
+static void HTML_Append_FileDirectory()
 {
-  File root = fs.open(dirname);
+  s_fileEntry entry;
+  File root, file;
   
-  if(!root)
-  {
-    return;
-  }
-  
-  if(!root.isDirectory())
+  if(File_IndexComplete())
   {
+    for(int i = 0; File_IndexEntry(i, &entry); i++)
+    {
+      HTML_Append_FileRow(entry.path, entry.size);
+    }
     return;
   }
-  
-  File file = root.openNextFile();
 
-  String temp;
-  
+  root = fileSystem.open("/");
+  file = root.openNextFile();
   while(file)
   {
-    if (htmlContent.length() > 1000) 
+    if(!file.isDirectory())
     {
-      HTML_Send_Content();
+      HTML_Append_FileRow(file.path(), file.size());
     }
-    
-    if(file.isDirectory())
-    {
-#ifdef DEBUG_WEBSERVER
-      Serial.println(String(file.isDirectory()?"Dir ":"File ")+String(file.name()));
-#endif
+    file = root.openNextFile();
+  }
+  root.close();
+}
 
-      htmlContent += "      <tr>\n";
-      htmlContent += "        <td>"+String(file.isDirectory()?"Dir":"File")+"</td>\n";
-      htmlContent += "        <td>"+String(file.name())+"</td>\n";
-      htmlContent += "        <td></td>\n";      
-      htmlContent += "        <td></td>\n";
-      htmlContent += "      </tr>\n";
-      
-      HTML_Append_FileDirectory(fileSystem, file.name(), levels-1);
-    }
-    else
-    {
-      temp = String(file.name());
-      temp.remove(0,1);
-      
-      //Serial.print(String(file.name())+"\t");
-      htmlContent += "      <tr>\n";
-      htmlContent += "        <td>"+ temp + "</td>\n";  
-      //htmlContent += "<tr><td><form name='monForm' method='post' action='/download'>   <a title ='Download File' href='#' onclick='Go()>" + String(file.name())+"</a></form></td>";
 
-#ifdef DEBUG_WEBSERVER
-      Serial.println("post value : "+temp);
-      Serial.print(String(file.isDirectory()?"Dir ":"File ")+String(file.name())+"\t");
-#endif
+static void HTML_Append_FileRow(const char *path, uint32_t size)
+{
+  String temp;
+  
+  if (htmlContent.length() > HTML_CHUNK_SIZE) 
+  {
+    HTML_Send_Content();
+  }
+  
+  temp = String(path);
+  temp.remove(0,1);
+  
+  htmlContent += "      <tr>\n";
+  htmlContent += "        <td>"+ temp + "</td>\n";  
 
-      htmlContent += "        <td>" + String(file.isDirectory()?"Dir":"File") + "</td>\n";
-      htmlContent += "        <td>" + File_FormatSize(file.size()) + "</td>\n";
-      htmlContent += "        <td>\n";
-      htmlContent += "          <form action='/download' method='post'>\n";
-      htmlContent += "            <button type='submit' name='download' value='"+temp+"'>Download</button>\n";
-      htmlContent += "          </form>\n";
-      htmlContent += "        </td>\n";
-      htmlContent += "        <td>\n";
-      htmlContent += "          <form action='/delete' method='post'>\n";
-      htmlContent += "            <button type='submit' name='delete' value='"+temp+"'>Delete</button>\n";
-      htmlContent += "          </form>\n";
-      htmlContent += "        </td>\n";
-      htmlContent += "      </tr>\n";
-      
 #ifdef DEBUG_WEBSERVER
-      Serial.println(File_FormatSize(file.size()));
+  Serial.println("post value : "+temp);
 #endif
-    }
-    
-    file = root.openNextFile();
+
+  htmlContent += "        <td>File</td>\n";
+  htmlContent += "        <td>" + File_FormatSize(size) + "</td>\n";
+  htmlContent += "        <td>\n";
+  htmlContent += "          <form action='/download' method='post'>\n";
+  if(temp.endsWith(TRIPFILE_EXT))
+  {
+    htmlContent += "            <input type='hidden' name='download' value='"+temp+"'>\n";
+    htmlContent += "            <button type='submit' name='format' value='csv'>CSV</button>\n";
+    htmlContent += "            <button type='submit' name='format' value='gpx'>GPX</button>\n";
+    htmlContent += "            <button type='submit' name='format' value=''>Raw</button>\n";
   }
-  
-  file.close();
+  else
+  {
+    htmlContent += "            <button type='submit' name='download' value='"+temp+"'>Download</button>\n";
+  }
+  htmlContent += "          </form>\n";
+  htmlContent += "        </td>\n";
+  htmlContent += "        <td>\n";
+  htmlContent += "          <form action='/delete' method='post'>\n";
+  htmlContent += "            <button type='submit' name='delete' value='"+temp+"'>Delete</button>\n";
+  htmlContent += "          </form>\n";
+  htmlContent += "        </td>\n";
+  htmlContent += "      </tr>\n";
 }
 
 
@@ -864,7 +879,7 @@ void SD_file_stream(String filename)
 { 
   if (SD_present) 
   { 
-    File dataFile = SPIFFS.open("/"+filename, FILE_READ); // Now read data from SD Card
+    File dataFile = fileSystem.open("/"+filename, FILE_READ); // Now read data from SD Card
 
 #ifdef DEBUG_WEBSERVER
     Serial.print("Streaming file: "); Serial.println(filename);
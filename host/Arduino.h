@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file Arduino.h
+ * \brief Host (Linux) stand-in of the Arduino ESP32 core
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Just what the GPS path (GPS_Ingest, UBX, GPS, Odometer, GPS_Replay) needs
+ * to build natively: time from the monotonic clock, Serial on stdout, and
+ * no-op FreeRTOS, interrupts and timers. Single threaded, so critical
+ * sections are empty.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+using std::min;
+using std::max;
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   HOST_BUILD
+
+#define   IRAM_ATTR
+#define   PROGMEM
+
+#define   INPUT             0x01
+#define   INPUT_PULLUP      0x05
+#define   OUTPUT            0x03
+#define   RISING            0x01
+#define   FALLING           0x02
+#define   LOW               0
+#define   HIGH              1
+#define   SERIAL_8N1        0x800001c
+
+#define   PI                3.1415926535897932384626433832795
+#define   TWO_PI            6.283185307179586476925286766559
+#define   DEG_TO_RAD        0.017453292519943295769236907684886
+#define   RAD_TO_DEG        57.295779513082320876798154814105
+#define   radians(deg)      ((deg)*DEG_TO_RAD)
+#define   degrees(rad)      ((rad)*RAD_TO_DEG)
+#define   sq(x)             ((x)*(x))
+#define   constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+#define   digitalPinToInterrupt(p)  (p)
+
+// FreeRTOS
+#define   pdTRUE            1
+#define   pdFALSE           0
+#define   pdPASS            1
+#define   pdMS_TO_TICKS(ms) (ms)
+
+#define   portMUX_INITIALIZER_UNLOCKED  {0}
+#define   portENTER_CRITICAL(mux)       (void)(mux)
+#define   portEXIT_CRITICAL(mux)        (void)(mux)
+#define   portENTER_CRITICAL_ISR(mux)   (void)(mux)
+#define   portEXIT_CRITICAL_ISR(mux)    (void)(mux)
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef uint8_t byte;
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+typedef struct
+{
+  int owner;
+}portMUX_TYPE;
+
+typedef struct
+{
+  int id;
+}hw_timer_t;
+
+
+class String
+{
+public:
+  String(const char *s = "") : str(s) {}
+  const char *c_str() const { return str.c_str(); }
+  unsigned int length() const { return str.length(); }
+private:
+  std::string str;
+};
+
+
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size)
+  {
+    for(size_t i = 0; i < size; i++)
+    {
+      write(buffer[i]);
+    }
+    return size;
+  }
+  size_t write(const char *s) { return write((const uint8_t*)s, strlen(s)); }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(long n) { return printf("%ld", n); }
+  size_t println(const char *s) { return print(s) + print("\r\n"); }
+  size_t println(const String &s) { return print(s) + print("\r\n"); }
+  size_t println(long n) { return print(n) + print("\r\n"); }
+  size_t println() { return print("\r\n"); }
+
+  size_t printf(const char *format, ...)
+  {
+    char buff[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buff, sizeof(buff), format, args);
+    va_end(args);
+    return write((const uint8_t*)buff, min((size_t)max(len, 0), sizeof(buff) - 1));
+  }
+};
+
+
+class Stream : public Print
+{
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+  virtual void flush() {}
+};
+
+
+/// Serial console, on stdout
+class HostSerial : public Stream
+{
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+  using Print::write;
+};
+
+
+class EspClass
+{
+public:
+  uint32_t getCycleCount();       ///< Nanoseconds on host
+  uint32_t getCpuFreqMHz() { return 1000; }
+  uint32_t getFreeHeap() { return 0; }
+  void restart() { exit(0); }
+};
+
+
+//---------------------------------------------
+// Public variables
+//---------------------------------------------
+extern HostSerial Serial;
+extern EspClass ESP;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+static inline uint64_t HOST_Nanos()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline unsigned long millis() { return (unsigned long)(HOST_Nanos() / 1000000ULL); }
+static inline unsigned long micros() { return (unsigned long)(HOST_Nanos() / 1000ULL); }
+
+static inline void delay(unsigned long ms)
+{
+  struct timespec ts = {(time_t)(ms / 1000), (long)(ms % 1000) * 1000000L};
+  nanosleep(&ts, NULL);
+}
+
+inline uint32_t EspClass::getCycleCount() { return (uint32_t)HOST_Nanos(); }
+
+static inline long random(long howbig) { return (howbig > 0) ? (rand() % howbig) : 0; }
+static inline long random(long howsmall, long howbig) { return howsmall + random(howbig - howsmall); }
+
+static inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+static inline int digitalRead(uint8_t pin) { (void)pin; return HIGH; }
+static inline void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+static inline void attachInterrupt(int pin, void (*isr)(void), int mode) { (void)pin; (void)isr; (void)mode; }
+
+// Timers never fire on host
+static inline hw_timer_t *timerBegin(uint8_t num, uint16_t divider, bool countUp) { static hw_timer_t timer; (void)num; (void)divider; (void)countUp; return &timer; }
+static inline void timerAttachInterrupt(hw_timer_t *timer, void (*isr)(void), bool edge) { (void)timer; (void)isr; (void)edge; }
+static inline void timerAlarmWrite(hw_timer_t *timer, uint64_t value, bool reload) { (void)timer; (void)value; (void)reload; }
+static inline void timerAlarmEnable(hw_timer_t *timer) { (void)timer; }
+
+// No task on host: data is fed by the caller
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stack, void *param,
+                                                 UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+  (void)task; (void)name; (void)stack; (void)param; (void)priority; (void)core;
+  if(handle != NULL)
+  {
+    *handle = NULL;
+  }
+  return pdFALSE;
+}
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) { (void)clear; delay(ticks); return 0; }
+static inline void xTaskNotifyGive(TaskHandle_t task) { (void)task; }
+
+#include "HardwareSerial.h"
+
+#endif
@@ -0,0 +1,58 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file FS.h
+ * \brief Host (Linux) stand-in of the Arduino file system API
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Files are never opened on host; captures are read with stdio by
+ * GPS_Replay_Host.cpp.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _HOST_FS_H
+#define _HOST_FS_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Arduino.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   FILE_READ         "r"
+#define   FILE_WRITE        "w"
+#define   FILE_APPEND       "a"
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+namespace fs
+{
+  class File : public Stream
+  {
+  public:
+    size_t write(uint8_t c) override { (void)c; return 0; }
+    size_t read(uint8_t *buffer, size_t size) { (void)buffer; (void)size; return 0; }
+    using Stream::read;
+    void close() {}
+    operator bool() const { return false; }
+  };
+
+  class FS
+  {
+  public:
+    File open(const char *path, const char *mode = FILE_READ) { (void)path; (void)mode; return File(); }
+    bool exists(const char *path) { (void)path; return false; }
+  };
+}
+
+using fs::FS;
+using fs::File;
+
+#endif
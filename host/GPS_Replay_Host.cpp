@@ -0,0 +1,178 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file GPS_Replay_Host.cpp
+ * \brief Native (Linux) GPS replay, for parser and odometer benchmarks
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Runs a capture through GPS_Ingest_Feed() and GPS_Process() with the same
+ * sources as the target, and prints the GPS_Replay report.
+ * Build from the sketch folder, TINYGPS pointing to TinyGPSPlus/src:
+ *
+ *   g++ -std=gnu++17 -O2 -DARDUINO=100 -Ihost -I. -I$TINYGPS \
+ *       host/GPS_Replay_Host.cpp GPS_Replay.cpp GPS_Ingest.cpp UBX.cpp \
+ *       GPS.cpp Odometer.cpp History.cpp Track.cpp $TINYGPS/TinyGPS++.cpp -o gps_replay
+ *
+ * Add -DGPS_PROTOCOL_UBX for a UBX capture.
+ * Usage: gps_replay <capture file> [speed factor, 0 = max speed (default)]
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include <Arduino.h>
+#include <TimeLib.h>
+
+#include "GPS.h"
+#include "GPS_Replay.h"
+#include "File.h"
+#include "Storage.h"
+#include "RPM.h"
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   HOST_READ_CHUNK_SIZE      4096
+
+
+//---------------------------------------------
+// Variables
+//---------------------------------------------
+HostSerial Serial;
+EspClass ESP;
+
+fs::FS fileSystem;
+
+float rpm = 0;                    ///< No engine on host (RPM.cpp needs the PCNT peripheral)
+
+static int timeYear, timeMonth, timeDay, timeHour, timeMinute, timeSecond;
+
+
+//---------------------------------------------
+// Functions declarations
+//---------------------------------------------
+
+// Trip log is not written on host. Open and close are accepted, so the
+// phase machine records as on target
+bool Storage_OpenTrip(const char *path, uint32_t startTime, int32_t timeZone)
+{
+  (void)path; (void)startTime; (void)timeZone;
+  return true;
+}
+
+
+bool Storage_Record(const s_tripRecord *record)
+{
+  (void)record;
+  return false;
+}
+
+
+bool Storage_CloseTrip()
+{
+  return true;
+}
+
+
+void setTime(int hr, int min, int sec, int day, int month, int yr)
+{
+  timeHour = hr;
+  timeMinute = min;
+  timeSecond = sec;
+  timeDay = day;
+  timeMonth = month;
+  timeYear = yr;
+}
+
+
+void adjustTime(long adjustment)
+{
+  timeHour = (timeHour + adjustment / 3600) % 24;
+}
+
+
+int year()   { return timeYear; }
+int month()  { return timeMonth; }
+int day()    { return timeDay; }
+int hour()   { return timeHour; }
+int minute() { return timeMinute; }
+int second() { return timeSecond; }
+
+
+time_t makeTime(const tmElements_t &tm)
+{
+  struct tm t;
+
+  memset(&t, 0, sizeof(t));
+  t.tm_year = tmYearToCalendar(tm.Year) - 1900;
+  t.tm_mon = tm.Month - 1;
+  t.tm_mday = tm.Day;
+  t.tm_hour = tm.Hour;
+  t.tm_min = tm.Minute;
+  t.tm_sec = tm.Second;
+
+  return timegm(&t);
+}
+
+
+void breakTime(time_t time, tmElements_t &tm)
+{
+  struct tm t;
+
+  gmtime_r(&time, &t);
+  tm.Year = CalendarYrToTm(t.tm_year + 1900);
+  tm.Month = t.tm_mon + 1;
+  tm.Day = t.tm_mday;
+  tm.Wday = t.tm_wday + 1;
+  tm.Hour = t.tm_hour;
+  tm.Minute = t.tm_min;
+  tm.Second = t.tm_sec;
+}
+
+
+int main(int argc, char *argv[])
+{
+  static uint8_t buff[HOST_READ_CHUNK_SIZE];
+  s_gpsReplayReport report;
+  float speed = GPS_REPLAY_MAX_SPEED;
+  size_t len;
+  FILE *capture;
+
+  if(argc < 2)
+  {
+    fprintf(stderr, "usage: %s <capture file> [speed factor, 0 = max speed]\n", argv[0]);
+    return 1;
+  }
+
+  if(argc > 2)
+  {
+    speed = atof(argv[2]);
+  }
+
+  capture = fopen(argv[1], "rb");
+  if(capture == NULL)
+  {
+    perror(argv[1]);
+    return 1;
+  }
+
+  GPS_Replay_Begin(speed);
+
+  while((len = fread(buff, 1, sizeof(buff), capture)) > 0)
+  {
+    GPS_Replay_Feed(buff, len);
+  }
+  fclose(capture);
+
+  GPS_Replay_End(&report);
+  GPS_Replay_PrintReport(&report);
+  GPS_PrintProcessStats();
+
+  return 0;
+}
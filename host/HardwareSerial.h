@@ -0,0 +1,68 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file HardwareSerial.h
+ * \brief Host (Linux) stand-in of the ESP32 uart driver
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Never receives anything: on host, GPS data comes from GPS_Replay_Feed().
+ * Written bytes are dropped.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _HOST_HARDWARE_SERIAL_H
+#define _HOST_HARDWARE_SERIAL_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Arduino.h"
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef enum
+{
+  UART_NO_ERROR,
+  UART_BREAK_ERROR,
+  UART_BUFFER_FULL_ERROR,
+  UART_FIFO_OVF_ERROR,
+  UART_FRAME_ERROR,
+  UART_PARITY_ERROR
+}hardwareSerial_error_t;
+
+typedef std::function<void(void)> OnReceiveCb;
+typedef std::function<void(hardwareSerial_error_t)> OnReceiveErrorCb;
+
+
+class HardwareSerial : public Stream
+{
+public:
+  HardwareSerial(int uartNum) : baud(0) { (void)uartNum; }
+
+  void begin(unsigned long baudrate, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1)
+  {
+    (void)config; (void)rxPin; (void)txPin;
+    baud = baudrate;
+  }
+  void updateBaudRate(unsigned long baudrate) { baud = baudrate; }
+  unsigned long baudRate() { return baud; }
+  size_t setRxBufferSize(size_t size) { return size; }
+  void onReceive(OnReceiveCb function, bool onlyOnTimeout = false) { (void)function; (void)onlyOnTimeout; }
+  void onReceiveError(OnReceiveErrorCb function) { (void)function; }
+
+  int available() override { return 0; }
+  int read() override { return -1; }
+  size_t read(uint8_t *buffer, size_t size) { (void)buffer; (void)size; return 0; }
+  size_t write(uint8_t c) override { (void)c; return 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { (void)buffer; return size; }
+  using Print::write;
+
+private:
+  unsigned long baud;
+};
+
+#endif
@@ -0,0 +1,21 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file SPIFFS.h
+ * \brief Host (Linux) stand-in of the SPIFFS file system
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _HOST_SPIFFS_H
+#define _HOST_SPIFFS_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "FS.h"
+
+#endif
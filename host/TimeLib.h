@@ -0,0 +1,61 @@
+//-----------------------------------------------------------------------------
+/**
+ *
+ * \file TimeLib.h
+ * \brief Host (Linux) stand-in of the Time library
+ * \author M.Navarro
+ * \date 10/2026
+ *
+ * Keeps the time set from the GPS fix, without running it. Conversions
+ * to and from time_t use the C library.
+ */
+//-----------------------------------------------------------------------------
+// (c) Copyright MN 2026 - All rights reserved
+//-----------------------------------------------------------------------------
+#ifndef _HOST_TIMELIB_H
+#define _HOST_TIMELIB_H
+
+//---------------------------------------------
+// Include
+//---------------------------------------------
+#include "Arduino.h"
+#include <time.h>
+
+
+//---------------------------------------------
+// Defines
+//---------------------------------------------
+#define   tmYearToCalendar(Y)       ((Y) + 1970)
+#define   CalendarYrToTm(Y)         ((Y) - 1970)
+
+
+//---------------------------------------------
+// Enum, struct, union
+//---------------------------------------------
+typedef struct
+{
+  uint8_t   Second;
+  uint8_t   Minute;
+  uint8_t   Hour;
+  uint8_t   Wday;
+  uint8_t   Day;
+  uint8_t   Month;
+  uint8_t   Year;                 ///< Offset from 1970
+}tmElements_t;
+
+
+//---------------------------------------------
+// Public Functions
+//---------------------------------------------
+extern void setTime(int hr, int min, int sec, int day, int month, int yr);
+extern void adjustTime(long adjustment);
+extern int year();
+extern int month();
+extern int day();
+extern int hour();
+extern int minute();
+extern int second();
+extern time_t makeTime(const tmElements_t &tm);
+extern void breakTime(time_t time, tmElements_t &tm);
+
+#endif
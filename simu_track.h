@@ -0,0 +1,850 @@
+#ifndef _SIMU_TRACK_BIN_H
+#define _SIMU_TRACK_BIN_H
+
+
+// SIMU_TEST_GPS track, generated by tools/simu_track.py. Only included by SimuTrack.cpp
+const uint8_t simu_track_bin[] = {
+   0x53, 0x54, 0x52, 0x4b, 0x01, 0x00, 0xf6, 0x07, 0xb8, 0xd1, 0xe5, 0xb1,
+   0x03, 0xd0, 0xac, 0xff, 0x28, 0xb0, 0x09, 0xa6, 0x04, 0x28, 0x00, 0xf4,
+   0x25, 0x48, 0x01, 0xde, 0x06, 0xcf, 0x15, 0x00, 0x56, 0xb9, 0x25, 0x01,
+   0xc3, 0x07, 0xfd, 0x73, 0x02, 0x96, 0x11, 0xef, 0x64, 0x00, 0xd2, 0x0b,
+   0x93, 0x57, 0x00, 0x97, 0x07, 0x91, 0x6e, 0x01, 0x85, 0x01, 0xb1, 0x18,
+   0x01, 0x78, 0x95, 0x4b, 0x00, 0xe2, 0x06, 0xa3, 0x2e, 0x01, 0xa4, 0x0f,
+   0xd3, 0x25, 0x02, 0xd0, 0x11, 0xfd, 0x23, 0x00, 0xf2, 0x06, 0x9b, 0x14,
+   0x00, 0xa4, 0x04, 0xab, 0x15, 0x00, 0x9e, 0x01, 0xf5, 0x15, 0x0a, 0x97,
+   0x02, 0x93, 0x17, 0x02, 0xc3, 0x04, 0xdf, 0x16, 0x04, 0xc1, 0x05, 0x91,
+   0x16, 0x02, 0x87, 0x0c, 0xb5, 0x2d, 0x02, 0xc9, 0x14, 0xd1, 0x46, 0x04,
+   0xed, 0x1a, 0xb1, 0x48, 0x02, 0x8f, 0x2e, 0x99, 0x58, 0x00, 0xc7, 0x05,
+   0x99, 0x0e, 0x00, 0xc9, 0x0d, 0xe9, 0x1f, 0x00, 0xfb, 0x13, 0xdd, 0x20,
+   0x01, 0x89, 0x19, 0xcd, 0x1d, 0x03, 0x89, 0x0e, 0x91, 0x0d, 0x01, 0x93,
+   0x0e, 0x89, 0x0e, 0x00, 0x9f, 0x0c, 0x89, 0x10, 0x01, 0xe7, 0x09, 0xa9,
+   0x11, 0x03, 0xfb, 0x07, 0xcd, 0x11, 0x01, 0xcb, 0x04, 0xcb, 0x12, 0x00,
+   0xc1, 0x02, 0xb7, 0x15, 0x01, 0xcf, 0x09, 0xbd, 0x2b, 0x01, 0xab, 0x0b,
+   0x9d, 0x23, 0x01, 0xbd, 0x03, 0xd1, 0x10, 0x01, 0xff, 0x01, 0xf7, 0x12,
+   0x00, 0xd7, 0x01, 0xd5, 0x28, 0x01, 0xe1, 0x02, 0xfb, 0x14, 0x01, 0x83,
+   0x04, 0xfd, 0x14, 0x01, 0xa9, 0x03, 0xb1, 0x15, 0x01, 0x81, 0x03, 0x81,
+   0x15, 0x01, 0xfb, 0x03, 0x9d, 0x14, 0x00, 0xd9, 0x04, 0x8d, 0x12, 0x03,
+   0xc1, 0x09, 0x8b, 0x1d, 0x00, 0xf1, 0x03, 0xf7, 0x0a, 0x05, 0x91, 0x03,
+   0xdf, 0x08, 0x01, 0x9b, 0x03, 0x87, 0x07, 0x01, 0xc3, 0x05, 0xe1, 0x09,
+   0x00, 0x41, 0x85, 0x01, 0x00, 0xb9, 0x04, 0x55, 0x07, 0xd9, 0x2e, 0xa0,
+   0x1b, 0x00, 0xe1, 0x28, 0xd0, 0x0e, 0x04, 0x99, 0x2e, 0x9c, 0x14, 0x02,
+   0x85, 0x32, 0xce, 0x1b, 0x04, 0xa9, 0x18, 0xae, 0x0e, 0x04, 0xd1, 0x16,
+   0xdc, 0x10, 0x04, 0xd1, 0x14, 0xb2, 0x12, 0x02, 0xff, 0x12, 0xa8, 0x14,
+   0x04, 0xcb, 0x11, 0xb6, 0x15, 0x02, 0xf7, 0x0f, 0xee, 0x15, 0x02, 0x9b,
+   0x0b, 0xdc, 0x17, 0x02, 0xf3, 0x07, 0xec, 0x19, 0x00, 0x04, 0xc8, 0x1e,
+   0x04, 0xb4, 0x03, 0x96, 0x21, 0x00, 0xa6, 0x0f, 0xca, 0x47, 0x04, 0xe6,
+   0x0a, 0xb4, 0x24, 0x02, 0xbe, 0x0c, 0xda, 0x22, 0x04, 0x80, 0x0d, 0xb0,
+   0x1f, 0x02, 0xbe, 0x0b, 0xf8, 0x1a, 0x00, 0xe6, 0x08, 0xfe, 0x17, 0x06,
+   0x8e, 0x06, 0xe6, 0x16, 0x00, 0xb8, 0x03, 0x9a, 0x16, 0x02, 0x1f, 0xe4,
+   0x16, 0x02, 0xad, 0x0a, 0x94, 0x2b, 0x00, 0xcf, 0x0b, 0x98, 0x10, 0x02,
+   0xc3, 0x0f, 0x90, 0x09, 0x00, 0x91, 0x12, 0x9c, 0x04, 0x02, 0xc7, 0x14,
+   0xe8, 0x01, 0x00, 0xcf, 0x16, 0x10, 0x02, 0x83, 0x31, 0x66, 0x04, 0xf5,
+   0x19, 0xa6, 0x01, 0x02, 0x83, 0x1a, 0x8c, 0x01, 0x02, 0x8d, 0x18, 0xae,
+   0x01, 0x04, 0xb1, 0x15, 0x82, 0x03, 0x02, 0xd5, 0x12, 0xd6, 0x05, 0x00,
+   0xc3, 0x10, 0xdc, 0x08, 0x04, 0xad, 0x0c, 0xd6, 0x0d, 0x02, 0xc7, 0x0b,
+   0xae, 0x29, 0x04, 0x86, 0x05, 0xb0, 0x32, 0x02, 0x94, 0x03, 0x82, 0x18,
+   0x02, 0xea, 0x02, 0xee, 0x15, 0x02, 0x5e, 0x90, 0x13, 0x02, 0xb3, 0x02,
+   0xc0, 0x23, 0x04, 0x9b, 0x05, 0xb0, 0x35, 0x02, 0x97, 0x0c, 0x90, 0x5a,
+   0x00, 0x9b, 0x0b, 0x9a, 0x30, 0x04, 0xb3, 0x08, 0x88, 0x16, 0x02, 0xe3,
+   0x09, 0xb2, 0x14, 0x02, 0xbd, 0x17, 0x86, 0x2b, 0x00, 0x99, 0x0b, 0xca,
+   0x19, 0x06, 0xb7, 0x08, 0x82, 0x1a, 0x02, 0xbd, 0x05, 0x8e, 0x19, 0x00,
+   0x9b, 0x01, 0xd2, 0x18, 0x02, 0x80, 0x02, 0xac, 0x1a, 0x02, 0xe4, 0x02,
+   0xe2, 0x1a, 0x02, 0x9c, 0x01, 0xfe, 0x19, 0x02, 0x6f, 0x96, 0x19, 0x00,
+   0x93, 0x08, 0x96, 0x35, 0x02, 0xcf, 0x04, 0xb6, 0x07, 0x00, 0xe5, 0x07,
+   0x44, 0x02, 0xad, 0x10, 0xd3, 0x0d, 0x00, 0xfd, 0x06, 0xe3, 0x08, 0x00,
+   0xed, 0x20, 0x8d, 0x19, 0x02, 0xe9, 0x01, 0x1d, 0x02, 0xe9, 0x05, 0xf1,
+   0x02, 0x00, 0x87, 0x0f, 0xd9, 0x0d, 0x00, 0x81, 0x3a, 0xcd, 0x3e, 0x00,
+   0xf7, 0x0e, 0x9d, 0x10, 0x00, 0x95, 0x3d, 0x8d, 0x47, 0x01, 0xe1, 0x0c,
+   0xb1, 0x15, 0x01, 0x99, 0x0b, 0xc7, 0x18, 0x00, 0xb1, 0x13, 0xa1, 0x36,
+   0x00, 0x83, 0x14, 0xbb, 0x31, 0x00, 0xc1, 0x18, 0x91, 0x27, 0x07, 0xc1,
+   0x1d, 0xd5, 0x21, 0x03, 0xe9, 0x20, 0x8d, 0x23, 0x01, 0xa5, 0x23, 0xab,
+   0x24, 0x03, 0xdb, 0x24, 0x93, 0x25, 0x01, 0xe1, 0x25, 0xd5, 0x24, 0x03,
+   0xdf, 0x24, 0xfd, 0x25, 0x00, 0x99, 0x23, 0xf1, 0x24, 0x03, 0x8b, 0x1f,
+   0xa3, 0x21, 0x00, 0x89, 0x20, 0xeb, 0x1f, 0x07, 0xef, 0x21, 0xe1, 0x22,
+   0x03, 0xb9, 0x23, 0xa3, 0x24, 0x01, 0xe9, 0x24, 0xbf, 0x25, 0x00, 0xa9,
+   0x25, 0xa1, 0x25, 0x03, 0xc5, 0x24, 0xf7, 0x26, 0x00, 0xf1, 0x10, 0xb1,
+   0x15, 0x05, 0xf3, 0x0e, 0x9d, 0x17, 0x00, 0x8d, 0x0d, 0x91, 0x19, 0x01,
+   0xbf, 0x0b, 0xf7, 0x1b, 0x01, 0x91, 0x0a, 0xdb, 0x20, 0x01, 0xb9, 0x08,
+   0xdf, 0x25, 0x01, 0xd7, 0x0f, 0x93, 0x54, 0x01, 0xf3, 0x07, 0xa1, 0x29,
+   0x01, 0xbb, 0x07, 0xd1, 0x26, 0x03, 0x9d, 0x06, 0xf3, 0x24, 0x01, 0xe5,
+   0x04, 0xef, 0x23, 0x01, 0x89, 0x02, 0xb7, 0x24, 0x00, 0x72, 0x83, 0x26,
+   0x03, 0xfe, 0x0b, 0x97, 0x82, 0x01, 0x00, 0xc8, 0x0b, 0xc9, 0x7e, 0x00,
+   0x80, 0x03, 0xcd, 0x25, 0x01, 0x6e, 0xfb, 0x43, 0x01, 0xe3, 0x0c, 0xf5,
+   0x39, 0x00, 0xc1, 0x1a, 0xd1, 0x30, 0x03, 0xe5, 0x10, 0xe1, 0x14, 0x00,
+   0x85, 0x35, 0xf1, 0x36, 0x03, 0xcf, 0x20, 0xe7, 0x23, 0x01, 0xb1, 0x1f,
+   0xf9, 0x23, 0x03, 0xab, 0x1c, 0xb1, 0x28, 0x03, 0xfb, 0x0b, 0xf1, 0x16,
+   0x01, 0x9f, 0x0a, 0xcd, 0x18, 0x01, 0xb7, 0x08, 0xfd, 0x19, 0x01, 0xb3,
+   0x06, 0x99, 0x1b, 0x01, 0xb9, 0x04, 0xd9, 0x1b, 0x00, 0xf7, 0x03, 0xf1,
+   0x37, 0x03, 0x53, 0x99, 0x38, 0x03, 0x0c, 0x8f, 0x1b, 0x01, 0x3f, 0xb3,
+   0x33, 0x01, 0x37, 0xf1, 0x34, 0x03, 0x6b, 0xaf, 0x35, 0x03, 0x52, 0xef,
+   0x33, 0x01, 0x35, 0xd1, 0x32, 0x01, 0xbf, 0x06, 0xc1, 0x31, 0x03, 0xf7,
+   0x0f, 0xa9, 0x30, 0x01, 0xdd, 0x19, 0xab, 0x2a, 0x03, 0xd7, 0x21, 0xb9,
+   0x1e, 0x01, 0xdb, 0x3a, 0xb5, 0x19, 0x01, 0xc3, 0x28, 0xe9, 0x0e, 0x00,
+   0xa3, 0x13, 0xbf, 0x09, 0x03, 0x89, 0x12, 0xdd, 0x0b, 0x00, 0xcb, 0x10,
+   0x87, 0x0e, 0x00, 0xbd, 0x1b, 0x8b, 0x25, 0x00, 0xf1, 0x0a, 0xc1, 0x16,
+   0x01, 0x9b, 0x09, 0xc5, 0x18, 0x01, 0xd7, 0x0d, 0xcd, 0x34, 0x00, 0xc3,
+   0x05, 0xe3, 0x37, 0x00, 0xd2, 0x0b, 0x9d, 0x7a, 0x03, 0x96, 0x19, 0xe7,
+   0x7b, 0x00, 0x86, 0x25, 0xfd, 0x5f, 0x00, 0xae, 0x0b, 0xc7, 0x22, 0x00,
+   0xb4, 0x14, 0xad, 0x7b, 0x00, 0xc4, 0x04, 0xf3, 0x28, 0x01, 0xb4, 0x08,
+   0xed, 0x63, 0x00, 0x8b, 0x01, 0xd7, 0x1b, 0x01, 0xe9, 0x0b, 0xc9, 0x31,
+   0x01, 0xef, 0x0a, 0x99, 0x16, 0x00, 0xb1, 0x0d, 0xef, 0x14, 0x00, 0xd5,
+   0x1d, 0xef, 0x26, 0x01, 0x8d, 0x3d, 0xbf, 0x4d, 0x01, 0xe1, 0x0b, 0xfd,
+   0x15, 0x00, 0xf9, 0x0f, 0xcb, 0x32, 0x01, 0xf9, 0x03, 0xf9, 0x1b, 0x00,
+   0xbb, 0x01, 0xf3, 0x1c, 0x01, 0x6d, 0xdd, 0x1c, 0x00, 0xf7, 0x08, 0xa1,
+   0x53, 0x01, 0xa5, 0x07, 0xd3, 0x19, 0x00, 0x95, 0x0a, 0x97, 0x17, 0x01,
+   0x95, 0x1b, 0x95, 0x28, 0x00, 0xcf, 0x20, 0xbf, 0x24, 0x01, 0xb1, 0x3e,
+   0xbb, 0x49, 0x00, 0xdb, 0x2c, 0xc5, 0x36, 0x00, 0xdb, 0x2e, 0xcf, 0x3c,
+   0x05, 0xdd, 0x24, 0xf7, 0x4e, 0x03, 0x8d, 0x0c, 0xb9, 0x3c, 0x01, 0x95,
+   0x03, 0xf3, 0x3c, 0x01, 0xea, 0x03, 0x8f, 0x36, 0x01, 0xaa, 0x07, 0xaf,
+   0x2c, 0x01, 0xba, 0x07, 0xc3, 0x27, 0x03, 0xc0, 0x07, 0xd1, 0x21, 0x00,
+   0xb6, 0x05, 0xdd, 0x22, 0x03, 0x98, 0x03, 0xe3, 0x2a, 0x03, 0xee, 0x03,
+   0xaf, 0x13, 0x00, 0xdc, 0x01, 0xdb, 0x03, 0x00, 0xec, 0x02, 0xdb, 0x12,
+   0x00, 0x8c, 0x08, 0xa5, 0x2b, 0x00, 0xc8, 0x17, 0xdd, 0x43, 0x02, 0xfe,
+   0x10, 0xd7, 0x1b, 0x02, 0x82, 0x12, 0xd5, 0x11, 0x00, 0x82, 0x09, 0x97,
+   0x06, 0x02, 0xa2, 0x08, 0xc3, 0x06, 0x00, 0xcc, 0x20, 0xbb, 0x1e, 0x03,
+   0x1b, 0x16, 0x01, 0x86, 0x01, 0xd7, 0x04, 0x01, 0xa2, 0x07, 0xf9, 0x08,
+   0x01, 0xf0, 0x0a, 0xe7, 0x0a, 0x00, 0xfc, 0x0c, 0xcb, 0x0a, 0x03, 0xa6,
+   0x08, 0xef, 0x07, 0x00, 0x9a, 0x03, 0xcb, 0x05, 0x03, 0xb4, 0x04, 0x9f,
+   0x06, 0x01, 0xa6, 0x05, 0xed, 0x0a, 0x00, 0x98, 0x01, 0x21, 0x00, 0x05,
+   0x98, 0x0a, 0x03, 0x5b, 0xd6, 0x05, 0x00, 0xfc, 0x01, 0xe9, 0x08, 0x00,
+   0xd0, 0x02, 0xf5, 0x07, 0x00, 0x20, 0x85, 0x01, 0x00, 0xd4, 0x03, 0x95,
+   0x0b, 0x01, 0xff, 0x07, 0xc3, 0x22, 0x00, 0xd1, 0x30, 0xdd, 0x64, 0x00,
+   0xd3, 0x14, 0xb5, 0x2c, 0x00, 0xe5, 0x08, 0x95, 0x19, 0x01, 0x99, 0x0a,
+   0xc9, 0x38, 0x00, 0x6f, 0xd1, 0x3b, 0x01, 0xfc, 0x02, 0xe3, 0x1c, 0x01,
+   0x86, 0x05, 0xd3, 0x1b, 0x00, 0xb4, 0x0d, 0xdf, 0x2d, 0x00, 0xc0, 0x06,
+   0xdf, 0x0f, 0x01, 0x92, 0x06, 0xdd, 0x0b, 0x00, 0xb6, 0x09, 0xd7, 0x0d,
+   0x00, 0xda, 0x05, 0x8b, 0x05, 0x03, 0x04, 0x34, 0x01, 0xea, 0x07, 0xad,
+   0x0c, 0x00, 0xc6, 0x15, 0xd5, 0x15, 0x00, 0xa6, 0x41, 0xa1, 0x26, 0x00,
+   0xdc, 0x4e, 0xe7, 0x1e, 0x02, 0xb6, 0x16, 0x87, 0x0f, 0x00, 0x96, 0x26,
+   0xe9, 0x2a, 0x01, 0xb6, 0x18, 0xf5, 0x36, 0x01, 0x82, 0x0b, 0x8b, 0x3b,
+   0x03, 0x53, 0xad, 0x35, 0x01, 0xf5, 0x0d, 0xbb, 0x51, 0x01, 0xed, 0x0a,
+   0xc3, 0x38, 0x03, 0xc7, 0x0e, 0x97, 0x4d, 0x01, 0xad, 0x08, 0xf5, 0x25,
+   0x03, 0xa7, 0x07, 0xcf, 0x1b, 0x00, 0xc3, 0x05, 0xbd, 0x12, 0x03, 0x93,
+   0x03, 0xa7, 0x0f, 0x00, 0xf2, 0x02, 0xe5, 0x06, 0x01, 0xb0, 0x2f, 0x80,
+   0x01, 0x03, 0x84, 0x59, 0x96, 0x0c, 0x01, 0xba, 0x2f, 0xde, 0x0f, 0x00,
+   0xb2, 0x2a, 0xe4, 0x25, 0x01, 0xc2, 0x20, 0xd2, 0x3b, 0x03, 0xf8, 0x21,
+   0xda, 0x7d, 0x00, 0xa6, 0x20, 0xb6, 0x66, 0x01, 0xe4, 0x0e, 0xf2, 0x3a,
+   0x00, 0x86, 0x0a, 0x80, 0x69, 0x00, 0xac, 0x0c, 0x94, 0x46, 0x00, 0x96,
+   0x11, 0xbc, 0x4d, 0x03, 0xd6, 0x15, 0xb8, 0x1c, 0x00, 0xe6, 0x1f, 0xc2,
+   0x07, 0x03, 0xac, 0x1f, 0x83, 0x02, 0x03, 0x92, 0x0b, 0xdc, 0x03, 0x00,
+   0xce, 0x09, 0xf2, 0x15, 0x00, 0xc8, 0x03, 0xe0, 0x0d, 0x03, 0xd6, 0x0c,
+   0x8f, 0x08, 0x01, 0xee, 0x2e, 0x93, 0x4b, 0x00, 0x84, 0x0e, 0xa5, 0x0f,
+   0x00, 0xae, 0x1d, 0xc3, 0x1a, 0x00, 0xa4, 0x50, 0xd1, 0x2d, 0x00, 0xfe,
+   0x0e, 0xa5, 0x04, 0x02, 0xb8, 0x0d, 0x91, 0x01, 0x00, 0x9a, 0x0d, 0xa0,
+   0x04, 0x00, 0xdc, 0x17, 0xc4, 0x13, 0x00, 0xf6, 0x19, 0xf8, 0x1b, 0x04,
+   0xb4, 0x26, 0xd2, 0x10, 0x00, 0x94, 0x29, 0xdd, 0x06, 0x02, 0x90, 0x1c,
+   0xff, 0x0b, 0x04, 0xac, 0x16, 0xf5, 0x0a, 0x02, 0xf6, 0x0f, 0xa7, 0x08,
+   0x01, 0xb6, 0x0b, 0x8b, 0x0a, 0x00, 0xd8, 0x07, 0x99, 0x03, 0x00, 0xae,
+   0x08, 0xa5, 0x03, 0x01, 0xf2, 0x0f, 0xf9, 0x0b, 0x00, 0xd6, 0x1d, 0xe3,
+   0x17, 0x03, 0xca, 0x22, 0xeb, 0x1c, 0x00, 0x9a, 0x16, 0xe9, 0x17, 0x01,
+   0xa2, 0x24, 0xc5, 0x22, 0x01, 0xac, 0x1b, 0xf3, 0x13, 0x00, 0xde, 0x2b,
+   0xa5, 0x17, 0x05, 0xfe, 0x1e, 0xa9, 0x12, 0x00, 0xaa, 0x1c, 0xc5, 0x11,
+   0x03, 0x8c, 0x1d, 0xd5, 0x0d, 0x00, 0xd0, 0x1d, 0x8f, 0x09, 0x07, 0xd8,
+   0x1b, 0xed, 0x07, 0x03, 0xa2, 0x1b, 0xef, 0x03, 0x01, 0xc6, 0x1d, 0xa2,
+   0x04, 0x00, 0xb0, 0x10, 0x26, 0x00, 0xac, 0x20, 0x89, 0x03, 0x09, 0xd2,
+   0x1f, 0xe1, 0x06, 0x01, 0xc6, 0x10, 0xb7, 0x05, 0x01, 0xaa, 0x20, 0x85,
+   0x0b, 0x00, 0x80, 0x1d, 0xdd, 0x09, 0x07, 0xca, 0x26, 0x99, 0x0e, 0x00,
+   0xde, 0x1d, 0xfd, 0x08, 0x03, 0x9e, 0x11, 0xf4, 0x01, 0x00, 0x35, 0xe2,
+   0x04, 0x03, 0xb0, 0x09, 0xdc, 0x0f, 0x00, 0xde, 0x0f, 0xa6, 0x14, 0x00,
+   0x96, 0x08, 0x8a, 0x0b, 0x01, 0xa0, 0x0a, 0xc8, 0x09, 0x00, 0xd2, 0x4c,
+   0xe4, 0x25, 0x01, 0x9e, 0x10, 0xd0, 0x07, 0x00, 0x8c, 0x10, 0xb8, 0x08,
+   0x05, 0xc8, 0x0f, 0xda, 0x08, 0x03, 0xaa, 0x0f, 0xa0, 0x07, 0x01, 0xa0,
+   0x20, 0xaa, 0x0e, 0x01, 0xa8, 0x0f, 0xe2, 0x06, 0x03, 0xc0, 0x0e, 0xbc,
+   0x07, 0x01, 0xd2, 0x0d, 0x9a, 0x09, 0x03, 0xa4, 0x0d, 0xde, 0x09, 0x01,
+   0x82, 0x0d, 0x9a, 0x0a, 0x01, 0xe8, 0x0b, 0xb4, 0x0b, 0x01, 0xa6, 0x0a,
+   0xba, 0x0c, 0x01, 0xe2, 0x09, 0x94, 0x0d, 0x01, 0x8e, 0x0c, 0xbe, 0x0b,
+   0x00, 0x88, 0x23, 0xd2, 0x12, 0x00, 0x8a, 0x14, 0xd2, 0x08, 0x00, 0xec,
+   0x14, 0xf4, 0x08, 0x09, 0x8c, 0x2a, 0xc6, 0x11, 0x03, 0xb2, 0x29, 0xf8,
+   0x0a, 0x00, 0xb8, 0x14, 0xf8, 0x02, 0x05, 0xea, 0x28, 0xa0, 0x03, 0x00,
+   0xa2, 0x13, 0xcc, 0x03, 0x05, 0xfa, 0x11, 0xea, 0x04, 0x01, 0xdc, 0x11,
+   0xda, 0x03, 0x01, 0xf8, 0x10, 0xb8, 0x01, 0x01, 0x8e, 0x20, 0xfa, 0x01,
+   0x00, 0x80, 0x0f, 0xc6, 0x02, 0x07, 0x9e, 0x0e, 0xfe, 0x01, 0x01, 0xda,
+   0x0d, 0xe2, 0x01, 0x03, 0x94, 0x0e, 0xa6, 0x03, 0x00, 0xa8, 0x1e, 0xdc,
+   0x0a, 0x05, 0xc6, 0x0f, 0xf4, 0x06, 0x03, 0xdc, 0x0e, 0xf6, 0x06, 0x01,
+   0x9e, 0x0f, 0x9e, 0x06, 0x03, 0xf8, 0x0f, 0x84, 0x06, 0x00, 0xe2, 0x0f,
+   0xe8, 0x05, 0x07, 0xf4, 0x0d, 0xe0, 0x05, 0x01, 0x94, 0x0d, 0x94, 0x04,
+   0x03, 0xe2, 0x0c, 0x88, 0x05, 0x01, 0xb6, 0x16, 0xfc, 0x0c, 0x01, 0xca,
+   0x16, 0xd2, 0x0a, 0x03, 0xbc, 0x0b, 0x86, 0x04, 0x01, 0xc4, 0x09, 0xec,
+   0x03, 0x00, 0xea, 0x08, 0xc4, 0x03, 0x00, 0xe0, 0x0f, 0xa0, 0x07, 0x07,
+   0xa4, 0x0d, 0x92, 0x06, 0x01, 0x9a, 0x0b, 0xa0, 0x05, 0x01, 0xca, 0x07,
+   0x93, 0x02, 0x00, 0xba, 0x09, 0xcd, 0x08, 0x00, 0xe4, 0x26, 0xbd, 0x2d,
+   0x00, 0xb2, 0x20, 0x8f, 0x0a, 0x00, 0xec, 0x28, 0xac, 0x0d, 0x00, 0x84,
+   0x4c, 0x92, 0x2a, 0x02, 0xaa, 0x49, 0xe4, 0x20, 0x01, 0x9e, 0x2a, 0xa2,
+   0x18, 0x00, 0xdc, 0x25, 0xfa, 0x27, 0x01, 0x86, 0x1f, 0x8e, 0x2c, 0x00,
+   0x80, 0x38, 0xea, 0x49, 0x00, 0xc2, 0x0d, 0xbc, 0x12, 0x00, 0xdd, 0x18,
+   0x9a, 0x23, 0x00, 0x8f, 0x08, 0xed, 0x01, 0x00, 0x87, 0x0d, 0x0b, 0x00,
+   0xd7, 0x0b, 0x88, 0x09, 0x02, 0xdd, 0x0a, 0xba, 0x18, 0x00, 0xfb, 0x06,
+   0xb4, 0x0d, 0x00, 0xbf, 0x08, 0xa6, 0x0d, 0x00, 0xfb, 0x11, 0x86, 0x22,
+   0x02, 0xd1, 0x09, 0xf8, 0x13, 0x04, 0xcb, 0x0a, 0xb2, 0x13, 0x02, 0xed,
+   0x0b, 0x94, 0x12, 0x06, 0xeb, 0x0c, 0x96, 0x10, 0x06, 0xa7, 0x0e, 0x84,
+   0x0f, 0x00, 0x8b, 0x10, 0xac, 0x0f, 0x08, 0xf9, 0x11, 0xe2, 0x10, 0x02,
+   0xa1, 0x13, 0xdc, 0x11, 0x00, 0xf5, 0x13, 0xde, 0x11, 0x08, 0xc1, 0x14,
+   0xa6, 0x0f, 0x02, 0xeb, 0x14, 0xf0, 0x0c, 0x04, 0x9f, 0x2d, 0x8e, 0x1a,
+   0x02, 0xbb, 0x16, 0xea, 0x0f, 0x00, 0xf5, 0x14, 0xd6, 0x10, 0x04, 0xa7,
+   0x25, 0xb2, 0x21, 0x02, 0xa1, 0x26, 0x8e, 0x23, 0x04, 0xdd, 0x14, 0x8c,
+   0x12, 0x02, 0x85, 0x15, 0xfa, 0x12, 0x04, 0x9f, 0x2a, 0xce, 0x26, 0x02,
+   0xc7, 0x2b, 0xfa, 0x27, 0x04, 0x91, 0x2b, 0xc6, 0x27, 0x00, 0xbd, 0x27,
+   0xd4, 0x22, 0x08, 0xb7, 0x11, 0x86, 0x13, 0x02, 0x97, 0x10, 0xba, 0x15,
+   0x00, 0xa7, 0x10, 0xb8, 0x15, 0x04, 0xab, 0x10, 0xf4, 0x12, 0x00, 0xd5,
+   0x12, 0x92, 0x0f, 0x08, 0xbb, 0x12, 0xb6, 0x0c, 0x00, 0x87, 0x11, 0xde,
+   0x0d, 0x04, 0xb9, 0x0f, 0xf2, 0x0f, 0x04, 0x91, 0x0f, 0xb4, 0x11, 0x00,
+   0xa3, 0x0f, 0xf2, 0x12, 0x06, 0xad, 0x10, 0xc4, 0x13, 0x00, 0xad, 0x10,
+   0xc6, 0x13, 0x04, 0xdd, 0x0f, 0xf4, 0x13, 0x00, 0xeb, 0x0f, 0x98, 0x14,
+   0x08, 0xb7, 0x10, 0xd6, 0x14, 0x04, 0x8d, 0x11, 0xf4, 0x13, 0x02, 0xfb,
+   0x12, 0xb0, 0x13, 0x04, 0x85, 0x29, 0xa0, 0x29, 0x04, 0x99, 0x16, 0xe0,
+   0x15, 0x02, 0xd7, 0x16, 0xc8, 0x16, 0x02, 0xe5, 0x16, 0xce, 0x17, 0x02,
+   0xe7, 0x16, 0xa8, 0x18, 0x04, 0xbb, 0x16, 0x8a, 0x18, 0x04, 0x9b, 0x15,
+   0x88, 0x18, 0x04, 0xf1, 0x12, 0xee, 0x18, 0x04, 0x9f, 0x10, 0xe8, 0x1a,
+   0x06, 0xe1, 0x0d, 0xe2, 0x1c, 0x02, 0xa7, 0x0c, 0xb2, 0x1e, 0x04, 0xeb,
+   0x0a, 0xc8, 0x1e, 0x02, 0xfb, 0x13, 0x90, 0x3b, 0x00, 0x9f, 0x14, 0xf2,
+   0x37, 0x04, 0xcf, 0x1c, 0xce, 0x48, 0x00, 0xa9, 0x1b, 0x92, 0x2b, 0x00,
+   0xb9, 0x23, 0xf2, 0x24, 0x08, 0xc3, 0x28, 0x80, 0x23, 0x00, 0xa3, 0x2c,
+   0xa2, 0x24, 0x00, 0xa9, 0x17, 0xdc, 0x12, 0x0a, 0xa7, 0x17, 0xe6, 0x12,
+   0x02, 0xbd, 0x17, 0xf8, 0x12, 0x04, 0xb7, 0x17, 0xb0, 0x12, 0x00, 0xd3,
+   0x15, 0xf2, 0x10, 0x06, 0xfd, 0x13, 0xd6, 0x0e, 0x00, 0xa7, 0x13, 0xc0,
+   0x0c, 0x04, 0xe1, 0x12, 0xca, 0x0a, 0x02, 0xc3, 0x23, 0x8e, 0x12, 0x04,
+   0xe1, 0x12, 0xc8, 0x06, 0x04, 0x85, 0x13, 0xfc, 0x06, 0x00, 0xcb, 0x13,
+   0x86, 0x09, 0x04, 0xd7, 0x12, 0xf4, 0x0c, 0x04, 0xb1, 0x11, 0x8a, 0x10,
+   0x02, 0xcd, 0x1c, 0xf6, 0x1f, 0x02, 0xad, 0x36, 0xba, 0x48, 0x00, 0xf3,
+   0x30, 0x94, 0x4a, 0x00, 0x9f, 0x1d, 0xac, 0x2d, 0x01, 0xd3, 0x3d, 0x8a,
+   0x50, 0x00, 0xc5, 0x1b, 0xe8, 0x10, 0x00, 0x9f, 0x23, 0xb2, 0x0c, 0x04,
+   0xa5, 0x39, 0x88, 0x11, 0x00, 0xd9, 0x14, 0xd2, 0x06, 0x06, 0x97, 0x15,
+   0x82, 0x08, 0x04, 0x8f, 0x15, 0x98, 0x08, 0x02, 0xbb, 0x26, 0xe6, 0x0e,
+   0x04, 0xa7, 0x10, 0xea, 0x0a, 0x04, 0xb7, 0x0e, 0xb4, 0x0a, 0x00, 0xff,
+   0x0a, 0xfe, 0x07, 0x04, 0xd3, 0x06, 0xc0, 0x05, 0x02, 0xe5, 0x04, 0xba,
+   0x05, 0x02, 0xc1, 0x0c, 0xa4, 0x0e, 0x00, 0x83, 0x1e, 0xbc, 0x1b, 0x06,
+   0xa5, 0x13, 0xd8, 0x12, 0x04, 0xe9, 0x15, 0xf6, 0x13, 0x02, 0xad, 0x18,
+   0xb4, 0x14, 0x04, 0xeb, 0x33, 0xf2, 0x2b, 0x04, 0x89, 0x1a, 0xca, 0x18,
+   0x02, 0xd7, 0x19, 0xf4, 0x1b, 0x04, 0xd5, 0x19, 0xc0, 0x1e, 0x04, 0xd9,
+   0x19, 0xda, 0x1f, 0x00, 0xf1, 0x19, 0xdc, 0x1e, 0x08, 0xed, 0x18, 0xda,
+   0x1a, 0x04, 0x8f, 0x18, 0xca, 0x17, 0x02, 0xb3, 0x15, 0xe0, 0x14, 0x04,
+   0xf7, 0x12, 0xea, 0x12, 0x00, 0x8d, 0x12, 0xd0, 0x11, 0x04, 0xa3, 0x11,
+   0xbe, 0x11, 0x02, 0x85, 0x21, 0x9c, 0x23, 0x04, 0xcf, 0x1f, 0xa6, 0x21,
+   0x04, 0xa7, 0x0f, 0xd6, 0x0f, 0x02, 0xab, 0x0e, 0xf6, 0x0d, 0x00, 0x8d,
+   0x0d, 0xca, 0x0c, 0x04, 0xf7, 0x0b, 0xfa, 0x0b, 0x04, 0xc7, 0x0a, 0xd6,
+   0x0a, 0x02, 0xdd, 0x08, 0xca, 0x08, 0x04, 0xaf, 0x06, 0xe8, 0x05, 0x02,
+   0xc1, 0x04, 0x9e, 0x03, 0x02, 0x87, 0x05, 0xee, 0x02, 0x04, 0x25, 0x02,
+   0x00, 0xeb, 0x04, 0x8d, 0x0e, 0x00, 0xc7, 0x06, 0xe1, 0x1c, 0x00, 0x93,
+   0x0b, 0x81, 0x1f, 0x00, 0xeb, 0x23, 0xc5, 0x37, 0x01, 0xd1, 0x0b, 0x85,
+   0x0d, 0x00, 0xa9, 0x19, 0x9f, 0x13, 0x00, 0xd7, 0x0d, 0xc3, 0x06, 0x03,
+   0x81, 0x31, 0x89, 0x12, 0x01, 0x9d, 0x2b, 0xd1, 0x13, 0x00, 0xa3, 0x28,
+   0xa5, 0x21, 0x00, 0x85, 0x1e, 0xb1, 0x2a, 0x00, 0xfb, 0x14, 0xd3, 0x33,
+   0x01, 0x85, 0x0c, 0xdf, 0x3c, 0x00, 0x69, 0x9b, 0x21, 0x01, 0xa4, 0x07,
+   0xb9, 0x66, 0x01, 0xaa, 0x0d, 0x8b, 0x5f, 0x00, 0xa4, 0x21, 0xdd, 0x6b,
+   0x01, 0xb4, 0x26, 0xfd, 0x6d, 0x00, 0x94, 0x10, 0xb7, 0x75, 0x01, 0xec,
+   0x0a, 0xf7, 0x69, 0x00, 0x13, 0xbd, 0x1d, 0x00, 0xab, 0x0d, 0x87, 0x39,
+   0x01, 0xaf, 0x0f, 0xfb, 0x1a, 0x00, 0x85, 0x13, 0x8f, 0x1b, 0x01, 0xff,
+   0x15, 0xe1, 0x1b, 0x00, 0xa9, 0x3a, 0xb1, 0x50, 0x00, 0x9d, 0x0e, 0xb7,
+   0x1b, 0x00, 0xcd, 0x0a, 0xc9, 0x1e, 0x00, 0x87, 0x0b, 0xb1, 0x49, 0x03,
+   0xf7, 0x0c, 0x91, 0x6f, 0x00, 0xa5, 0x16, 0xfd, 0x38, 0x03, 0xfd, 0x25,
+   0xd3, 0x35, 0x00, 0x95, 0x4b, 0x89, 0x56, 0x00, 0x9d, 0x16, 0xaf, 0x1a,
+   0x00, 0x93, 0x38, 0xf9, 0x45, 0x07, 0xab, 0x10, 0x91, 0x19, 0x01, 0xb9,
+   0x0e, 0xfb, 0x1a, 0x01, 0x9d, 0x0c, 0xe1, 0x1c, 0x01, 0xa3, 0x10, 0xc7,
+   0x3f, 0x01, 0x93, 0x03, 0x97, 0x45, 0x01, 0xc0, 0x07, 0xcb, 0x4a, 0x03,
+   0x96, 0x0e, 0xd7, 0x4c, 0x01, 0x80, 0x11, 0xa7, 0x47, 0x01, 0x82, 0x1b,
+   0x91, 0x3e, 0x01, 0xec, 0x24, 0xbd, 0x33, 0x03, 0xa6, 0x15, 0x8f, 0x15,
+   0x01, 0xfa, 0x2b, 0xbd, 0x26, 0x00, 0xe2, 0x12, 0xd7, 0x14, 0x05, 0xd0,
+   0x0f, 0xd5, 0x16, 0x00, 0xa4, 0x0c, 0x93, 0x1a, 0x01, 0xdc, 0x08, 0xfd,
+   0x1c, 0x01, 0x82, 0x05, 0xfd, 0x1e, 0x01, 0x30, 0x9f, 0x1f, 0x00, 0xcb,
+   0x05, 0x81, 0x1f, 0x01, 0xe3, 0x09, 0xe1, 0x1d, 0x00, 0x99, 0x0d, 0xd1,
+   0x1d, 0x00, 0xbd, 0x10, 0xeb, 0x1d, 0x03, 0x97, 0x1f, 0xcf, 0x3a, 0x01,
+   0xa7, 0x17, 0xd5, 0x38, 0x01, 0xf5, 0x05, 0xc3, 0x1f, 0x01, 0x81, 0x02,
+   0xcf, 0x21, 0x00, 0xce, 0x05, 0xcf, 0x44, 0x01, 0xc6, 0x12, 0xf1, 0x40,
+   0x00, 0xec, 0x0d, 0x8b, 0x1d, 0x01, 0xce, 0x10, 0xdf, 0x19, 0x00, 0xb6,
+   0x28, 0xa7, 0x2a, 0x00, 0xa6, 0x35, 0xc3, 0x1d, 0x01, 0xd8, 0x53, 0xdb,
+   0x21, 0x01, 0xe0, 0x2a, 0xb9, 0x25, 0x01, 0xfc, 0x1e, 0xd1, 0x37, 0x01,
+   0xf2, 0x0e, 0xa5, 0x43, 0x03, 0x8b, 0x02, 0xff, 0x4a, 0x01, 0x81, 0x0e,
+   0xa5, 0x54, 0x03, 0x91, 0x15, 0x89, 0x71, 0x00, 0xa3, 0x07, 0xb1, 0x20,
+   0x01, 0x97, 0x08, 0xb3, 0x1e, 0x01, 0x8b, 0x09, 0xd1, 0x1d, 0x03, 0xc1,
+   0x15, 0x89, 0x3c, 0x01, 0x87, 0x20, 0xff, 0x37, 0x03, 0xf3, 0x24, 0x89,
+   0x34, 0x00, 0x8b, 0x41, 0x95, 0x40, 0x03, 0x8d, 0x4e, 0xa1, 0x33, 0x00,
+   0xcf, 0x44, 0xe7, 0x2b, 0x00, 0xf9, 0x42, 0xb7, 0x27, 0x03, 0x9b, 0x17,
+   0xb1, 0x09, 0x00, 0x87, 0x31, 0xb1, 0x0b, 0x01, 0xa1, 0x4c, 0xc7, 0x0f,
+   0x00, 0xf9, 0x18, 0xe3, 0x04, 0x00, 0x83, 0x41, 0xe1, 0x0d, 0x03, 0xa5,
+   0x24, 0xaf, 0x0c, 0x03, 0x83, 0x22, 0xaf, 0x17, 0x01, 0x85, 0x23, 0xed,
+   0x1f, 0x01, 0xa1, 0x23, 0xa9, 0x23, 0x00, 0xc1, 0x0f, 0xe5, 0x14, 0x05,
+   0xa5, 0x0d, 0xe5, 0x18, 0x00, 0xaf, 0x15, 0xc1, 0x3b, 0x01, 0xb5, 0x14,
+   0xb3, 0x3e, 0x03, 0x91, 0x12, 0x83, 0x38, 0x03, 0xab, 0x05, 0x99, 0x1b,
+   0x01, 0xd5, 0x01, 0x9b, 0x1b, 0x01, 0xb4, 0x02, 0xc3, 0x1a, 0x03, 0x8c,
+   0x10, 0x8f, 0x2f, 0x01, 0xe8, 0x1f, 0x81, 0x27, 0x03, 0xf6, 0x11, 0xf9,
+   0x13, 0x03, 0xb6, 0x12, 0xdd, 0x14, 0x00, 0xe4, 0x12, 0xf9, 0x14, 0x03,
+   0xc6, 0x13, 0xf3, 0x12, 0x01, 0xfc, 0x14, 0x99, 0x0e, 0x01, 0xb8, 0x16,
+   0xc5, 0x08, 0x01, 0xde, 0x17, 0x8d, 0x03, 0x01, 0xb8, 0x17, 0xfe, 0x01,
+   0x01, 0xa6, 0x17, 0xe2, 0x07, 0x00, 0x8a, 0x16, 0xa6, 0x0c, 0x05, 0x8e,
+   0x15, 0x96, 0x0c, 0x01, 0x9e, 0x14, 0xec, 0x07, 0x00, 0xf2, 0x12, 0xea,
+   0x01, 0x00, 0x86, 0x12, 0x8b, 0x04, 0x05, 0x9e, 0x10, 0xcf, 0x0a, 0x01,
+   0xf6, 0x10, 0xe5, 0x10, 0x01, 0xe0, 0x0f, 0xe7, 0x13, 0x03, 0xd8, 0x1a,
+   0xff, 0x26, 0x01, 0xe8, 0x0d, 0xed, 0x27, 0x03, 0xa3, 0x06, 0x89, 0x2b,
+   0x03, 0x9b, 0x0b, 0xf9, 0x10, 0x01, 0xc1, 0x10, 0x83, 0x09, 0x01, 0xdb,
+   0x12, 0x78, 0x01, 0x9b, 0x10, 0xf8, 0x08, 0x00, 0xe5, 0x0c, 0xac, 0x11,
+   0x00, 0xfd, 0x09, 0xb4, 0x15, 0x03, 0x81, 0x09, 0x98, 0x14, 0x00, 0xcb,
+   0x0a, 0xcc, 0x10, 0x00, 0xc3, 0x1c, 0x98, 0x0d, 0x03, 0xeb, 0x1e, 0xbd,
+   0x13, 0x00, 0xe7, 0x1c, 0xef, 0x1e, 0x03, 0xe1, 0x1d, 0xb3, 0x10, 0x03,
+   0x8b, 0x22, 0xe7, 0x05, 0x01, 0x95, 0x24, 0x99, 0x03, 0x03, 0xfd, 0x21,
+   0x9d, 0x13, 0x03, 0xa9, 0x1d, 0x99, 0x23, 0x01, 0xd1, 0x1b, 0x8b, 0x27,
+   0x00, 0xdf, 0x0b, 0xff, 0x15, 0x01, 0xf3, 0x08, 0xc1, 0x18, 0x01, 0xe1,
+   0x07, 0x9d, 0x37, 0x00, 0xb8, 0x07, 0xa1, 0x38, 0x00, 0xe6, 0x12, 0xaf,
+   0x33, 0x02, 0xf2, 0x1e, 0xa7, 0x2d, 0x00, 0xe0, 0x3e, 0x89, 0x49, 0x00,
+   0x9a, 0x37, 0xf5, 0x50, 0x00, 0xbc, 0x0d, 0xd1, 0x16, 0x00, 0xe8, 0x0f,
+   0xc7, 0x2c, 0x01, 0xe8, 0x01, 0x8b, 0x31, 0x01, 0xa7, 0x05, 0xe3, 0x32,
+   0x01, 0xb4, 0x01, 0xeb, 0x18, 0x00, 0xb0, 0x02, 0x87, 0x15, 0x03, 0xc2,
+   0x05, 0xd3, 0x10, 0x00, 0x9c, 0x11, 0x81, 0x16, 0x01, 0x8e, 0x35, 0xd7,
+   0x16, 0x00, 0xee, 0x11, 0xdd, 0x12, 0x00, 0xda, 0x0f, 0xeb, 0x20, 0x01,
+   0x28, 0x83, 0x01, 0x00, 0x81, 0x02, 0xbd, 0x09, 0x00, 0xdd, 0x05, 0xe5,
+   0x18, 0x00, 0xb9, 0x09, 0x8b, 0x22, 0x00, 0xb1, 0x1b, 0xb9, 0x60, 0x00,
+   0xb1, 0x0a, 0xab, 0x19, 0x00, 0xeb, 0x1d, 0xb9, 0x2a, 0x00, 0xcb, 0x1d,
+   0x9f, 0x2f, 0x00, 0x87, 0x15, 0xff, 0x3d, 0x01, 0xd1, 0x0e, 0xb1, 0x42,
+   0x01, 0xab, 0x0b, 0x85, 0x39, 0x01, 0xcb, 0x04, 0xeb, 0x17, 0x01, 0xa7,
+   0x03, 0xc5, 0x14, 0x00, 0xbb, 0x01, 0xa3, 0x11, 0x01, 0xc0, 0x0a, 0xfb,
+   0x18, 0x01, 0x94, 0x08, 0xf2, 0x02, 0x01, 0xea, 0x0b, 0xe6, 0x25, 0x00,
+   0xfa, 0x18, 0xca, 0x2f, 0x02, 0xe4, 0x11, 0x90, 0x15, 0x00, 0xca, 0x2f,
+   0x8e, 0x2c, 0x04, 0x9e, 0x34, 0xe4, 0x2d, 0x06, 0xce, 0x1c, 0xf4, 0x11,
+   0x04, 0x98, 0x1d, 0x92, 0x0f, 0x04, 0xc0, 0x1f, 0xfc, 0x0d, 0x04, 0xea,
+   0x20, 0xc8, 0x0d, 0x04, 0x88, 0x20, 0xac, 0x0d, 0x04, 0xae, 0x1c, 0xb6,
+   0x0d, 0x04, 0x80, 0x17, 0xa6, 0x0f, 0x02, 0xca, 0x14, 0xae, 0x13, 0x04,
+   0xa0, 0x13, 0xc4, 0x18, 0x00, 0x84, 0x11, 0xc2, 0x1d, 0x08, 0xea, 0x10,
+   0x9e, 0x1f, 0x02, 0xd0, 0x0f, 0x92, 0x1c, 0x04, 0xb0, 0x10, 0xfe, 0x14,
+   0x02, 0xba, 0x11, 0xc8, 0x0e, 0x04, 0xc8, 0x10, 0xe0, 0x09, 0x04, 0x80,
+   0x13, 0xa0, 0x05, 0x02, 0x86, 0x18, 0x2f, 0x02, 0xb6, 0x19, 0xa3, 0x06,
+   0x00, 0xa6, 0x1a, 0x9f, 0x0c, 0x00, 0xd0, 0x37, 0xa3, 0x21, 0x08, 0xa6,
+   0x3d, 0xe1, 0x25, 0x00, 0x8e, 0x20, 0xad, 0x13, 0x04, 0xa0, 0x20, 0xcf,
+   0x12, 0x04, 0xb2, 0x1f, 0xc5, 0x11, 0x02, 0xa4, 0x1c, 0xfb, 0x0f, 0x02,
+   0x96, 0x2f, 0xb3, 0x19, 0x04, 0xc6, 0x20, 0xd5, 0x12, 0x04, 0x82, 0x12,
+   0x9b, 0x0a, 0x02, 0xbc, 0x07, 0xbb, 0x0a, 0x02, 0xcf, 0x01, 0xe5, 0x0c,
+   0x00, 0xdf, 0x05, 0xdb, 0x08, 0x00, 0x9b, 0x0b, 0xef, 0x08, 0x00, 0xe7,
+   0x29, 0x93, 0x10, 0x02, 0xd5, 0x38, 0xdb, 0x03, 0x02, 0xfb, 0x3d, 0x7e,
+   0x04, 0xb7, 0x1e, 0xed, 0x01, 0x02, 0x99, 0x1c, 0x8b, 0x05, 0x02, 0x9d,
+   0x1b, 0x8f, 0x08, 0x02, 0xad, 0x39, 0x97, 0x18, 0x02, 0xef, 0x1e, 0xe5,
+   0x0f, 0x00, 0xa7, 0x1f, 0xf5, 0x0f, 0x06, 0xef, 0x1d, 0xa1, 0x10, 0x02,
+   0xd5, 0x33, 0x83, 0x26, 0x02, 0xb9, 0x2b, 0xfb, 0x30, 0x02, 0xff, 0x13,
+   0xc3, 0x1d, 0x02, 0xf9, 0x27, 0xe7, 0x45, 0x02, 0xc1, 0x16, 0xb3, 0x22,
+   0x00, 0x97, 0x32, 0xef, 0x39, 0x02, 0xa5, 0x2d, 0xa3, 0x2a, 0x02, 0xdb,
+   0x36, 0x85, 0x29, 0x02, 0x95, 0x0d, 0xe7, 0x10, 0x02, 0xeb, 0x08, 0xa7,
+   0x15, 0x00, 0xd5, 0x03, 0xc3, 0x34, 0x02, 0xb4, 0x07, 0xbf, 0x19, 0x00,
+   0xea, 0x0d, 0xe7, 0x14, 0x00, 0xc2, 0x27, 0xcb, 0x1d, 0x02, 0xe2, 0x4a,
+   0xd9, 0x33, 0x02, 0x80, 0x24, 0xff, 0x3a, 0x02, 0x9c, 0x0f, 0x9f, 0x1f,
+   0x02, 0xd2, 0x11, 0xcb, 0x19, 0x00, 0xc2, 0x10, 0xf1, 0x15, 0x02, 0x98,
+   0x3a, 0x81, 0x40, 0x02, 0xe4, 0x0a, 0x93, 0x0e, 0x01, 0x80, 0x0a, 0x8b,
+   0x1a, 0x00, 0xd4, 0x07, 0x89, 0x0f, 0x01, 0xa6, 0x0d, 0x92, 0x09, 0x00,
+   0xfe, 0x04, 0xc2, 0x0b, 0x00, 0xee, 0x22, 0xca, 0x5c, 0x00, 0xa0, 0x0c,
+   0x9a, 0x12, 0x02, 0xee, 0x10, 0xc8, 0x11, 0x02, 0xd4, 0x13, 0xa4, 0x10,
+   0x00, 0xf4, 0x12, 0xfe, 0x0e, 0x02, 0x94, 0x11, 0xb8, 0x0d, 0x04, 0xfe,
+   0x0d, 0x80, 0x0b, 0x02, 0xd4, 0x0b, 0xc6, 0x08, 0x00, 0x90, 0x0a, 0xca,
+   0x05, 0x06, 0xf2, 0x12, 0x9c, 0x05, 0x02, 0xe8, 0x09, 0xd0, 0x03, 0x00,
+   0xde, 0x1f, 0x8a, 0x0e, 0x04, 0xdc, 0x10, 0xb0, 0x06, 0x00, 0xba, 0x37,
+   0x90, 0x27, 0x00, 0xf6, 0x0b, 0x92, 0x1a, 0x01, 0xda, 0x05, 0x8a, 0x1d,
+   0x00, 0x80, 0x06, 0xd4, 0x0f, 0x01, 0xfc, 0x08, 0x80, 0x10, 0x00, 0xae,
+   0x16, 0xf8, 0x1c, 0x00, 0xd2, 0x29, 0xbe, 0x23, 0x00, 0xc6, 0x2d, 0xe0,
+   0x17, 0x00, 0x90, 0x1f, 0xce, 0x0d, 0x00, 0xd8, 0x11, 0xa6, 0x03, 0x07,
+   0xca, 0x11, 0x38, 0x01, 0x8a, 0x21, 0xe7, 0x04, 0x01, 0xfa, 0x1d, 0xe1,
+   0x0f, 0x01, 0xa6, 0x1b, 0x8f, 0x12, 0x01, 0x84, 0x28, 0xb3, 0x17, 0x01,
+   0xce, 0x17, 0xf9, 0x0a, 0x00, 0xee, 0x10, 0xb5, 0x07, 0x03, 0xd8, 0x0c,
+   0x81, 0x04, 0x03, 0x9a, 0x0b, 0xd3, 0x03, 0x01, 0xfa, 0x0b, 0x93, 0x07,
+   0x01, 0xa2, 0x06, 0xad, 0x01, 0x03, 0xfa, 0x06, 0xad, 0x01, 0x01, 0xe8,
+   0x06, 0xb5, 0x02, 0x01, 0x90, 0x06, 0x99, 0x01, 0x01, 0x80, 0x07, 0xcc,
+   0x01, 0x01, 0xd4, 0x0d, 0xfa, 0x07, 0x01, 0x86, 0x07, 0xf2, 0x02, 0x03,
+   0xa0, 0x08, 0xfe, 0x01, 0x01, 0xb8, 0x07, 0xf8, 0x01, 0x01, 0xf0, 0x12,
+   0x80, 0x05, 0x01, 0x90, 0x09, 0x94, 0x03, 0x01, 0xb6, 0x0c, 0x94, 0x03,
+   0x00, 0xd6, 0x16, 0x94, 0x06, 0x05, 0xc2, 0x0d, 0xd4, 0x03, 0x01, 0xb0,
+   0x0e, 0xfc, 0x04, 0x01, 0xf0, 0x18, 0xfe, 0x0e, 0x01, 0xb8, 0x17, 0xb6,
+   0x0e, 0x03, 0xc8, 0x17, 0xa0, 0x0c, 0x00, 0xb8, 0x17, 0xac, 0x0a, 0x07,
+   0xde, 0x0b, 0xe2, 0x04, 0x01, 0xb0, 0x0b, 0xcc, 0x04, 0x00, 0xf0, 0x16,
+   0x92, 0x0a, 0x05, 0x8a, 0x17, 0xe4, 0x0b, 0x03, 0x92, 0x0c, 0x9a, 0x06,
+   0x01, 0xda, 0x0b, 0xb6, 0x06, 0x01, 0xf2, 0x0a, 0xd4, 0x04, 0x01, 0xf6,
+   0x0a, 0xc4, 0x02, 0x01, 0xf4, 0x15, 0xc4, 0x06, 0x00, 0xb0, 0x19, 0xa2,
+   0x08, 0x03, 0xa2, 0x0d, 0xa2, 0x06, 0x01, 0x8a, 0x0d, 0xda, 0x08, 0x00,
+   0xf2, 0x0b, 0xc4, 0x0a, 0x01, 0x88, 0x16, 0x94, 0x16, 0x01, 0x9a, 0x0b,
+   0xc6, 0x09, 0x00, 0xb4, 0x26, 0xb6, 0x16, 0x01, 0x90, 0x37, 0x88, 0x21,
+   0x00, 0xa2, 0x3b, 0xfc, 0x21, 0x03, 0x9e, 0x21, 0x8a, 0x0f, 0x01, 0xae,
+   0x0e, 0xb1, 0x1c, 0x00, 0x80, 0x0d, 0xdd, 0x21, 0x01, 0xd9, 0x02, 0xa1,
+   0x1b, 0x00, 0xc1, 0x08, 0xe5, 0x12, 0x00, 0xed, 0x05, 0x9b, 0x19, 0x01,
+   0xdf, 0x02, 0xbf, 0x0d, 0x00, 0x8f, 0x06, 0xaf, 0x1c, 0x00, 0x91, 0x0d,
+   0xaf, 0x51, 0x00, 0xd7, 0x09, 0xfb, 0x37, 0x07, 0xd2, 0x02, 0xd7, 0x16,
+   0x00, 0xfa, 0x01, 0x85, 0x24, 0x00, 0xcf, 0x09, 0xcb, 0x14, 0x04, 0xa3,
+   0x15, 0x95, 0x20, 0x02, 0x8a, 0x03, 0x8d, 0x5d, 0x00, 0x16, 0x83, 0x2c,
+   0x03, 0xc6, 0x04, 0xc7, 0x48, 0x01, 0xee, 0x01, 0xa1, 0x11, 0x00, 0xc4,
+   0x04, 0xf3, 0x1e, 0x00, 0xe4, 0x05, 0x87, 0x23, 0x03, 0xe0, 0x01, 0xb5,
+   0x11, 0x03, 0xce, 0x02, 0x99, 0x12, 0x01, 0x5a, 0xcd, 0x1f, 0x01, 0xae,
+   0x01, 0xfd, 0x12, 0x01, 0x50, 0xd7, 0x0a, 0x00, 0x33, 0xfb, 0x0b, 0x00,
+   0x70, 0xd3, 0x0a, 0x03, 0xde, 0x06, 0xb7, 0x20, 0x01, 0x92, 0x0b, 0xcd,
+   0x29, 0x00, 0xf0, 0x1e, 0xe7, 0x68, 0x00, 0xe6, 0x02, 0xe7, 0x0c, 0x04,
+   0xba, 0x06, 0xed, 0x18, 0x02, 0x9e, 0x07, 0xc5, 0x1e, 0x04, 0xe2, 0x08,
+   0xf3, 0x19, 0x02, 0xba, 0x05, 0xff, 0x1d, 0x00, 0x7c, 0xb3, 0x1a, 0x00,
+   0x67, 0xb1, 0x1a, 0x04, 0xe4, 0x03, 0x87, 0x1f, 0x00, 0xb8, 0x0f, 0xc9,
+   0x46, 0x04, 0x84, 0x0b, 0xe7, 0x2d, 0x00, 0xfa, 0x09, 0x99, 0x23, 0x00,
+   0xf2, 0x02, 0xd9, 0x2b, 0x01, 0x8c, 0x03, 0xf7, 0x25, 0x00, 0x99, 0x03,
+   0xb5, 0x3e, 0x03, 0x8b, 0x03, 0xc3, 0x46, 0x01, 0x91, 0x03, 0xed, 0x2c,
+   0x00, 0xa1, 0x01, 0xc3, 0x1e, 0x03, 0xac, 0x02, 0xa5, 0x07, 0x00, 0xc4,
+   0x05, 0x8b, 0x04, 0x03, 0xe0, 0x10, 0x93, 0x03, 0x01, 0xac, 0x05, 0x9f,
+   0x0c, 0x00, 0x5d, 0xc1, 0x1e, 0x00, 0x94, 0x04, 0xf7, 0x26, 0x00, 0xd0,
+   0x05, 0xd7, 0x27, 0x00, 0xd8, 0x02, 0xc1, 0x25, 0x05, 0x62, 0xff, 0x13,
+   0x00, 0x51, 0x93, 0x15, 0x01, 0x99, 0x07, 0xc1, 0x47, 0x03, 0xf9, 0x12,
+   0x99, 0x5f, 0x00, 0xa7, 0x2e, 0x87, 0x63, 0x00, 0xa5, 0x2a, 0xd9, 0x50,
+   0x00, 0xc7, 0x0f, 0xf7, 0x21, 0x00, 0x94, 0x01, 0xb3, 0x24, 0x02, 0xe4,
+   0x29, 0xa5, 0x72, 0x00, 0xee, 0x09, 0xa1, 0x1d, 0x02, 0xcc, 0x1f, 0x9b,
+   0x6f, 0x00, 0xc0, 0x13, 0x89, 0x4f, 0x03, 0xd4, 0x0b, 0xa3, 0x33, 0x01,
+   0xed, 0x02, 0xbd, 0x35, 0x00, 0xc9, 0x26, 0xad, 0x03, 0x02, 0x9f, 0x1d,
+   0x9d, 0x17, 0x04, 0xcf, 0x0f, 0xab, 0x14, 0x04, 0xb3, 0x13, 0xbf, 0x15,
+   0x00, 0xa7, 0x16, 0x8f, 0x16, 0x04, 0xb3, 0x34, 0xad, 0x28, 0x04, 0xb1,
+   0x1d, 0xcb, 0x10, 0x02, 0xf9, 0x38, 0xab, 0x1c, 0x04, 0x83, 0x32, 0xef,
+   0x1a, 0x02, 0xfb, 0x28, 0xa1, 0x18, 0x04, 0x99, 0x11, 0xcb, 0x0d, 0x00,
+   0xfb, 0x26, 0xd7, 0x29, 0x00, 0xd3, 0x09, 0x89, 0x22, 0x00, 0x4a, 0xff,
+   0x0f, 0x02, 0x86, 0x05, 0xcd, 0x23, 0x02, 0xdd, 0x06, 0xc5, 0x05, 0x00,
+   0xdd, 0x10, 0x8a, 0x06, 0x02, 0xb5, 0x0a, 0x8e, 0x02, 0x00, 0xc1, 0x0b,
+   0x29, 0x00, 0xc7, 0x1f, 0xd3, 0x03, 0x06, 0xbd, 0x26, 0xc3, 0x04, 0x04,
+   0xdb, 0x14, 0xfb, 0x05, 0x02, 0xf7, 0x14, 0xb5, 0x06, 0x04, 0x95, 0x15,
+   0xf3, 0x03, 0x02, 0xc5, 0x15, 0xf3, 0x01, 0x00, 0xc5, 0x14, 0xdf, 0x01,
+   0x00, 0xcb, 0x25, 0x0a, 0x0a, 0xfd, 0x23, 0xca, 0x05, 0x04, 0xe5, 0x11,
+   0xe4, 0x01, 0x02, 0xc5, 0x11, 0xf9, 0x01, 0x00, 0xd3, 0x11, 0xf1, 0x05,
+   0x00, 0x8d, 0x24, 0xaf, 0x0d, 0x04, 0x91, 0x28, 0xe5, 0x02, 0x04, 0xef,
+   0x26, 0xce, 0x07, 0x04, 0xe7, 0x1e, 0xcc, 0x06, 0x00, 0xe9, 0x0a, 0xad,
+   0x01, 0x06, 0xa9, 0x0a, 0x60, 0x00, 0xc9, 0x0a, 0xa8, 0x02, 0x06, 0x95,
+   0x0a, 0x1d, 0x02, 0x8b, 0x0a, 0xdb, 0x01, 0x00, 0xa3, 0x09, 0x52, 0x02,
+   0x91, 0x09, 0xbc, 0x03, 0x00, 0xb1, 0x09, 0x8a, 0x04, 0x00, 0xc7, 0x09,
+   0xe4, 0x04, 0x04, 0xf5, 0x09, 0xb8, 0x04, 0x02, 0xcd, 0x0a, 0x84, 0x03,
+   0x02, 0xef, 0x15, 0x84, 0x04, 0x02, 0xb3, 0x15, 0xd4, 0x06, 0x02, 0xc1,
+   0x15, 0xdc, 0x06, 0x00, 0x8b, 0x0c, 0xf2, 0x04, 0x06, 0x85, 0x0c, 0xf8,
+   0x07, 0x02, 0xe5, 0x17, 0x86, 0x12, 0x04, 0x89, 0x0c, 0xdc, 0x05, 0x02,
+   0xcf, 0x0b, 0xd2, 0x02, 0x02, 0x9f, 0x0a, 0xc8, 0x02, 0x00, 0xf5, 0x08,
+   0xa0, 0x04, 0x02, 0xe3, 0x08, 0xe8, 0x04, 0x00, 0xa5, 0x08, 0xec, 0x03,
+   0x00, 0xa1, 0x07, 0xee, 0x02, 0x06, 0xb7, 0x0e, 0x82, 0x01, 0x04, 0x87,
+   0x08, 0x04, 0x00, 0xe7, 0x09, 0xb2, 0x04, 0x02, 0x95, 0x29, 0xda, 0x13,
+   0x00, 0xc3, 0x22, 0xee, 0x04, 0x04, 0x97, 0x22, 0xf4, 0x11, 0x04, 0x93,
+   0x1b, 0xa2, 0x0e, 0x00, 0x9b, 0x15, 0xbc, 0x07, 0x00, 0xa5, 0x0e, 0xd4,
+   0x12, 0x00, 0xe1, 0x17, 0x86, 0x22, 0x00, 0x87, 0x13, 0xbe, 0x16, 0x01,
+   0xed, 0x1f, 0xb0, 0x0f, 0x00, 0x91, 0x44, 0x9e, 0x08, 0x03, 0xb3, 0x34,
+   0xc5, 0x03, 0x01, 0x93, 0x3d, 0x97, 0x04, 0x01, 0xe3, 0x1c, 0xb2, 0x0c,
+   0x02, 0xa1, 0x27, 0xba, 0x16, 0x02, 0xbf, 0x1f, 0xf2, 0x14, 0x02, 0x83,
+   0x0a, 0xdc, 0x06, 0x00, 0xaf, 0x09, 0xea, 0x06, 0x04, 0xc9, 0x15, 0xcc,
+   0x0c, 0x00, 0xeb, 0x1d, 0xfe, 0x0f, 0x00, 0xe3, 0x20, 0xbc, 0x11, 0x08,
+   0xc5, 0x31, 0xe0, 0x1c, 0x04, 0xf3, 0x0a, 0xaa, 0x08, 0x00, 0xd1, 0x0a,
+   0xbc, 0x09, 0x00, 0xef, 0x14, 0xa8, 0x15, 0x00, 0xd3, 0x17, 0xde, 0x13,
+   0x08, 0x9d, 0x18, 0x82, 0x12, 0x02, 0xf5, 0x16, 0xfc, 0x10, 0x04, 0x9f,
+   0x10, 0xf2, 0x0d, 0x00, 0xa7, 0x08, 0xb6, 0x12, 0x02, 0xcd, 0x21, 0xc9,
+   0x09, 0x00, 0xdd, 0x1b, 0xee, 0x03, 0x00, 0xa5, 0x12, 0xf2, 0x07, 0x04,
+   0xc3, 0x21, 0xa4, 0x0f, 0x00, 0xf3, 0x0d, 0xfc, 0x0b, 0x06, 0xe9, 0x0d,
+   0xd6, 0x0c, 0x04, 0xaf, 0x0f, 0xee, 0x08, 0x02, 0xef, 0x11, 0xea, 0x05,
+   0x02, 0x91, 0x14, 0xd0, 0x05, 0x00, 0xc1, 0x14, 0xd4, 0x03, 0x08, 0x9b,
+   0x14, 0x86, 0x02, 0x00, 0xdd, 0x12, 0x1c, 0x04, 0xd7, 0x0f, 0x97, 0x01,
+   0x04, 0xa3, 0x0d, 0x87, 0x01, 0x02, 0x9f, 0x14, 0x8b, 0x03, 0x02, 0xe9,
+   0x4b, 0x9d, 0x09, 0x00, 0xb5, 0x0c, 0xcb, 0x02, 0x00, 0xab, 0x1d, 0x8d,
+   0x09, 0x02, 0xb5, 0x13, 0x97, 0x04, 0x00, 0xe7, 0x14, 0xc7, 0x04, 0x00,
+   0xad, 0x27, 0xad, 0x07, 0x08, 0xd9, 0x11, 0x8b, 0x08, 0x02, 0xb7, 0x0f,
+   0xef, 0x07, 0x02, 0xe9, 0x0e, 0xcf, 0x05, 0x02, 0x9b, 0x0f, 0xf3, 0x01,
+   0x02, 0xcd, 0x0e, 0xa2, 0x01, 0x02, 0xcd, 0x0e, 0x3d, 0x02, 0x9f, 0x0e,
+   0x89, 0x01, 0x00, 0xab, 0x0e, 0xaf, 0x01, 0x04, 0xc7, 0x0d, 0xf3, 0x05,
+   0x00, 0xbd, 0x0c, 0xed, 0x09, 0x02, 0xcb, 0x0d, 0xdd, 0x08, 0x02, 0xcd,
+   0x0f, 0xfd, 0x05, 0x00, 0xfd, 0x0f, 0xb5, 0x05, 0x04, 0xf5, 0x1e, 0xd3,
+   0x0b, 0x02, 0xaf, 0x2d, 0xbd, 0x09, 0x02, 0xdd, 0x2d, 0x16, 0x04, 0xd1,
+   0x1b, 0xc6, 0x03, 0x04, 0xe5, 0x0d, 0xa8, 0x02, 0x00, 0xdd, 0x1c, 0x73,
+   0x02, 0xe5, 0x0e, 0x99, 0x03, 0x00, 0x8f, 0x0f, 0xfb, 0x04, 0x04, 0x89,
+   0x0f, 0xb3, 0x07, 0x00, 0x85, 0x0e, 0xb1, 0x07, 0x00, 0xaf, 0x0c, 0xa5,
+   0x05, 0x04, 0x85, 0x18, 0xef, 0x02, 0x00, 0xf5, 0x41, 0xa0, 0x0f, 0x04,
+   0xb3, 0x0d, 0x78, 0x00, 0xa9, 0x0e, 0xbd, 0x02, 0x02, 0x89, 0x44, 0xdd,
+   0x13, 0x02, 0xe3, 0x45, 0x89, 0x0e, 0x01, 0x83, 0x3a, 0xb7, 0x1a, 0x03,
+   0xa9, 0x3f, 0xc7, 0x21, 0x00, 0xc1, 0x4a, 0xdb, 0x1a, 0x03, 0xd9, 0x0f,
+   0xd1, 0x03, 0x00, 0xbb, 0x48, 0x9f, 0x05, 0x01, 0xc7, 0x19, 0x80, 0x03,
+   0x02, 0xed, 0x0e, 0xd7, 0x0b, 0x00, 0xad, 0x21, 0xcb, 0x4d, 0x02, 0x97,
+   0x06, 0xd1, 0x16, 0x00, 0xd7, 0x02, 0xbf, 0x17, 0x04, 0xc9, 0x01, 0xd5,
+   0x2e, 0x00, 0xef, 0x02, 0xf7, 0x13, 0x04, 0xe1, 0x04, 0xa5, 0x12, 0x00,
+   0xc9, 0x07, 0xd5, 0x11, 0x00, 0xaf, 0x16, 0x87, 0x22, 0x02, 0xc7, 0x1d,
+   0xa7, 0x1e, 0x00, 0x85, 0x31, 0xff, 0x18, 0x00, 0xf3, 0x2b, 0xb7, 0x1a,
+   0x00, 0xd7, 0x0c, 0xcf, 0x0d, 0x05, 0xe9, 0x0d, 0xcd, 0x0e, 0x01, 0xb3,
+   0x16, 0xdd, 0x2e, 0x00, 0xef, 0x01, 0xe1, 0x19, 0x00, 0xf4, 0x28, 0x8a,
+   0x05, 0x02, 0xa8, 0x24, 0xf0, 0x04, 0x04, 0x8a, 0x10, 0x47, 0x04, 0x90,
+   0x18, 0xab, 0x03, 0x04, 0xb2, 0x16, 0xf1, 0x03, 0x04, 0x80, 0x16, 0x99,
+   0x04, 0x00, 0xbc, 0x17, 0xd3, 0x03, 0x00, 0x9a, 0x11, 0x69, 0x0a, 0xb0,
+   0x23, 0xa8, 0x09, 0x04, 0xca, 0x30, 0xae, 0x0b, 0x02, 0xde, 0x2c, 0x4c,
+   0x04, 0xa8, 0x15, 0xff, 0x04, 0x02, 0xf6, 0x18, 0xc1, 0x07, 0x02, 0xb6,
+   0x16, 0xd9, 0x0b, 0x02, 0xc6, 0x0d, 0x9b, 0x11, 0x00, 0xfa, 0x0b, 0x83,
+   0x17, 0x00, 0xb0, 0x27, 0xbf, 0x23, 0x04, 0xac, 0x1d, 0x9f, 0x3f, 0x02,
+   0xbe, 0x19, 0xab, 0x45, 0x04, 0xfc, 0x08, 0xcf, 0x22, 0x00, 0xc6, 0x04,
+   0xe5, 0x21, 0x08, 0xcc, 0x02, 0xcf, 0x21, 0x02, 0x0c, 0xbb, 0x21, 0x04,
+   0x83, 0x03, 0xd9, 0x21, 0x02, 0x8f, 0x03, 0x81, 0x21, 0x04, 0xe5, 0x05,
+   0xcf, 0x1e, 0x00, 0xd9, 0x08, 0xe3, 0x1b, 0x0c, 0xb5, 0x07, 0x97, 0x18,
+   0x04, 0xab, 0x08, 0xe5, 0x13, 0x04, 0xe7, 0x08, 0xc5, 0x0f, 0x02, 0xf9,
+   0x16, 0xf3, 0x14, 0x02, 0xc3, 0x4d, 0x8b, 0x19, 0x02, 0xdb, 0x0f, 0x8f,
+   0x06, 0x00, 0xbf, 0x4b, 0xdd, 0x34, 0x00, 0xe3, 0x3f, 0x9b, 0x25, 0x00,
+   0x9b, 0x46, 0xdb, 0x08, 0x02, 0xef, 0x1a, 0xef, 0x1a, 0x00, 0xd3, 0x11,
+   0xd7, 0x29, 0x00, 0xed, 0x08, 0x99, 0x12, 0x04, 0xe3, 0x1a, 0xa7, 0x15,
+   0x02, 0xd9, 0x24, 0x89, 0x07, 0x00, 0x97, 0x47, 0xfc, 0x0d, 0x04, 0xe5,
+   0x2b, 0xdc, 0x09, 0x02, 0xb9, 0x4f, 0x84, 0x01, 0x00, 0xa9, 0x40, 0xa8,
+   0x01, 0x01, 0xfb, 0x3a, 0xc1, 0x0f, 0x01, 0xe1, 0x47, 0xbd, 0x1a, 0x01,
+   0xbb, 0x5d, 0xd9, 0x24, 0x00, 0xdf, 0x61, 0xeb, 0x27, 0x04, 0xd7, 0x1a,
+   0xeb, 0x0b, 0x00, 0xb9, 0x16, 0xe3, 0x0a, 0x04, 0xd9, 0x12, 0xbd, 0x09,
+   0x04, 0xc5, 0x1c, 0xeb, 0x0e, 0x00, 0xb9, 0x09, 0xeb, 0x05, 0x02, 0xad,
+   0x06, 0xb9, 0x0e, 0x02, 0x64, 0x97, 0x05, 0x00, 0xf0, 0x02, 0x8d, 0x04,
+   0x00, 0xc2, 0x03, 0xf9, 0x04, 0x00, 0x82, 0x08, 0xff, 0x13, 0x00, 0xb4,
+   0x23, 0x95, 0x59, 0x00, 0xfc, 0x2f, 0x8d, 0x69, 0x00, 0xbc, 0x26, 0xdf,
+   0x36, 0x01, 0xca, 0x24, 0xbb, 0x31, 0x01, 0x8e, 0x31, 0xbf, 0x45, 0x03,
+   0x84, 0x1a, 0x87, 0x2c, 0x00, 0x84, 0x0f, 0xa9, 0x1f, 0x00, 0xf6, 0x06,
+   0xf7, 0x1e, 0x05, 0xd5, 0x05, 0xa7, 0x1a, 0x01, 0xbb, 0x0a, 0xe9, 0x18,
+   0x01, 0xaf, 0x16, 0xab, 0x42, 0x00, 0xf7, 0x04, 0xf1, 0x37, 0x01, 0xd6,
+   0x02, 0xe3, 0x09, 0x01, 0x90, 0x04, 0xeb, 0x08, 0x00, 0x92, 0x13, 0x83,
+   0x1b, 0x00, 0xf8, 0x09, 0x9d, 0x17, 0x01, 0xe2, 0x04, 0xa9, 0x1c, 0x00,
+   0xb9, 0x03, 0xbf, 0x41, 0x01, 0x02, 0xd1, 0x13, 0x01, 0xd0, 0x07, 0x97,
+   0x03, 0x01, 0xac, 0x05, 0xb6, 0x05, 0x00, 0xe6, 0x04, 0x84, 0x07, 0x03,
+   0xaa, 0x08, 0xc0, 0x07, 0x00, 0xba, 0x11, 0xba, 0x0c, 0x00, 0xd8, 0x11,
+   0xa2, 0x04, 0x00, 0x9e, 0x1f, 0x8d, 0x0a, 0x00, 0xc2, 0x17, 0xad, 0x12,
+   0x00, 0xd0, 0x0a, 0xaf, 0x0d, 0x04, 0x94, 0x09, 0xaf, 0x0f, 0x00, 0xac,
+   0x08, 0x89, 0x12, 0x02, 0xf2, 0x0a, 0xe3, 0x25, 0x04, 0xe0, 0x0c, 0x81,
+   0x26, 0x04, 0xfe, 0x19, 0x9f, 0x44, 0x00, 0xaa, 0x24, 0xa9, 0x56, 0x00,
+   0xc6, 0x09, 0xd5, 0x16, 0x00, 0xd6, 0x26, 0x9b, 0x5e, 0x01, 0xce, 0x10,
+   0xef, 0x30, 0x01, 0xca, 0x07, 0xb1, 0x18, 0x03, 0x92, 0x07, 0x93, 0x17,
+   0x01, 0xf6, 0x0b, 0xcf, 0x27, 0x01, 0x8e, 0x07, 0x87, 0x1f, 0x03, 0xac,
+   0x06, 0x9b, 0x2c, 0x00, 0xca, 0x03, 0xd9, 0x27, 0x03, 0x82, 0x01, 0x97,
+   0x0f, 0x03, 0x56, 0xe1, 0x0d, 0x01, 0x84, 0x01, 0xe3, 0x14, 0x01, 0x0b,
+   0x18, 0x00, 0x37, 0xe3, 0x09, 0x00, 0x94, 0x02, 0xb5, 0x10, 0x00, 0xfe,
+   0x03, 0xd3, 0x31, 0x00, 0xd3, 0x02, 0x9b, 0x01, 0x00, 0xb8, 0x01, 0xba,
+   0x0b, 0x00, 0xc1, 0x06, 0xca, 0x44, 0x00, 0xef, 0x07, 0xd2, 0x63, 0x02,
+   0xd1, 0x02, 0xf6, 0x12, 0x02, 0x8b, 0x03, 0xc0, 0x13, 0x00, 0xd0, 0x01,
+   0xdc, 0x05, 0x04, 0x98, 0x0a, 0xc1, 0x0d, 0x00, 0xc0, 0x08, 0xd9, 0x14,
+   0x00, 0xee, 0x21, 0x9d, 0x2d, 0x01, 0xfc, 0x0c, 0x9d, 0x0f, 0x03, 0xee,
+   0x06, 0xb9, 0x06, 0x01, 0x88, 0x08, 0x97, 0x06, 0x00, 0xac, 0x09, 0xc1,
+   0x05, 0x00, 0xb4, 0x0a, 0x8d, 0x04, 0x03, 0xa8, 0x17, 0xef, 0x03, 0x01,
+   0xd2, 0x19, 0xf3, 0x01, 0x01, 0xf6, 0x33, 0xd3, 0x16, 0x01, 0xc0, 0x31,
+   0xb9, 0x14, 0x01, 0xd6, 0x0b, 0x87, 0x01, 0x01, 0x96, 0x0b, 0xc5, 0x01,
+   0x00, 0x9a, 0x14, 0xad, 0x07, 0x01, 0x82, 0x0c, 0xa1, 0x05, 0x01, 0x8c,
+   0x05, 0x20, 0x01, 0x96, 0x02, 0x81, 0x03, 0x00, 0xd8, 0x0a, 0xbd, 0x05,
+   0x01, 0xf4, 0x10, 0xff, 0x02, 0x01, 0xb8, 0x2d, 0xb7, 0x08, 0x01, 0xd8,
+   0x0f, 0xc7, 0x06, 0x01, 0xe8, 0x02, 0x29, 0x00, 0xb2, 0x05, 0x0a, 0x00,
+   0x90, 0x06, 0x73, 0x01, 0xd4, 0x2e, 0x89, 0x0a, 0x00, 0xce, 0x11, 0x97,
+   0x03, 0x00, 0xae, 0x1e, 0xb7, 0x0c, 0x00, 0xaa, 0x17, 0x8d, 0x0c, 0x07,
+   0xca, 0x0e, 0xed, 0x07, 0x01, 0xc2, 0x15, 0xc7, 0x0c, 0x01, 0xa4, 0x07,
+   0xc1, 0x04, 0x00, 0x94, 0x0e, 0xc3, 0x08, 0x03, 0xac, 0x17, 0xbb, 0x13,
+   0x00, 0x9e, 0x1a, 0x8b, 0x19, 0x03, 0xce, 0x11, 0x99, 0x10, 0x01, 0xb4,
+   0x15, 0x87, 0x0e, 0x03, 0xfc, 0x14, 0xab, 0x0d, 0x01, 0x98, 0x13, 0xcb,
+   0x0b, 0x01, 0xe0, 0x1c, 0xa1, 0x12, 0x03, 0xca, 0x2c, 0xd5, 0x1f, 0x01,
+   0x9a, 0x3d, 0xb7, 0x2f, 0x01, 0x80, 0x34, 0xd7, 0x28, 0x01, 0x80, 0x44,
+   0x9d, 0x26, 0x01, 0xf6, 0x15, 0x9d, 0x08, 0x00, 0xba, 0x2a, 0xcd, 0x13,
+   0x00, 0x92, 0x15, 0xaf, 0x0d, 0x03, 0xf6, 0x09, 0x91, 0x08, 0x01, 0x96,
+   0x12, 0xf1, 0x11, 0x00, 0xe8, 0x22, 0xb5, 0x2a, 0x00, 0xe8, 0x11, 0x9d,
+   0x19, 0x05, 0x92, 0x0f, 0xc9, 0x16, 0x01, 0x82, 0x06, 0xb3, 0x07, 0x00,
+   0xe4, 0x05, 0xa7, 0x04, 0x03, 0xda, 0x05, 0x57, 0x00, 0xee, 0x0b, 0x80,
+   0x06, 0x01, 0xd8, 0x10, 0xe2, 0x0a, 0x01, 0xfc, 0x05, 0xb0, 0x02, 0x00,
+   0xe6, 0x04, 0xfa, 0x01, 0x03, 0xf0, 0x0c, 0xa0, 0x04, 0x01, 0x88, 0x10,
+   0xfe, 0x05, 0x00, 0xee, 0x06, 0xda, 0x01, 0x01, 0xae, 0x0f, 0xa6, 0x02,
+   0x01, 0xf0, 0x1a, 0xa8, 0x05, 0x01, 0xc6, 0x13, 0x96, 0x03, 0x03, 0xca,
+   0x12, 0xea, 0x03, 0x01, 0xe4, 0x11, 0x98, 0x0d, 0x00, 0x9c, 0x08, 0xaa,
+   0x09, 0x01, 0xb2, 0x18, 0xae, 0x1b, 0x00, 0xec, 0x10, 0xb6, 0x0b, 0x00,
+   0x9e, 0x1d, 0xaa, 0x05, 0x01, 0x84, 0x2a, 0xed, 0x04, 0x00, 0xa8, 0x08,
+   0x8d, 0x02, 0x00, 0xbc, 0x10, 0xa5, 0x08, 0x01, 0xc8, 0x11, 0xbf, 0x08,
+   0x03, 0x9e, 0x1b, 0x9d, 0x0c, 0x01, 0xf2, 0x18, 0x9f, 0x0b, 0x01, 0xde,
+   0x0f, 0xe5, 0x06, 0x01, 0xb4, 0x10, 0xc3, 0x04, 0x01, 0xe8, 0x07, 0x01,
+   0x01, 0xfa, 0x0e, 0x9a, 0x03, 0x01, 0xc2, 0x0b, 0xae, 0x03, 0x00, 0x82,
+   0x03, 0xc0, 0x05, 0x03, 0x50, 0xba, 0x07, 0x00, 0xf7, 0x0a, 0xf0, 0x0f,
+   0x01, 0xf5, 0x0a, 0x80, 0x0b, 0x00, 0xd1, 0x37, 0xd6, 0x3a, 0x03, 0xf3,
+   0x23, 0xb0, 0x2b, 0x01, 0x93, 0x0d, 0xee, 0x10, 0x03, 0xeb, 0x07, 0xc6,
+   0x0e, 0x01, 0xc1, 0x05, 0xd6, 0x0d, 0x03, 0xbf, 0x02, 0x9a, 0x0f, 0x01,
+   0xba, 0x04, 0xd8, 0x0c, 0x01, 0x86, 0x0c, 0xde, 0x07, 0x01, 0xae, 0x23,
+   0x81, 0x03, 0x03, 0xca, 0x15, 0xc5, 0x02, 0x00, 0x8c, 0x46, 0x8e, 0x0d,
+   0x00, 0xce, 0x51, 0xd8, 0x1d, 0x00, 0x94, 0x0e, 0xce, 0x07, 0x00, 0xdc,
+   0x0c, 0x92, 0x0c, 0x01, 0xde, 0x0b, 0xd0, 0x10, 0x01, 0xe8, 0x0b, 0xe6,
+   0x12, 0x00, 0x9c, 0x1d, 0xb2, 0x27, 0x03, 0xf4, 0x24, 0xd6, 0x2a, 0x01,
+   0xf2, 0x21, 0xf0, 0x25, 0x01, 0x9a, 0x19, 0xda, 0x1c, 0x01, 0x82, 0x0a,
+   0xe0, 0x0d, 0x03, 0xe2, 0x09, 0xb4, 0x0f, 0x01, 0xea, 0x09, 0xaa, 0x11,
+   0x01, 0xea, 0x10, 0xae, 0x25, 0x01, 0xa8, 0x1f, 0x94, 0x5e, 0x01, 0x94,
+   0x0a, 0xf6, 0x1a, 0x00, 0x8a, 0x19, 0x94, 0x36, 0x00, 0x8e, 0x21, 0xfa,
+   0x30, 0x01, 0xc6, 0x3c, 0xa4, 0x3b, 0x00, 0xfa, 0x12, 0xac, 0x13, 0x00,
+   0xc4, 0x47, 0xfe, 0x49, 0x01, 0xae, 0x1f, 0x80, 0x24, 0x03, 0xce, 0x1d,
+   0xd4, 0x25, 0x03, 0xf0, 0x0f, 0xce, 0x12, 0x00, 0xdc, 0x11, 0x80, 0x11,
+   0x01, 0x86, 0x14, 0x8a, 0x0f, 0x01, 0xbe, 0x15, 0x9a, 0x0e, 0x01, 0xca,
+   0x15, 0x90, 0x0e, 0x01, 0xae, 0x14, 0xde, 0x0d, 0x01, 0xb8, 0x12, 0xe2,
+   0x0c, 0x01, 0xdc, 0x1f, 0xbc, 0x17, 0x03, 0x9c, 0x1f, 0x98, 0x15, 0x00,
+   0xe6, 0x32, 0xe8, 0x1e, 0x00, 0xe4, 0x1f, 0x9a, 0x19, 0x07, 0x98, 0x1c,
+   0xa8, 0x17, 0x00, 0xc4, 0x1c, 0x98, 0x13, 0x03, 0xf0, 0x1c, 0xa4, 0x0a,
+   0x03, 0xd2, 0x1a, 0xde, 0x02, 0x01, 0x90, 0x2d, 0x15, 0x01, 0xf8, 0x13,
+   0x86, 0x07, 0x00, 0xaa, 0x09, 0xc8, 0x07, 0x00, 0x8e, 0x08, 0xe8, 0x0a,
+   0x01, 0xe0, 0x0c, 0xd0, 0x1c, 0x00, 0xd2, 0x0c, 0xb6, 0x20, 0x01, 0xde,
+   0x11, 0x92, 0x20, 0x01, 0xc4, 0x15, 0xf6, 0x21, 0x01, 0xca, 0x19, 0xba,
+   0x25, 0x00, 0x90, 0x1d, 0x92, 0x2d, 0x05, 0x80, 0x1b, 0xf2, 0x2e, 0x03,
+   0xee, 0x19, 0xe2, 0x27, 0x01, 0x82, 0x10, 0xb4, 0x11, 0x00, 0xd8, 0x4d,
+   0x82, 0x38, 0x00, 0xcc, 0x30, 0xc0, 0x21, 0x01, 0xe0, 0x11, 0xcc, 0x08,
+   0x00, 0x9a, 0x3b, 0xd8, 0x17, 0x01, 0xd4, 0x24, 0xb8, 0x16, 0x03, 0xd2,
+   0x10, 0xda, 0x0c, 0x01, 0xc2, 0x10, 0xb8, 0x0b, 0x01, 0xd2, 0x10, 0xe0,
+   0x09, 0x03, 0xd0, 0x10, 0xe0, 0x07, 0x00, 0xde, 0x10, 0xc4, 0x05, 0x03,
+   0xfa, 0x10, 0xc6, 0x03, 0x01, 0xb8, 0x11, 0xf4, 0x02, 0x01, 0x86, 0x12,
+   0xc8, 0x04, 0x01, 0x8e, 0x13, 0xcc, 0x08, 0x00, 0xa6, 0x14, 0xba, 0x0d,
+   0x03, 0x80, 0x15, 0xd8, 0x10, 0x00, 0xf0, 0x38, 0xba, 0x35, 0x03, 0xf2,
+   0x11, 0xd6, 0x10, 0x01, 0xb2, 0x11, 0xd4, 0x10, 0x00, 0xec, 0x0f, 0xee,
+   0x10, 0x05, 0x96, 0x1d, 0xcc, 0x1f, 0x03, 0xb2, 0x0d, 0x82, 0x0f, 0x01,
+   0xbe, 0x0d, 0x90, 0x0f, 0x03, 0xa8, 0x0d, 0xd0, 0x0f, 0x01, 0xb4, 0x0c,
+   0xce, 0x10, 0x01, 0xea, 0x0a, 0x88, 0x12, 0x01, 0xda, 0x0a, 0xf0, 0x13,
+   0x01, 0x9e, 0x0c, 0xd8, 0x13, 0x00, 0x92, 0x21, 0xe6, 0x1e, 0x00, 0xa0,
+   0x27, 0xec, 0x11, 0x01, 0xb0, 0x20, 0xf0, 0x1c, 0x00, 0xb8, 0x17, 0xfc,
+   0x27, 0x00, 0xc0, 0x18, 0xb6, 0x37, 0x01, 0xfa, 0x15, 0xce, 0x13, 0x00,
+   0xaa, 0x0a, 0xb6, 0x04, 0x05, 0xbc, 0x10, 0x96, 0x07, 0x00, 0xb0, 0x0a,
+   0x93, 0x05, 0x05, 0xac, 0x04, 0xe1, 0x0d, 0x03, 0x00, 0x85, 0x09, 0x00,
+   0xd9, 0x06, 0x99, 0x68, 0x02, 0xf7, 0x09, 0xd3, 0x29, 0x00, 0xa5, 0x15,
+   0xd5, 0x1f, 0x00, 0x9d, 0x16, 0xf1, 0x1b, 0x04, 0xed, 0x0b, 0xcd, 0x22,
+   0x00, 0xdf, 0x02, 0xbb, 0x2a, 0x00, 0x92, 0x0f, 0xb3, 0x32, 0x01, 0x9a,
+   0x0e, 0xbd, 0x1f, 0x00, 0xbc, 0x26, 0x8b, 0x7c, 0x00, 0xf0, 0x17, 0xb3,
+   0x64, 0x00, 0xc6, 0x15, 0x8f, 0x61, 0x00, 0x96, 0x20, 0xa5, 0x81, 0x01,
+   0x00, 0xf8, 0x11, 0x85, 0x47, 0x03, 0x9a, 0x07, 0xa1, 0x20, 0x01, 0xdc,
+   0x06, 0xd9, 0x1d, 0x01, 0xf2, 0x0c, 0xf7, 0x34, 0x03, 0xb2, 0x07, 0xe3,
+   0x16, 0x01, 0xa6, 0x08, 0xdb, 0x14, 0x00, 0xe2, 0x09, 0xb9, 0x12, 0x03,
+   0xac, 0x15, 0xab, 0x21, 0x00, 0xb8, 0x13, 0x9f, 0x20, 0x00, 0xc2, 0x1f,
+   0xbb, 0x38, 0x01, 0xf0, 0x1f, 0xad, 0x22, 0x00, 0xf2, 0x1d, 0xbf, 0x18,
+   0x02, 0xa0, 0x37, 0xfb, 0x35, 0x01, 0xe7, 0x06, 0xd4, 0x0b, 0x00, 0x95,
+   0x08, 0x8c, 0x0f, 0x02, 0xdf, 0x11, 0x80, 0x11, 0x00, 0x95, 0x48, 0xec,
+   0x3d, 0x00, 0xcf, 0x0e, 0xbe, 0x10, 0x00, 0xb7, 0x31, 0x9c, 0x53, 0x01,
+   0xc9, 0x22, 0xe8, 0x3a, 0x00, 0xcd, 0x0f, 0xd8, 0x31, 0x00, 0xb1, 0x16,
+   0xae, 0x66, 0x02, 0xfd, 0x15, 0xba, 0x5d, 0x04, 0xd5, 0x17, 0xf0, 0x5d,
+   0x02, 0xc1, 0x12, 0xda, 0x4c, 0x00, 0xb7, 0x12, 0x80, 0x4b, 0x00, 0xc5,
+   0x0e, 0xc8, 0x3d, 0x00, 0xab, 0x18, 0xc2, 0x62, 0x00, 0x93, 0x1e, 0xa2,
+   0x63, 0x08, 0xd5, 0x04, 0xb8, 0x14, 0x00, 0xa7, 0x02, 0xfc, 0x28, 0x02,
+   0x94, 0x09, 0xb0, 0x21, 0x00, 0xde, 0x09, 0xd0, 0x0e, 0x00, 0xb2, 0x0c,
+   0x88, 0x0d, 0x02, 0xea, 0x13, 0xf0, 0x23, 0x00, 0xca, 0x09, 0x9c, 0x2e,
+   0x00, 0xac, 0x02, 0xd2, 0x5c, 0x00, 0x49, 0xec, 0x0a, 0x00, 0x74, 0xee,
+   0x03, 0x01, 0xba, 0x0c, 0xe0, 0x09, 0x00, 0xf0, 0x17, 0xb2, 0x10, 0x01,
+   0xac, 0x2c, 0xa2, 0x44, 0x01, 0x98, 0x15, 0xba, 0x4a, 0x00, 0xca, 0x11,
+   0xb0, 0x7c, 0x00, 0xde, 0x09, 0xfe, 0x45, 0x00, 0xf8, 0x0b, 0xd2, 0x41,
+   0x03, 0xe8, 0x09, 0xb0, 0x3d, 0x03, 0x9a, 0x06, 0xf0, 0x6c, 0x00, 0x94,
+   0x01, 0xd0, 0x40, 0x00, 0xd2, 0x01, 0x82, 0x5b, 0x05, 0xdb, 0x02, 0x82,
+   0x10, 0x00, 0xc5, 0x12, 0x89, 0x04, 0x01, 0xa1, 0x34, 0xed, 0x36, 0x02,
+   0xa3, 0x36, 0xfd, 0x20, 0x02, 0xdf, 0x37, 0x9b, 0x18, 0x02, 0xdd, 0x30,
+   0xbd, 0x06, 0x04, 0x83, 0x22, 0xf3, 0x07, 0x00, 0xcf, 0x10, 0xd9, 0x02,
+   0x04, 0x83, 0x10, 0x65, 0x02, 0xb5, 0x0f, 0x18, 0x02, 0xf5, 0x0d, 0x4e,
+   0x02, 0xfd, 0x0c, 0x86, 0x02, 0x02, 0xa9, 0x0c, 0x8c, 0x05, 0x02, 0xf9,
+   0x09, 0x90, 0x0a, 0x00, 0x8d, 0x08, 0xd8, 0x0d, 0x02, 0xbf, 0x06, 0xda,
+   0x0e, 0x02, 0xe5, 0x05, 0xe4, 0x0e, 0x02, 0x99, 0x06, 0xe2, 0x0e, 0x02,
+   0x93, 0x0b, 0xfe, 0x1e, 0x04, 0xd3, 0x03, 0x9e, 0x11, 0x02, 0x89, 0x02,
+   0xa6, 0x11, 0x00, 0xc3, 0x04, 0x8a, 0x1f, 0x04, 0xa7, 0x04, 0xe8, 0x0e,
+   0x00, 0xf9, 0x0f, 0x9e, 0x16, 0x00, 0xa7, 0x11, 0xf0, 0x12, 0x02, 0xdd,
+   0x0f, 0xc0, 0x11, 0x00, 0xab, 0x0b, 0xee, 0x05, 0x02, 0xff, 0x0d, 0xb2,
+   0x04, 0x00, 0xb1, 0x10, 0x2a, 0x02, 0x8f, 0x25, 0xfb, 0x05, 0x00, 0xad,
+   0x14, 0xa5, 0x03, 0x08, 0x9d, 0x13, 0x9f, 0x03, 0x02, 0x89, 0x11, 0xcb,
+   0x04, 0x04, 0xb1, 0x10, 0xe5, 0x05, 0x02, 0x8d, 0x12, 0xc5, 0x04, 0x00,
+   0xeb, 0x29, 0xaf, 0x03, 0x06, 0x9d, 0x14, 0xd9, 0x01, 0x02, 0xfb, 0x12,
+   0x02, 0x00, 0xe9, 0x11, 0xea, 0x02, 0x00, 0xf7, 0x22, 0xce, 0x05, 0x06,
+   0xcd, 0x10, 0x5f, 0x02, 0xd1, 0x0e, 0xd3, 0x04, 0x00, 0xbf, 0x1c, 0x85,
+   0x0d, 0x04, 0x89, 0x10, 0x9f, 0x04, 0x02, 0xf5, 0x10, 0xfb, 0x01, 0x02,
+   0xcf, 0x22, 0xae, 0x01, 0x04, 0xf5, 0x0f, 0xc6, 0x02, 0x02, 0x8f, 0x1d,
+   0xc4, 0x08, 0x02, 0x91, 0x16, 0x39, 0x04, 0xb9, 0x08, 0x69, 0x02, 0x97,
+   0x08, 0xa4, 0x01, 0x02, 0xd7, 0x08, 0xae, 0x01, 0x00, 0x8d, 0x09, 0x3f,
+   0x02, 0xf1, 0x08, 0x71, 0x00, 0xdf, 0x08, 0x32, 0x02, 0x9b, 0x09, 0xf8,
+   0x01, 0x02, 0xc5, 0x09, 0xc6, 0x03, 0x00, 0xb9, 0x09, 0xe0, 0x04, 0x02,
+   0x97, 0x14, 0xc4, 0x08, 0x04, 0x8d, 0x14, 0x92, 0x05, 0x00, 0xc1, 0x12,
+   0xa8, 0x05, 0x06, 0xe7, 0x11, 0x82, 0x08, 0x00, 0xd1, 0x14, 0xc4, 0x05,
+   0x06, 0x83, 0x15, 0x92, 0x0f, 0x02, 0xfd, 0x15, 0x98, 0x0f, 0x00, 0xab,
+   0x15, 0x90, 0x08, 0x04, 0xcf, 0x11, 0xee, 0x07, 0x04, 0xe3, 0x07, 0xe4,
+   0x02, 0x00, 0x8b, 0x08, 0xf2, 0x02, 0x00, 0xa5, 0x08, 0xd4, 0x01, 0x06,
+   0xcb, 0x0d, 0x01, 0x04, 0xa9, 0x07, 0x6c, 0x00, 0xe9, 0x07, 0x80, 0x04,
+   0x02, 0xa9, 0x20, 0x90, 0x13, 0x02, 0x87, 0x21, 0x88, 0x06, 0x02, 0xe7,
+   0x06, 0xac, 0x02, 0x00, 0x9f, 0x14, 0x9a, 0x09, 0x00, 0xfd, 0x08, 0x8e,
+   0x06, 0x02, 0xbd, 0x14, 0x84, 0x0d, 0x00, 0xcf, 0x0a, 0xb6, 0x01, 0x02,
+   0xd7, 0x09, 0xe0, 0x03, 0x00, 0xff, 0x13, 0x96, 0x1f, 0x00, 0xd5, 0x21,
+   0xcc, 0x2a, 0x01, 0x97, 0x1b, 0xe6, 0x0e, 0x01, 0x9d, 0x21, 0xf2, 0x07,
+   0x00, 0xa7, 0x49, 0xe4, 0x04, 0x01, 0xa5, 0x4a, 0xd7, 0x09, 0x01, 0xaf,
+   0x0f, 0x8f, 0x01, 0x00, 0xeb, 0x4c, 0xc8, 0x24, 0x04, 0x87, 0x24, 0xa0,
+   0x14, 0x00, 0xbf, 0x0a, 0xec, 0x05, 0x02, 0xeb, 0x12, 0xce, 0x0e, 0x02,
+   0xf3, 0x16, 0xac, 0x0d, 0x00, 0xe1, 0x1b, 0x86, 0x10, 0x08, 0xb9, 0x1e,
+   0xf8, 0x0f, 0x02, 0xdb, 0x2c, 0xf4, 0x1a, 0x02, 0xe1, 0x0e, 0xaa, 0x0c,
+   0x00, 0xaf, 0x0e, 0x9a, 0x0e, 0x04, 0xcd, 0x1c, 0xd8, 0x1b, 0x02, 0xe5,
+   0x1b, 0xea, 0x13, 0x04, 0xd1, 0x0c, 0x96, 0x08, 0x02, 0xf1, 0x14, 0xbc,
+   0x0e, 0x00, 0xc3, 0x0d, 0x9a, 0x0e, 0x04, 0xb6, 0x03, 0xd0, 0x25, 0x00,
+   0xde, 0x05, 0xe2, 0x13, 0x00, 0x80, 0x0e, 0x96, 0x31, 0x00, 0x90, 0x0c,
+   0xb6, 0x3b, 0x06, 0xd2, 0x15, 0x92, 0x67, 0x02, 0xe2, 0x1d, 0xae, 0x5b,
+   0x00, 0xce, 0x12, 0x9a, 0x35, 0x00, 0xe6, 0x0f, 0xe0, 0x64, 0x01, 0xa8,
+   0x05, 0xa4, 0x69, 0x01, 0xd1, 0x0f, 0xc2, 0x57, 0x04, 0xf1, 0x12, 0x98,
+   0x57, 0x04, 0x99, 0x1e, 0xee, 0x63, 0x00, 0xed, 0x05, 0xa4, 0x0f, 0x03,
+   0xd1, 0x13, 0xcc, 0x2a, 0x01, 0x97, 0x0b, 0xc2, 0x14, 0x01, 0x93, 0x0b,
+   0xa8, 0x12, 0x00, 0xdf, 0x23, 0xbc, 0x3f, 0x01, 0xb3, 0x04, 0xc8, 0x09,
+   0x00, 0xcf, 0x06, 0x84, 0x19, 0x01, 0x15, 0xd8, 0x10, 0x01, 0xd2, 0x02,
+   0xe2, 0x22, 0x01, 0xbc, 0x02, 0xfc, 0x21, 0x00, 0xa4, 0x06, 0xa0, 0x2c,
+   0x03, 0x9e, 0x09, 0x84, 0x1c, 0x01, 0x84, 0x0b, 0xee, 0x18, 0x01, 0x9e,
+   0x06, 0xc2, 0x0a, 0x01, 0xfc, 0x06, 0xfc, 0x09, 0x01, 0xac, 0x18, 0x84,
+   0x1f, 0x00, 0xe6, 0x0e, 0xa4, 0x14, 0x03, 0x96, 0x04, 0xb2, 0x0a, 0x00,
+   0x90, 0x01, 0xc6, 0x08, 0x01, 0x67, 0xbc, 0x09, 0x00, 0xbd, 0x02, 0xa8,
+   0x0c, 0x01, 0x54, 0x88, 0x06, 0x01, 0x90, 0x0c, 0xec, 0x0e, 0x00, 0xc6,
+   0x0a, 0xea, 0x06, 0x00, 0xfe, 0x42, 0xf4, 0x36, 0x01, 0xfe, 0x40, 0xbc,
+   0x47, 0x01, 0xa0, 0x46, 0xf4, 0x49, 0x00, 0xd0, 0x1f, 0xf2, 0x1c, 0x01,
+   0xa4, 0x3c, 0x9e, 0x40, 0x00, 0xb6, 0x32, 0xe0, 0x41, 0x01, 0xb4, 0x39,
+   0xea, 0x40, 0x00, 0x86, 0x25, 0xc8, 0x30, 0x00, 0xc8, 0x0b, 0xfe, 0x2a,
+   0x00, 0x95, 0x0b, 0xe0, 0x2d, 0x00, 0xd1, 0x1a, 0xc6, 0x24, 0x00, 0xc9,
+   0x3e, 0xce, 0x4d, 0x00, 0xeb, 0x3b, 0xf6, 0x5d, 0x02, 0xd5, 0x10, 0xbc,
+   0x13, 0x00, 0xfd, 0x23, 0xc8, 0x1a, 0x00, 0x9d, 0x37, 0x8a, 0x1d, 0x03,
+   0x81, 0x1a, 0xa4, 0x1e, 0x01, 0xf9, 0x0c, 0x92, 0x2e, 0x01, 0x50, 0xc2,
+   0x1a, 0x00, 0xf6, 0x08, 0xb4, 0x1a, 0x01, 0x94, 0x0e, 0x88, 0x17, 0x00,
+   0xe4, 0x12, 0xf6, 0x12, 0x00, 0xd8, 0x2c, 0xba, 0x1f, 0x03, 0xea, 0x41,
+   0xde, 0x37, 0x00, 0xe2, 0x26, 0xde, 0x2b, 0x00, 0xdc, 0x20, 0xec, 0x38,
+   0x01, 0xbe, 0x22, 0xb2, 0x39, 0x00, 0xe2, 0x2a, 0xc0, 0x30, 0x01, 0xf2,
+   0x2e, 0xc6, 0x29, 0x01, 0x96, 0x36, 0xe6, 0x1e, 0x01, 0xbe, 0x33, 0xb2,
+   0x1a, 0x01, 0xbc, 0x35, 0xb2, 0x15, 0x03, 0x80, 0x36, 0xe6, 0x0b, 0x03,
+   0xf2, 0x4c, 0xf5, 0x01, 0x00, 0xa0, 0x2c, 0x63, 0x00, 0xe4, 0x23, 0xa8,
+   0x03, 0x07, 0xea, 0x17, 0xc4, 0x0b, 0x03, 0x98, 0x0b, 0xa8, 0x11, 0x01,
+   0xeb, 0x0c, 0xfa, 0x1a, 0x03, 0xb9, 0x12, 0xf0, 0x0d, 0x00, 0x8f, 0x2f,
+   0xb6, 0x1f, 0x01, 0xa1, 0x62, 0xb6, 0x35, 0x00, 0x9b, 0x47, 0xc6, 0x27,
+   0x03, 0xe5, 0x1f, 0xd6, 0x11, 0x00, 0xa1, 0x1d, 0xf8, 0x0f, 0x03, 0xd1,
+   0x1a, 0xa2, 0x0d, 0x03, 0xcf, 0x18, 0xe2, 0x0a, 0x01, 0x83, 0x16, 0x84,
+   0x07, 0x00, 0xc3, 0x2a, 0xe1, 0x04, 0x05, 0x9d, 0x26, 0xf7, 0x1b, 0x01,
+   0xfb, 0x1d, 0xbf, 0x2a, 0x03, 0xb1, 0x1a, 0xe5, 0x30, 0x01, 0x83, 0x0e,
+   0xc7, 0x17, 0x03, 0xb5, 0x0f, 0xc5, 0x16, 0x01, 0x9f, 0x12, 0xd1, 0x13,
+   0x00, 0xfb, 0x13, 0xdb, 0x10, 0x07, 0xbf, 0x15, 0x8b, 0x0e, 0x01, 0xc1,
+   0x16, 0xa3, 0x0c, 0x00, 0xa7, 0x17, 0xb7, 0x0b, 0x03, 0xef, 0x16, 0x9d,
+   0x0a, 0x00, 0xed, 0x15, 0x8f, 0x0a, 0x07, 0xdf, 0x16, 0xbb, 0x0a, 0x01,
+   0x89, 0x17, 0xdb, 0x0d, 0x03, 0xcb, 0x16, 0xb3, 0x13, 0x03, 0xfb, 0x16,
+   0xb9, 0x17, 0x00, 0xb3, 0x18, 0x95, 0x18, 0x03, 0xdd, 0x18, 0x8b, 0x17,
+   0x01, 0x95, 0x16, 0x8f, 0x16, 0x03, 0x83, 0x12, 0x9b, 0x17, 0x01, 0xeb,
+   0x0f, 0xf5, 0x16, 0x01, 0xd9, 0x0c, 0x8b, 0x15, 0x03, 0xa1, 0x0a, 0x8f,
+   0x0f, 0x03, 0xf3, 0x0a, 0xb5, 0x07, 0x03, 0xc7, 0x0a, 0xdc, 0x01, 0x01,
+   0xf1, 0x0a, 0xd8, 0x08, 0x00, 0x83, 0x08, 0xa0, 0x0e, 0x05, 0xbf, 0x13,
+   0x8e, 0x2b, 0x03, 0xe7, 0x05, 0xa0, 0x40, 0x00, 0xe4, 0x14, 0xce, 0x51,
+   0x02, 0x90, 0x2f, 0x94, 0x39, 0x02, 0xba, 0x16, 0xcc, 0x24, 0x02, 0xdc,
+   0x13, 0xba, 0x1d, 0x02, 0xb8, 0x12, 0xac, 0x19, 0x04, 0xda, 0x10, 0xc6,
+   0x1a, 0x02, 0x9a, 0x11, 0xb0, 0x1e, 0x00, 0xce, 0x27, 0x90, 0x63, 0x04,
+   0xaa, 0x04, 0x84, 0x3a, 0x02, 0xa3, 0x16, 0x8a, 0x2d, 0x00, 0xe1, 0x3c,
+   0x84, 0x18, 0x00, 0xbf, 0x1a, 0xd0, 0x1b, 0x00, 0xc1, 0x07, 0xe2, 0x26,
+   0x01, 0xf6, 0x01, 0xae, 0x12, 0x00, 0x98, 0x04, 0xfe, 0x11, 0x01, 0xbe,
+   0x07, 0xaa, 0x24, 0x00, 0xb8, 0x01, 0xca, 0x26, 0x00, 0xdf, 0x08, 0xea,
+   0x25, 0x02, 0xe9, 0x08, 0xde, 0x11, 0x02, 0xed, 0x0a, 0xa8, 0x11, 0x00,
+   0xf5, 0x0c, 0x9a, 0x12, 0x02, 0xad, 0x1d, 0xec, 0x28, 0x02, 0xfd, 0x23,
+   0x9e, 0x2f, 0x04, 0xe9, 0x26, 0xdc, 0x2b, 0x02, 0xbf, 0x1e, 0xce, 0x25,
+   0x00, 0xeb, 0x15, 0xbc, 0x2b, 0x00, 0xbb, 0x0a, 0xa4, 0x31, 0x00, 0x92,
+   0x01, 0x80, 0x32, 0x01, 0xf6, 0x0a, 0xaa, 0x2f, 0x00, 0x8e, 0x14, 0xbe,
+   0x29, 0x00, 0x80, 0x38, 0xce, 0x42, 0x00, 0xe2, 0x0e, 0x92, 0x0c, 0x00,
+   0xcc, 0x23, 0xc0, 0x0a, 0x01, 0x86, 0x2f, 0xe4, 0x05, 0x02, 0x84, 0x2f,
+   0x98, 0x19, 0x02, 0xec, 0x13, 0xa4, 0x12, 0x04, 0xb6, 0x10, 0xf8, 0x0d,
+   0x00, 0xa0, 0x0f, 0xf8, 0x06, 0x04, 0x96, 0x0f, 0x9d, 0x01, 0x02, 0x88,
+   0x19, 0xad, 0x16, 0x04, 0x88, 0x10, 0xb9, 0x25, 0x02, 0xfc, 0x18, 0xb5,
+   0x1d, 0x02, 0x9e, 0x1f, 0xb7, 0x02, 0x00, 0xee, 0x15, 0xdc, 0x1d, 0x06,
+   0xfc, 0x02, 0xc6, 0x2c, 0x02, 0xad, 0x11, 0xec, 0x2a, 0x04, 0xf1, 0x1a,
+   0xde, 0x21, 0x02, 0xb3, 0x0e, 0xec, 0x0e, 0x02, 0xb3, 0x21, 0xc4, 0x14,
+   0x04, 0x8d, 0x26, 0x9f, 0x05, 0x04, 0xdd, 0x27, 0xad, 0x15, 0x02, 0xf7,
+   0x25, 0xa1, 0x11, 0x04, 0xdb, 0x13, 0xe5, 0x01, 0x02, 0xa7, 0x14, 0xe6,
+   0x02, 0x02, 0xd3, 0x14, 0xf0, 0x06, 0x00, 0xcb, 0x14, 0xb6, 0x0a, 0x04,
+   0xfb, 0x13, 0xc6, 0x0e, 0x02, 0xa5, 0x12, 0xa8, 0x12, 0x02, 0xcd, 0x10,
+   0xb6, 0x14, 0x02, 0x87, 0x11, 0x86, 0x15, 0x02, 0x9d, 0x11, 0xec, 0x13,
+   0x00, 0xfb, 0x1f, 0x94, 0x27, 0x06, 0x89, 0x0c, 0xec, 0x16, 0x00, 0x81,
+   0x07, 0x90, 0x1a, 0x04, 0xcd, 0x02, 0x9a, 0x1d, 0x02, 0xda, 0x02, 0xe0,
+   0x1e, 0x00, 0xd0, 0x07, 0xda, 0x1e, 0x04, 0xa4, 0x0b, 0x90, 0x1e, 0x00,
+   0xb0, 0x0c, 0xd6, 0x1e, 0x02, 0x96, 0x0c, 0xec, 0x20, 0x02, 0xd0, 0x0c,
+   0xae, 0x22, 0x00, 0xde, 0x0b, 0xb4, 0x20, 0x06, 0xba, 0x0c, 0xd6, 0x1b,
+   0x04, 0xd8, 0x0e, 0xf6, 0x16, 0x02, 0xfe, 0x10, 0xbe, 0x13, 0x04, 0xc4,
+   0x12, 0x8e, 0x12, 0x02, 0xa8, 0x27, 0xa0, 0x23, 0x00, 0xf2, 0x29, 0xd4,
+   0x1c, 0x06, 0x84, 0x18, 0xf2, 0x08, 0x00, 0xa6, 0x35, 0x8c, 0x0c, 0x04,
+   0xb8, 0x3a, 0x84, 0x0b, 0x04, 0x88, 0x39, 0xc2, 0x0b, 0x00, 0xb8, 0x36,
+   0x88, 0x0c, 0x06, 0xf8, 0x1a, 0xb2, 0x09, 0x02, 0xd2, 0x2e, 0xe0, 0x18,
+   0x00, 0xdc, 0x4b, 0x84, 0x30, 0x02, 0xd0, 0x49, 0xe8, 0x2f, 0x02, 0xac,
+   0x34, 0xb4, 0x2d, 0x00, 0xa6, 0x19, 0xfa, 0x1b, 0x04, 0x98, 0x16, 0xde,
+   0x1d, 0x00, 0x94, 0x2f, 0xa8, 0x58, 0x00, 0xec, 0x16, 0xcc, 0x3e, 0x02,
+   0xf8, 0x16, 0xf2, 0x69, 0x02, 0xee, 0x0e, 0xe8, 0x53, 0x04, 0xc8, 0x0e,
+   0xba, 0x53, 0x02, 0x88, 0x04, 0x88, 0x25, 0x00, 0x05, 0xea, 0x23, 0x00,
+   0xa5, 0x04, 0xd4, 0x23, 0x06, 0xdf, 0x08, 0xd2, 0x22, 0x02, 0xf3, 0x0c,
+   0xd0, 0x1f, 0x02, 0xab, 0x11, 0xcc, 0x1b, 0x00, 0xcf, 0x14, 0xea, 0x17,
+   0x00, 0xf5, 0x18, 0x96, 0x13, 0x04, 0xeb, 0x1c, 0xac, 0x0e, 0x00, 0xdd,
+   0x1f, 0xde, 0x0b, 0x02, 0xcb, 0x3c, 0x9a, 0x1b, 0x04, 0xbb, 0x45, 0xd2,
+   0x40, 0x02, 0xa3, 0x10, 0xa8, 0x20, 0x00, 0xc9, 0x0c, 0xa8, 0x24, 0x00,
+   0xf9, 0x0c, 0xd8, 0x4d, 0x00, 0x80, 0x05, 0xda, 0x4d, 0x00, 0xc4, 0x16,
+   0xe4, 0x48, 0x02, 0xc4, 0x24, 0xf0, 0x46, 0x04, 0xd4, 0x10, 0xec, 0x20,
+   0x02, 0xe4, 0x0c, 0xae, 0x1f, 0x02, 0xcc, 0x08, 0xa0, 0x1f, 0x02, 0xc6,
+   0x03, 0x8e, 0x20, 0x00, 0xcb, 0x01, 0xf2, 0x20, 0x00, 0xdf, 0x06, 0xb0,
+   0x20, 0x02, 0x9b, 0x1c, 0xee, 0x38, 0x02, 0xe7, 0x15, 0x92, 0x18, 0x02,
+   0x95, 0x34, 0x88, 0x32, 0x00, 0xb5, 0x30, 0xd2, 0x3d, 0x00, 0xcd, 0x12,
+   0xaa, 0x23, 0x08, 0x95, 0x0f, 0x8c, 0x27, 0x00, 0xa3, 0x0b, 0xf4, 0x2c,
+   0x04, 0xa9, 0x0e, 0xba, 0x61, 0x04, 0xa5, 0x05, 0xc4, 0x2c, 0x02, 0xb3,
+   0x01, 0xe0, 0x27, 0x00, 0xea, 0x01, 0xf6, 0x25, 0x02, 0xd6, 0x06, 0xd2,
+   0x25, 0x02, 0xca, 0x0a, 0xa6, 0x24, 0x02, 0x94, 0x0e, 0x96, 0x23, 0x00,
+   0xce, 0x11, 0x86, 0x21, 0x02, 0xa6, 0x16, 0x94, 0x1f, 0x02, 0xa0, 0x18,
+   0xee, 0x1d, 0x00, 0x9c, 0x2f, 0xcc, 0x35, 0x06, 0x86, 0x2a, 0xd2, 0x30,
+   0x02, 0xdc, 0x3a, 0x96, 0x45, 0x02, 0xe4, 0x10, 0xd8, 0x17, 0x00, 0xe0,
+   0x17, 0xe6, 0x38, 0x02, 0x8c, 0x06, 0xf6, 0x21, 0x00, 0xbc, 0x06, 0x8e,
+   0x48, 0x04, 0x8e, 0x08, 0xfe, 0x44, 0x02, 0xb4, 0x08, 0xaa, 0x1f, 0x00,
+   0xbc, 0x0c, 0xe4, 0x1c, 0x00, 0xe2, 0x32, 0xda, 0x47, 0x02, 0xc2, 0x11,
+   0xf4, 0x15, 0x00, 0xce, 0x20, 0xc8, 0x2d, 0x02, 0xc2, 0x0d, 0xf8, 0x19,
+   0x02, 0xc6, 0x09, 0xae, 0x1d, 0x02, 0x80, 0x05, 0xb6, 0x20, 0x00, 0x97,
+   0x08, 0xfe, 0x6c, 0x02, 0xbb, 0x0c, 0xc0, 0x69, 0x00, 0xd5, 0x0d, 0xb6,
+   0x42, 0x02, 0xaf, 0x0a, 0x88, 0x20, 0x00, 0xdb, 0x23, 0xf6, 0x5c, 0x02,
+   0xdf, 0x09, 0xf0, 0x1f, 0x00, 0x87, 0x07, 0xf4, 0x22, 0x00, 0xad, 0x0f,
+   0xb2, 0x6e, 0x00, 0xe9, 0x03, 0xc8, 0x22, 0x02, 0xb5, 0x02, 0x9a, 0x42,
+   0x02, 0x8e, 0x09, 0xc8, 0x3d, 0x00, 0xd6, 0x13, 0xaa, 0x37, 0x00, 0x8a,
+   0x1f, 0xd0, 0x2e, 0x00, 0x94, 0x28, 0x96, 0x21, 0x02, 0x90, 0x46, 0xb2,
+   0x1a, 0x00, 0xa6, 0x2e, 0xba, 0x15, 0x02, 0xce, 0x26, 0xcc, 0x21, 0x00,
+   0xe8, 0x0e, 0xfe, 0x13, 0x00, 0xcc, 0x0a, 0x8e, 0x14, 0x02, 0xcc, 0x0d,
+   0xf4, 0x22, 0x02, 0xc4, 0x06, 0x9e, 0x1e, 0x00, 0xb6, 0x01, 0x82, 0x0e,
+   0x02, 0xf2, 0x01, 0x92, 0x37, 0x04, 0x72, 0xfe, 0x32, 0x02, 0x38, 0xb8,
+   0x46, 0x02, 0x40, 0xec, 0x54, 0x04, 0x10, 0xfe, 0x2d, 0x00, 0x32, 0xf4,
+   0x2c, 0x06, 0xfe, 0x01, 0xb6, 0x2a, 0x02, 0xee, 0x04, 0x80, 0x29, 0x04,
+   0xc6, 0x15, 0xac, 0x4d, 0x00, 0x84, 0x25, 0x9c, 0x45, 0x06, 0xe4, 0x14,
+   0xa4, 0x1c, 0x00, 0xd0, 0x13, 0xa6, 0x17, 0x08, 0x80, 0x14, 0xbc, 0x15,
+   0x02, 0xb0, 0x15, 0x96, 0x16, 0x02, 0xfa, 0x27, 0xc2, 0x29, 0x04, 0xee,
+   0x1e, 0xe4, 0x26, 0x02, 0xae, 0x16, 0xc2, 0x34, 0x00, 0x92, 0x07, 0x9e,
+   0x41, 0x08, 0x85, 0x08, 0xec, 0x7c, 0x02, 0xdf, 0x08, 0x96, 0x60, 0x00,
+   0x91, 0x09, 0xa0, 0x61, 0x08, 0xc3, 0x01, 0x84, 0x2e, 0x00, 0xe6, 0x08,
+   0xd8, 0x5a, 0x00, 0x80, 0x15, 0xaa, 0x6f, 0x04, 0xfe, 0x05, 0x82, 0x20,
+   0x00, 0x9c, 0x11, 0xfe, 0x54, 0x00, 0xbc, 0x08, 0xe8, 0x19, 0x02, 0xb0,
+   0x19, 0xcc, 0x34, 0x02, 0xec, 0x10, 0xce, 0x19, 0x00, 0xca, 0x14, 0xb8,
+   0x18, 0x04, 0xb4, 0x30, 0xb6, 0x31, 0x00, 0xa8, 0x1a, 0xd2, 0x19, 0x06,
+   0xe8, 0x1a, 0xa8, 0x1a, 0x04, 0xc0, 0x1b, 0x90, 0x1b, 0x02, 0x9e, 0x1c,
+   0x9e, 0x1c, 0x02, 0xee, 0x1c, 0x94, 0x1d, 0x00, 0xc0, 0x1d, 0xea, 0x1d,
+   0x08, 0x9e, 0x1e, 0xb2, 0x1e, 0x02, 0xe4, 0x1e, 0xe4, 0x1e, 0x04, 0x92,
+   0x1f, 0xaa, 0x1f, 0x00, 0xa4, 0x3f, 0xf2, 0x3f, 0x06, 0x82, 0x3e, 0x9a,
+   0x3e, 0x04, 0xa2, 0x1b, 0xe0, 0x1c, 0x02, 0x84, 0x18, 0xfa, 0x1b, 0x04,
+   0xde, 0x14, 0xe8, 0x1d, 0x02, 0xc2, 0x11, 0xb8, 0x22, 0x02, 0xea, 0x1d,
+   0xe0, 0x4d, 0x04, 0xf4, 0x10, 0xf6, 0x22, 0x00, 0xb4, 0x14, 0xae, 0x1e,
+   0x00, 0x84, 0x2e, 0x88, 0x35, 0x06, 0xe8, 0x14, 0x8a, 0x16, 0x02, 0xba,
+   0x12, 0xba, 0x13, 0x02, 0xa8, 0x1d, 0xf2, 0x1e, 0x00, 0xa8, 0x22, 0xaa,
+   0x29, 0x06, 0xfe, 0x0f, 0xdc, 0x2f, 0x00, 0xee, 0x02, 0xde, 0x0c, 0x00,
+   0xd4, 0x02, 0xbe, 0x26, 0x00, 0xcb, 0x09, 0xbc, 0x3a, 0x02, 0xe9, 0x17,
+   0x80, 0x3d, 0x02, 0xa3, 0x18, 0x9e, 0x34, 0x00, 0xeb, 0x28, 0xa4, 0x58,
+   0x04, 0x85, 0x22, 0xc2, 0x48, 0x02, 0x8f, 0x38, 0xd2, 0x79, 0x02, 0xd9,
+   0x27, 0xdc, 0x56, 0x00, 0xfd, 0x25, 0xee, 0x52, 0x00, 0x83, 0x34, 0x98,
+   0x70, 0x06, 0xe1, 0x0d, 0xae, 0x21, 0x00, 0xcf, 0x10, 0x8c, 0x44, 0x01,
+   0x9b, 0x0a, 0xd6, 0x69, 0x00, 0xc7, 0x08, 0x9c, 0x6c, 0x02, 0x8d, 0x05,
+   0xaa, 0x47, 0x00, 0xc3, 0x04, 0xc6, 0x69, 0x00, 0xe8, 0x01, 0xcc, 0x23,
+   0x00, 0x80, 0x03, 0x94, 0x23, 0x01, 0xfa, 0x07, 0xea, 0x41, 0x03, 0xf0,
+   0x0b, 0x82, 0x53, 0x01, 0x8e, 0x02, 0xde, 0x12, 0x00, 0xd0, 0x01, 0x96,
+   0x0e, 0x01, 0xb4, 0x02, 0x90, 0x01, 0x01, 0xba, 0x03, 0x2a, 0x01, 0xf0,
+   0x03, 0xc5, 0x01, 0x01, 0x20, 0x09, 0x01, 0xcc, 0x05, 0xa9, 0x03, 0x00,
+   0x92, 0x0c, 0xb9, 0x03, 0x00, 0xd4, 0x1c, 0xbc, 0x01, 0x01, 0xae, 0x19,
+   0xce, 0x04, 0x00, 0xac, 0x20, 0x92, 0x06, 0x00, 0xf8, 0x21, 0xd6, 0x06,
+   0x07, 0xc2, 0x10, 0xa2, 0x04, 0x01, 0x80, 0x11, 0xa4, 0x04, 0x01, 0xea,
+   0x10, 0xac, 0x04, 0x01, 0x82, 0x21, 0xce, 0x0a, 0x00, 0xf8, 0x1e, 0x86,
+   0x0a, 0x00, 0xec, 0x0e, 0xa8, 0x03, 0x00, 0xba, 0x1c, 0x96, 0x03, 0x0d,
+   0xe6, 0x19, 0x84, 0x02, 0x03, 0xd0, 0x15, 0x9a, 0x09, 0x00, 0xe2, 0x11,
+   0x92, 0x0f, 0x03, 0xa4, 0x0d, 0x9c, 0x07, 0x01, 0xb4, 0x09, 0x81, 0x04,
+   0x00, 0xae, 0x0a, 0xeb, 0x06, 0x01, 0x80, 0x1d, 0x95, 0x1a, 0x00, 0xe8,
+   0x09, 0xfd, 0x1b, 0x01, 0xa3, 0x02, 0xe1, 0x16, 0x01, 0xb3, 0x05, 0xcb,
+   0x1c, 0x03, 0xaf, 0x07, 0xf5, 0x1e, 0x01, 0xb5, 0x08, 0x91, 0x1d, 0x03,
+   0x89, 0x07, 0x9b, 0x18, 0x00, 0x8d, 0x05, 0xf1, 0x12, 0x03, 0xdd, 0x02,
+   0xb3, 0x0f, 0x03, 0x92, 0x01, 0xeb, 0x0f, 0x03, 0xc8, 0x06, 0x8f, 0x11,
+   0x03, 0x8c, 0x0a, 0x8b, 0x13, 0x03, 0xe8, 0x0a, 0xcb, 0x13, 0x01, 0xa8,
+   0x0a, 0xfd, 0x10, 0x00, 0xc4, 0x0c, 0xbd, 0x0a, 0x07, 0xb0, 0x0e, 0xa7,
+   0x02, 0x01, 0xf4, 0x0e, 0xa2, 0x03, 0x01, 0xec, 0x1a, 0x88, 0x0a, 0x03,
+   0xb2, 0x13, 0xdc, 0x0c, 0x01, 0xd4, 0x03, 0x86, 0x03, 0x00, 0xa6, 0x0b,
+   0xaa, 0x07, 0x01, 0xde, 0x40, 0xbe, 0x23, 0x00, 0x80, 0x21, 0x1b, 0x00,
+   0x80, 0x4b, 0x99, 0x0e, 0x00, 0xde, 0x1f, 0xa9, 0x05, 0x00, 0xde, 0x0b,
+   0xdf, 0x02, 0x06, 0xec, 0x09, 0xad, 0x03, 0x02, 0xe6, 0x0f, 0xcb, 0x06,
+   0x02, 0x9c, 0x0c, 0xf0, 0x08, 0x02, 0xa6, 0x0f, 0xec, 0x0e, 0x00, 0xc4,
+   0x10, 0x80, 0x06, 0x01, 0xfc, 0x07, 0xd2, 0x01, 0x00, 0xb4, 0x08, 0xfc,
+   0x03, 0x03, 0x90, 0x09, 0x82, 0x07, 0x00, 0xae, 0x1d, 0xc8, 0x18, 0x03,
+   0xfc, 0x15, 0xce, 0x07, 0x01, 0xb2, 0x0b, 0x43, 0x03, 0x8c, 0x0c, 0xcd,
+   0x01, 0x00, 0x9e, 0x0d, 0xbb, 0x01, 0x00, 0xea, 0x19, 0xf1, 0x04, 0x05,
+   0xec, 0x18, 0xef, 0x09, 0x03, 0xf6, 0x0c, 0x97, 0x05, 0x01, 0x9c, 0x0c,
+   0x9f, 0x05, 0x00, 0x92, 0x0d, 0xff, 0x05, 0x00, 0xaa, 0x0b, 0xbb, 0x05,
+   0x05, 0xaa, 0x09, 0x89, 0x04, 0x01, 0xae, 0x08, 0xf7, 0x01, 0x03, 0xae,
+   0x06, 0xc0, 0x01, 0x00, 0x8c, 0x06, 0xf2, 0x04, 0x00, 0xcc, 0x05, 0xe8,
+   0x01, 0x00, 0x96, 0x07, 0xf1, 0x04, 0x00, 0xee, 0x08, 0x85, 0x0c, 0x09,
+   0xf2, 0x09, 0xd3, 0x11, 0x00, 0xfa, 0x2e, 0xc9, 0x55, 0x01, 0xb6, 0x19,
+   0x91, 0x24, 0x00, 0xb0, 0x2a, 0xa9, 0x31, 0x00, 0xd4, 0x11, 0xd1, 0x23,
+   0x00, 0x90, 0x05, 0xf7, 0x13, 0x01, 0x9e, 0x07, 0xb3, 0x2b, 0x00, 0xa6,
+   0x01, 0x9f, 0x17, 0x01, 0x27, 0xf3, 0x17, 0x00, 0xf5, 0x05, 0xfb, 0x31,
+   0x00, 0xe7, 0x15, 0x99, 0x52, 0x00, 0xd5, 0x17, 0xd7, 0x3b, 0x02, 0xe1,
+   0x03, 0x85, 0x19, 0x02, 0xa9, 0x07, 0x91, 0x15, 0x00, 0xa1, 0x19, 0xdd,
+   0x29, 0x00, 0xcd, 0x07, 0xb7, 0x0e, 0x02, 0xb3, 0x1d, 0xdf, 0x33, 0x00,
+   0xe7, 0x07, 0xb5, 0x2b, 0x01, 0x44, 0x85, 0x30, 0x00, 0x94, 0x06, 0xe3,
+   0x31, 0x00, 0x95, 0x01, 0x9d, 0x2c, 0x02, 0xe1, 0x05, 0xcb, 0x1c, 0x00,
+   0xbf, 0x0d, 0xd5, 0x17, 0x00, 0x8d, 0x07, 0xcf, 0x0c, 0x03, 0xab, 0x03,
+   0xcd, 0x0f, 0x00, 0xb2, 0x10, 0xd5, 0x2e, 0x01, 0xfc, 0x3e, 0xdf, 0x0e,
+   0x04, 0x94, 0x1a, 0xc9, 0x08, 0x04, 0xc8, 0x0b, 0xe5, 0x05, 0x02, 0xda,
+   0x09, 0x97, 0x05, 0x04, 0x9e, 0x07, 0xfd, 0x03, 0x00, 0xf0, 0x05, 0xc3,
+   0x04, 0x04, 0x8e, 0x0b, 0xa3, 0x0e, 0x04, 0xf0, 0x04, 0xc9, 0x07, 0x02,
+   0xf6, 0x04, 0xc9, 0x07, 0x00, 0xfc, 0x03, 0xaf, 0x08, 0x00, 0xda, 0x02,
+   0x97, 0x09, 0x04, 0xca, 0x04, 0x9f, 0x14, 0x04, 0xb4, 0x02, 0x8f, 0x14,
+   0x02, 0xa1, 0x04, 0xc5, 0x0e, 0x02, 0xfd, 0x16, 0xf3, 0x09, 0x04, 0xbf,
+   0x0c, 0xed, 0x01, 0x02, 0xa3, 0x03, 0x88, 0x04, 0x00, 0x9b, 0x03, 0x84,
+   0x05, 0x02, 0xf3, 0x03, 0x96, 0x07, 0x00, 0xf5, 0x10, 0x90, 0x26, 0x00,
+   0xab, 0x05, 0x9f, 0x01, 0x00
+};
+
+#endif
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Converts a track to the SIMU_TEST_GPS replay format (see SimuTrack.cpp).
+
+Input is a trip log written by the dashboard, or any CSV with latitude,
+longitude and altitude (m) as first columns; lines that don't start with a
+number are skipped.
+Writes the binary file, to be copied to the file system as /simu_track.bin,
+and optionally the C header embedded in the firmware (simu_track.h).
+
+usage: simu_track.py track.csv simu_track.bin [--header simu_track.h]
+"""
+
+import argparse
+import struct
+
+MAGIC = b"STRK"
+VERSION = 1
+COORD_SCALE = 10000000      # 1e-7 degree, as GPS_COORD_SCALE
+MAX_POINTS = 0xFFFF
+
+
+def read_points(path):
+    points = []
+    with open(path) as f:
+        for line in f:
+            fields = [x.strip() for x in line.split(",")]
+            try:
+                lat, lng, alt = float(fields[0]), float(fields[1]), float(fields[2])
+            except (ValueError, IndexError):
+                continue
+            points.append((round(lat * COORD_SCALE), round(lng * COORD_SCALE), round(alt)))
+    return points[:MAX_POINTS]
+
+
+def varint(value):
+    zigzag = (value << 1) ^ (value >> 63)
+    out = bytearray()
+    while zigzag >= 0x80:
+        out.append((zigzag & 0x7F) | 0x80)
+        zigzag >>= 7
+    out.append(zigzag)
+    return out
+
+
+def encode(points):
+    out = bytearray(MAGIC)
+    out += struct.pack("<BBH", VERSION, 0, len(points))
+    prev = (0, 0, 0)
+    for point in points:
+        for value, previous in zip(point, prev):
+            out += varint(value - previous)
+        prev = point
+    return bytes(out)
+
+
+def write_header(path, data):
+    lines = ["#ifndef _SIMU_TRACK_BIN_H", "#define _SIMU_TRACK_BIN_H", "", "",
+             "// SIMU_TEST_GPS track, generated by tools/simu_track.py. Only included by SimuTrack.cpp",
+             "const uint8_t simu_track_bin[] = {"]
+    for i in range(0, len(data), 12):
+        lines.append("   " + " ".join("0x%02x," % b for b in data[i:i + 12]))
+    lines[-1] = lines[-1].rstrip(",")
+    lines += ["};", "", "#endif", ""]
+    with open(path, "w", newline="\r\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("track")
+    parser.add_argument("output")
+    parser.add_argument("--header")
+    args = parser.parse_args()
+
+    points = read_points(args.track)
+    data = encode(points)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    if args.header:
+        write_header(args.header, data)
+    print("%d points, %d bytes" % (len(points), len(data)))
+
+
+if __name__ == "__main__":
+    main()